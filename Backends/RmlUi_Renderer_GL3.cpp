@@ -86,6 +86,21 @@ void main() {
 	finalColor = fragColor * texColor;
 }
 )";
+static const char* shader_main_fragment_distance_field = RMLUI_SHADER_HEADER R"(
+uniform sampler2D _tex;
+in vec2 fragTexCoord;
+in vec4 fragColor;
+
+out vec4 finalColor;
+
+void main() {
+	// The distance to the glyph edge is stored in the alpha channel, with the edge at 0.5. Smooth the edge over about one screen pixel.
+	float distance = texture(_tex, fragTexCoord).a;
+	float smoothing = 0.7 * fwidth(distance);
+	float alpha = smoothstep(0.5 - smoothing, 0.5 + smoothing, distance);
+	finalColor = vec4(fragColor.rgb, fragColor.a * alpha);
+}
+)";
 static const char* shader_main_fragment_color = RMLUI_SHADER_HEADER R"(
 in vec2 fragTexCoord;
 in vec4 fragColor;
@@ -107,6 +122,7 @@ static const char* const vertex_attribute_names[(size_t)VertexAttribute::Count]
 
 struct CompiledGeometryData {
 	Rml::TextureHandle texture;
+	bool distance_field;
 	GLuint vao;
 	GLuint vbo;
 	GLuint ibo;
@@ -121,9 +137,11 @@ struct ProgramData {
 struct ShadersData {
 	ProgramData program_color;
 	ProgramData program_texture;
+	ProgramData program_distance_field;
 	GLuint shader_main_vertex;
 	GLuint shader_main_fragment_color;
 	GLuint shader_main_fragment_texture;
+	GLuint shader_main_fragment_distance_field;
 };
 
 static void CheckGLError(const char* operation_name)
@@ -267,6 +285,7 @@ static bool CreateShaders(ShadersData& out_shaders)
 	GLuint& main_vertex = out_shaders.shader_main_vertex;
 	GLuint& main_fragment_color = out_shaders.shader_main_fragment_color;
 	GLuint& main_fragment_texture = out_shaders.shader_main_fragment_texture;
+	GLuint& main_fragment_distance_field = out_shaders.shader_main_fragment_distance_field;
 
 	main_vertex = CreateShader(GL_VERTEX_SHADER, shader_main_vertex);
 	if (!main_vertex)
@@ -286,6 +305,12 @@ static bool CreateShaders(ShadersData& out_shaders)
 		Rml::Log::Message(Rml::Log::LT_ERROR, "Could not create OpenGL shader: 'shader_main_fragment_texture'.");
 		return false;
 	}
+	main_fragment_distance_field = CreateShader(GL_FRAGMENT_SHADER, shader_main_fragment_distance_field);
+	if (!main_fragment_distance_field)
+	{
+		Rml::Log::Message(Rml::Log::LT_ERROR, "Could not create OpenGL shader: 'shader_main_fragment_distance_field'.");
+		return false;
+	}
 
 	if (!CreateProgram(main_vertex, main_fragment_color, out_shaders.program_color))
 	{
@@ -297,6 +322,11 @@ static bool CreateShaders(ShadersData& out_shaders)
 		Rml::Log::Message(Rml::Log::LT_ERROR, "Could not create OpenGL program: 'program_texture'.");
 		return false;
 	}
+	if (!CreateProgram(main_vertex, main_fragment_distance_field, out_shaders.program_distance_field))
+	{
+		Rml::Log::Message(Rml::Log::LT_ERROR, "Could not create OpenGL program: 'program_distance_field'.");
+		return false;
+	}
 
 	return true;
 }
@@ -305,10 +335,12 @@ static void DestroyShaders(ShadersData& shaders)
 {
 	glDeleteProgram(shaders.program_color.id);
 	glDeleteProgram(shaders.program_texture.id);
+	glDeleteProgram(shaders.program_distance_field.id);
 
 	glDeleteShader(shaders.shader_main_vertex);
 	glDeleteShader(shaders.shader_main_fragment_color);
 	glDeleteShader(shaders.shader_main_fragment_texture);
+	glDeleteShader(shaders.shader_main_fragment_distance_field);
 
 	shaders = {};
 }
@@ -416,6 +448,7 @@ Rml::CompiledGeometryHandle RenderInterface_GL3::CompileGeometry(Rml::Vertex* ve
 
 	Gfx::CompiledGeometryData* geometry = new Gfx::CompiledGeometryData;
 	geometry->texture = texture;
+	geometry->distance_field = (distance_field_textures.count(texture) != 0);
 	geometry->vao = vao;
 	geometry->vbo = vbo;
 	geometry->ibo = ibo;
@@ -428,7 +461,14 @@ void RenderInterface_GL3::RenderCompiledGeometry(Rml::CompiledGeometryHandle han
 {
 	Gfx::CompiledGeometryData* geometry = (Gfx::CompiledGeometryData*)handle;
 
-	if (geometry->texture)
+	if (geometry->texture && geometry->distance_field)
+	{
+		glUseProgram(shaders->program_distance_field.id);
+		glBindTexture(GL_TEXTURE_2D, (GLuint)geometry->texture);
+		SubmitTransformUniform(ProgramId::DistanceField, shaders->program_distance_field.uniform_locations[(size_t)Gfx::ProgramUniform::Transform]);
+		glUniform2fv(shaders->program_distance_field.uniform_locations[(size_t)Gfx::ProgramUniform::Translate], 1, &translation.x);
+	}
+	else if (geometry->texture)
 	{
 		glUseProgram(shaders->program_texture.id);
 		if (geometry->texture != TextureEnableWithoutBinding)
@@ -654,8 +694,36 @@ bool RenderInterface_GL3::GenerateTexture(Rml::TextureHandle& texture_handle, co
 	return true;
 }
 
+bool RenderInterface_GL3::GenerateDistanceFieldTexture(Rml::TextureHandle& texture_handle, const Rml::byte* source,
+	const Rml::Vector2i& source_dimensions)
+{
+	if (!GenerateTexture(texture_handle, source, source_dimensions))
+		return false;
+
+	distance_field_textures.insert(texture_handle);
+	return true;
+}
+
+bool RenderInterface_GL3::UpdateTexture(Rml::TextureHandle texture_handle, const Rml::Vector2i& region_origin, const Rml::Vector2i& region_dimensions,
+	const Rml::byte* source, int source_stride)
+{
+	if (source_stride % 4 != 0)
+		return false;
+
+	glBindTexture(GL_TEXTURE_2D, (GLuint)texture_handle);
+
+	glPixelStorei(GL_UNPACK_ROW_LENGTH, source_stride / 4);
+	glTexSubImage2D(GL_TEXTURE_2D, 0, region_origin.x, region_origin.y, region_dimensions.x, region_dimensions.y, GL_RGBA, GL_UNSIGNED_BYTE, source);
+	glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+
+	glBindTexture(GL_TEXTURE_2D, 0);
+
+	return true;
+}
+
 void RenderInterface_GL3::ReleaseTexture(Rml::TextureHandle texture_handle)
 {
+	distance_field_textures.erase(texture_handle);
 	glDeleteTextures(1, (GLuint*)&texture_handle);
 }
 
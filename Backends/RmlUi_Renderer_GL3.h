@@ -69,6 +69,9 @@ public:
 
 	bool LoadTexture(Rml::TextureHandle& texture_handle, Rml::Vector2i& texture_dimensions, const Rml::String& source) override;
 	bool GenerateTexture(Rml::TextureHandle& texture_handle, const Rml::byte* source, const Rml::Vector2i& source_dimensions) override;
+	bool GenerateDistanceFieldTexture(Rml::TextureHandle& texture_handle, const Rml::byte* source, const Rml::Vector2i& source_dimensions) override;
+	bool UpdateTexture(Rml::TextureHandle texture_handle, const Rml::Vector2i& region_origin, const Rml::Vector2i& region_dimensions,
+		const Rml::byte* source, int source_stride) override;
 	void ReleaseTexture(Rml::TextureHandle texture_handle) override;
 
 	void SetTransform(const Rml::Matrix4f* transform) override;
@@ -77,7 +80,7 @@ public:
 	static const Rml::TextureHandle TextureEnableWithoutBinding = Rml::TextureHandle(-1);
 
 private:
-	enum class ProgramId { None, Texture = 1, Color = 2, All = (Texture | Color) };
+	enum class ProgramId { None, Texture = 1, Color = 2, DistanceField = 4, All = (Texture | Color | DistanceField) };
 	void SubmitTransformUniform(ProgramId program_id, int uniform_location);
 
 	Rml::Matrix4f transform, projection;
@@ -90,6 +93,9 @@ private:
 	int viewport_width = 0;
 	int viewport_height = 0;
 
+	// Textures containing signed distance fields, which are rendered using the distance field program.
+	Rml::UnorderedSet<Rml::TextureHandle> distance_field_textures;
+
 	Rml::UniquePtr<Gfx::ShadersData> shaders;
 };
 
@@ -146,6 +146,9 @@ public:
 	bool LoadTexture(Rml::TextureHandle& texture_handle, Rml::Vector2i& texture_dimensions, const Rml::String& source) override;
 	/// Called by RmlUi when a texture is required to be built from an internally-generated sequence of pixels.
 	bool GenerateTexture(Rml::TextureHandle& texture_handle, const Rml::byte* source, const Rml::Vector2i& source_dimensions) override;
+	/// Called by RmlUi when a region of a previously generated texture should be replaced with new data.
+	bool UpdateTexture(Rml::TextureHandle texture_handle, const Rml::Vector2i& region_origin, const Rml::Vector2i& region_dimensions,
+		const Rml::byte* source, int source_stride) override;
 
 	/// Called by RmlUi when a loaded texture is no longer required.
 	void ReleaseTexture(Rml::TextureHandle texture_handle) override;
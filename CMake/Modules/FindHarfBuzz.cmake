@@ -0,0 +1,23 @@
+# Try to find HarfBuzz
+if (TARGET harfbuzz)
+	# This is for when HarfBuzz is added via an add_subdirectory
+	set(HARFBUZZ_LIBRARIES harfbuzz)
+	get_target_property(HARFBUZZ_INCLUDE_DIRS harfbuzz INTERFACE_INCLUDE_DIRECTORIES)
+else()
+	find_path(HARFBUZZ_INCLUDE_DIR hb.h
+			HINTS $ENV{HARFBUZZ_DIR}
+			PATH_SUFFIXES harfbuzz include/harfbuzz src )
+
+	find_library(HARFBUZZ_LIBRARY NAMES harfbuzz libharfbuzz
+				HINTS $ENV{HARFBUZZ_DIR} $ENV{HARFBUZZ_DIR}/build
+				PATH_SUFFIXES lib release Release)
+
+	include(FindPackageHandleStandardArgs)
+	find_package_handle_standard_args(HarfBuzz  DEFAULT_MSG
+									HARFBUZZ_LIBRARY HARFBUZZ_INCLUDE_DIR)
+
+	mark_as_advanced(HARFBUZZ_INCLUDE_DIR HARFBUZZ_LIBRARY)
+
+	set(HARFBUZZ_LIBRARIES ${HARFBUZZ_LIBRARY} )
+	set(HARFBUZZ_INCLUDE_DIRS ${HARFBUZZ_INCLUDE_DIR} )
+endif()
@@ -52,6 +52,7 @@
 #include <memory>
 
 #ifdef RMLUI_NO_THIRDPARTY_CONTAINERS
+#include <map>
 #include <set>
 #include <unordered_set>
 #else
@@ -99,6 +100,8 @@ template <typename T>
 using SmallUnorderedSet = std::unordered_set< T >;
 template <typename T>
 using SmallOrderedSet = std::set< T >;
+template <typename Key, typename Value>
+using SmallOrderedMap = std::map< Key, Value >;
 #else
 template < typename Key, typename Value>
 using UnorderedMap = robin_hood::unordered_flat_map< Key, Value >;
@@ -110,6 +113,8 @@ template <typename T>
 using SmallUnorderedSet = itlib::flat_set< T >;
 template <typename T>
 using SmallOrderedSet = itlib::flat_set< T >;
+template <typename Key, typename Value>
+using SmallOrderedMap = itlib::flat_map< Key, Value >;
 #endif	// RMLUI_NO_THIRDPARTY_CONTAINERS
 template<typename Iterator>
 inline std::move_iterator<Iterator> MakeMoveIterator(Iterator it) { return std::make_move_iterator(it); }
@@ -75,6 +75,7 @@
 #include "Core/PropertyIdSet.h"
 #include "Core/PropertyParser.h"
 #include "Core/PropertySpecification.h"
+#include "Core/RenderCommandList.h"
 #include "Core/RenderInterface.h"
 #include "Core/Spritesheet.h"
 #include "Core/StringUtilities.h"
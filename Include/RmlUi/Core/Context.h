@@ -33,6 +33,7 @@
 #include "Types.h"
 #include "Traits.h"
 #include "Input.h"
+#include "RenderCommandList.h"
 #include "ScriptInterface.h"
 
 namespace Rml {
@@ -40,11 +41,14 @@ namespace Rml {
 class Stream;
 class ContextInstancer;
 class ElementDocument;
+class ElementUtilities;
 class EventListener;
+class Geometry;
 class RenderInterface;
 class DataModel;
 class DataModelConstructor;
 class DataTypeRegister;
+class RenderBatcher;
 enum class EventId : uint16_t;
 
 /**
@@ -232,6 +236,25 @@ public:
 	/// Gets the context's render interface.
 	/// @return The render interface the context renders through.
 	RenderInterface* GetRenderInterface() const;
+	/// Enable or disable batched rendering of this context.
+	/// When enabled, Render() records all geometry and state changes into a command list, merging adjacent geometry with identical
+	/// texture, scissor region and transform. The whole frame is then submitted at once through RenderInterface::RenderCommands().
+	/// @param[in] enable True to enable batched rendering, false to render each geometry immediately.
+	void EnableRenderBatching(bool enable);
+	/// Returns true if batched rendering is enabled.
+	bool IsRenderBatchingEnabled() const;
+	/// Enable or disable damage tracking, only applies when batched rendering is enabled.
+	/// When enabled, each rendered frame is compared against the previous one to find the regions of the context whose rendered output
+	/// changed, including changes to geometry, textures, clipping and transforms. The regions are available through GetDamagedRegions(),
+	/// and are also passed to RenderInterface::RenderCommands(). If nothing changed, the frame is not submitted to the render interface at
+	/// all, and the application should keep displaying its previous frame.
+	/// @param[in] enable True to enable damage tracking.
+	void EnableDamageTracking(bool enable);
+	/// Returns true if damage tracking is enabled.
+	bool IsDamageTrackingEnabled() const;
+	/// Returns the regions of the context that changed during the last call to Render(). Empty if nothing changed since the previous frame.
+	/// Without damage tracking, this is always a single region covering the whole context.
+	const Vector<RenderRegion>& GetDamagedRegions() const;
 	/// Gets the current clipping region for the render traversal
 	/// @param[out] origin The clipping origin
 	/// @param[out] dimensions The clipping dimensions
@@ -349,6 +372,11 @@ private:
 
 	UniquePtr<DataTypeRegister> data_type_register;
 
+	// Records the frame during rendering when render batching is enabled, otherwise null.
+	UniquePtr<RenderBatcher> render_batcher;
+	bool damage_tracking = false;
+	Vector<RenderRegion> damaged_regions;
+
 	// Internal callback for when an element is detached or removed from the hierarchy.
 	void OnElementDetach(Element* element);
 	// Internal callback for when a new element gains focus.
@@ -381,10 +409,15 @@ private:
 	// Releases all unloaded documents pending destruction.
 	void ReleaseUnloadedDocuments();
 
+	// Returns the render batcher if the context is currently being rendered in batched mode, otherwise nullptr.
+	RenderBatcher* GetActiveRenderBatcher() const;
+
 	// Sends the specified event to all elements in new_items that don't appear in old_items.
 	static void SendEvents(const ElementSet& old_items, const ElementSet& new_items, EventId id, const Dictionary& parameters);
 
 	friend class Rml::Element;
+	friend class Rml::ElementUtilities;
+	friend class Rml::Geometry;
 	friend RMLUICORE_API Context* CreateContext(const String&, Vector2i, RenderInterface*);
 };
 
@@ -161,6 +161,48 @@ RMLUICORE_API void ReleaseCompiledGeometry();
 /// Releases unused font textures and rendered glyphs to free up memory, and regenerates actively used fonts.
 /// @note Invalidates all existing FontFaceHandles returned from the font engine.
 RMLUICORE_API void ReleaseFontResources();
+/// Sets the number of background threads used by the default font engine to rasterize glyphs and generate font effect textures.
+/// While an effect texture is being generated, text is rendered without that effect. Disabled by default.
+/// @param[in] num_threads The number of worker threads, or zero to do all font work synchronously.
+/// @note Custom font effects must support generating glyph textures concurrently when worker threads are enabled.
+RMLUICORE_API void SetFontEngineWorkerThreads(int num_threads);
+/// Enables rendering text of the default font engine from signed distance fields. The glyphs of each scalable font face are then rendered once
+/// into an atlas shared by all font sizes, and scaled to each size when generating geometry. Font effects are generated from the distance
+/// fields, limited to the extent of the distance field around each glyph. Disabled by default.
+/// @param[in] enable True to render text from distance fields, false to rasterize the glyphs for each font size.
+/// @note Applies to font sizes first used after this call, call ReleaseFontResources() to apply it to all text.
+/// @note Sharp edges at all sizes require the render interface to implement RenderInterface::GenerateDistanceFieldTexture().
+RMLUICORE_API void SetFontEngineDistanceFieldRendering(bool enable);
+
+/// The memory used by a font face handle of the default font engine, see GetFontEngineMemoryUsage().
+struct FontFaceMemoryUsage {
+	String family;
+	Style::FontStyle style = Style::FontStyle::Normal;
+	Style::FontWeight weight = Style::FontWeight::Normal;
+	int size = 0;
+
+	/// The number of glyphs loaded for this size.
+	int num_glyphs = 0;
+	/// The number of font effect layers currently generated.
+	int num_layers = 0;
+
+	/// The size in bytes of the glyphs and their bitmaps.
+	size_t glyph_bytes = 0;
+	/// The size in bytes of the textures generated for the font layers.
+	size_t texture_bytes = 0;
+	/// The approximate size in bytes of the kerning and text shaping caches.
+	size_t cache_bytes = 0;
+};
+
+/// Sets the memory budget of the default font engine. The budget is enforced whenever new font resources are generated. If the glyphs,
+/// textures, and caches of all font face handles then exceed the budget, the resources of the least recently used handles and font effect
+/// layers are released. They are generated anew if used again. Resources used since the budget was last enforced are kept, thus the budget
+/// may be exceeded by the text in use. Disabled by default.
+/// @param[in] budget The memory budget in bytes, or zero to keep all font resources until ReleaseFontResources() is called.
+/// @note The distance field atlases shared by all sizes of a font face are not included in the budget.
+RMLUICORE_API void SetFontEngineMemoryBudget(size_t budget);
+/// Returns the memory used by each font face handle of the default font engine.
+RMLUICORE_API Vector<FontFaceMemoryUsage> GetFontEngineMemoryUsage();
 
 /// Forces all memory pools used by RmlUi to be released.
 RMLUICORE_API void ReleaseMemoryPools();
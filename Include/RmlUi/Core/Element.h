@@ -45,6 +45,7 @@ namespace Rml {
 
 class Context;
 class DataModel;
+class DataViewFor;
 class Decorator;
 class ElementInstancer;
 class EventDispatcher;
@@ -55,6 +56,7 @@ class ElementDocument;
 class ElementScroll;
 class ElementStyle;
 class LayoutEngine;
+class LayoutDetails;
 class LayoutInlineBox;
 class LayoutBlockBox;
 class PropertiesIteratorView;
@@ -64,6 +66,7 @@ class StyleSheet;
 class StyleSheetContainer;
 class TransformState;
 struct ElementMeta;
+struct LayoutCache;
 struct StackingOrderedChild;
 
 enum class ScrollAlignment {
@@ -648,6 +651,11 @@ protected:
 
 	/// Forces a re-layout of this element, and any other elements required.
 	virtual void DirtyLayout();
+	/// Forces a re-layout of this element's contents. Unlike DirtyLayout(), this does not imply that our own box changes, thus only the contents
+	/// need to be re-formatted when this element is a layout boundary.
+	void DirtyLayoutOfContents();
+	/// Invalidates any cached layout results of this element and its ancestors.
+	void DirtyLayoutCache();
 	/// Returns true if the element has been marked as needing a re-layout.
 	virtual bool IsLayoutDirty();
 
@@ -676,6 +684,15 @@ private:
 	
 	void SetDataModel(DataModel* new_data_model);
 
+	/// Dirties the style definition of the elements which may be matched differently after a change to this element.
+	/// @param[in] invalidation The affected elements, as a combination of StyleSheetIndex::InvalidationFlags.
+	void DirtyDefinition(int invalidation);
+
+	/// Moves the given children to be placed consecutively in front of the adjacent element, without detaching them from the hierarchy.
+	/// @param[in] ordered_children The children to move, in their new order. Must all be DOM children of this element.
+	/// @param[in] adjacent_element The DOM child to place them in front of, must not be one of the moved children.
+	void MoveChildrenBefore(const ElementList& ordered_children, Element* adjacent_element);
+
 	void DirtyAbsoluteOffset();
 	void DirtyAbsoluteOffsetRecursive();
 	void UpdateOffset();
@@ -725,7 +742,11 @@ private:
 	bool offset_fixed;
 	bool absolute_offset_dirty;
 
+	// True if the element was last formatted as a layout boundary, see LayoutEngine::IsLayoutBoundary().
+	bool layout_boundary;
+
 	bool dirty_definition : 1; // Implies dirty child definitions as well.
+	bool dirty_own_definition : 1; // Only this element's definition, does not imply dirty child definitions.
 	bool dirty_child_definitions : 1;
 
 	bool dirty_animation : 1;
@@ -783,6 +804,12 @@ private:
 	Vector2f content_offset;
 	Vector2f content_box;
 
+	// The containing block used when the element was last formatted as a layout boundary.
+	Vector2f layout_boundary_containing_block;
+
+	// Results of formatting the element in its own block formatting context, only created for elements formatted in this way.
+	UniquePtr< LayoutCache > layout_cache;
+
 	float baseline;
 	float z_index;
 
@@ -795,8 +822,10 @@ private:
 	ElementMeta* meta;
 
 	friend class Rml::Context;
+	friend class Rml::DataViewFor;
 	friend class Rml::ElementStyle;
 	friend class Rml::LayoutEngine;
+	friend class Rml::LayoutDetails;
 	friend class Rml::LayoutBlockBox;
 	friend class Rml::LayoutInlineBox;
 	friend class Rml::ElementScroll;
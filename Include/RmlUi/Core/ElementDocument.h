@@ -160,6 +160,9 @@ private:
 	void DirtyLayout() override;
 	/// Returns true if the document has been marked as needing a re-layout.
 	bool IsLayoutDirty() override;
+	/// Marks the layout dirty starting from the contents of the given element. Only the nearest layout boundary enclosing the element is
+	/// re-formatted when possible, otherwise the whole document is.
+	void DirtyLayoutFrom(Element* element);
 
 	/// Notify the document that media query related properties have changed and that style sheets need to be re-evaluated.
 	void DirtyMediaQueries();
@@ -191,10 +194,13 @@ private:
 
 	// Is the layout dirty?
 	bool layout_dirty;
+	// Layout boundaries whose contents need to be re-formatted, only considered when the layout is not dirty as a whole.
+	Vector<ObserverPtr<Element>> dirty_layout_boundaries;
 
 	bool position_dirty;
 
 	friend class Rml::Context;
+	friend class Rml::Element;
 	friend class Rml::Factory;
 
 };
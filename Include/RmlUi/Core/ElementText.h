@@ -55,8 +55,9 @@ public:
 	/// Generates a token of text from this element, returning only the width.
 	/// @param[out] token_width The window (in pixels) of the token.
 	/// @param[in] token_begin The first character to be included in the token.
+	/// @param[in] decode_escape_characters Decode escaped characters such as &amp; into &, should match the lines generated from the text.
 	/// @return True if the token is the end of the element's text, false if not.
-	bool GenerateToken(float& token_width, int token_begin);
+	bool GenerateToken(float& token_width, int token_begin, bool decode_escape_characters);
 	/// Generates a line of text rendered from this element.
 	/// @param[out] line The characters making up the line, with white-space characters collapsed and endlines processed appropriately.
 	/// @param[out] line_length The number of characters from the source string consumed making up this string; this may very well be different from line.size()!
@@ -106,8 +107,41 @@ private:
 	// Generates any geometry necessary for rendering decoration (underline, strike-through, etc).
 	void GenerateDecoration(const FontFaceHandle font_face_handle);
 
+	// A section of the text between two break opportunities, built once and reused when re-wrapping the text.
+	struct TextToken
+	{
+		int begin, end;             // The range of the token in the source text.
+		String string;              // The token with white-space processing and text transformation applied.
+		String first_string;        // The token when beginning a line with its white-space prefix trimmed, built on demand.
+		bool first_string_built;
+		bool break_line;            // True if an endline is forced after the token.
+		bool last_token;            // True if the token ends the text for the purpose of line breaking.
+		Character width_prior;      // The codepoint preceding the token when its width was measured.
+		int width;                  // The width of the token, or -1 if not measured for the current font.
+		int first_width;            // The width of the trimmed token beginning a line, or -1 if not measured.
+	};
+
+	// Rebuilds the tokens if the text or its formatting has changed, and resets their widths if the font has changed.
+	void UpdateTokens(FontFaceHandle font_face_handle, bool collapse_white_space, bool break_at_endline, Style::TextTransform text_transform, bool decode_escape_characters);
+	// Returns the index of the first token beginning at or after the given offset into the text.
+	size_t FindToken(int offset) const;
+	// Returns the contents of a token as placed on a line, and measures its width.
+	const String& MeasureToken(TextToken& token, int& token_width, FontFaceHandle font_face_handle, bool first_token, Character previous_codepoint);
+
 	String text;
 
+	using TextTokenList = Vector< TextToken >;
+	TextTokenList tokens;
+
+	// The font and formatting the tokens were built and measured with.
+	FontFaceHandle tokens_font_face_handle;
+	int tokens_font_version;
+	Style::TextTransform tokens_text_transform;
+	bool tokens_dirty : 1;
+	bool tokens_collapse_white_space : 1;
+	bool tokens_break_at_endline : 1;
+	bool tokens_decode_escape_characters : 1;
+
 	using LineList = Vector< Line >;
 	LineList lines;
 
@@ -43,6 +43,9 @@ public:
 	// Behind or in front of the main text.
 	enum class Layer { Back, Front };
 
+	// The texture data generated from distance fields, or None if the effect does not support distance field mode.
+	enum class DistanceFieldOutput { None, DistanceField, Coverage };
+
 	FontEffect();
 	virtual ~FontEffect();
 
@@ -65,6 +68,21 @@ public:
 	/// @param[in] glyph The glyph the effect is being asked to generate an effect texture for.
 	virtual void GenerateGlyphTexture(byte* destination_data, Vector2i destination_dimensions, int destination_stride, const FontGlyph& glyph) const;
 
+	/// Asks the font effect how it generates its unique texture when text is rendered in distance field mode.
+	/// @return The type of data written by GenerateGlyphDistanceFieldTexture(). The default implementation returns None, in which case the effect
+	/// is not rendered in this mode.
+	virtual DistanceFieldOutput GetDistanceFieldOutput() const;
+
+	/// Requests the effect to generate the texture data for a single glyph from its signed distance field. Called instead of
+	/// GenerateGlyphTexture() when text is rendered in distance field mode. The texture is scaled together with the glyph's distance field, and
+	/// offset as given by the difference in centers of the dimensions returned from GetGlyphMetrics(). The default implementation does nothing.
+	/// @param[out] destination_data The top-left corner of the glyph's 32-bit, RGBA-ordered, destination texture. Note that the glyph shares its texture with other glyphs.
+	/// @param[in] destination_dimensions The dimensions of the glyph's area on its texture, equal to the dimensions of its distance field.
+	/// @param[in] destination_stride The stride of the glyph's texture.
+	/// @param[in] distance_field The distance field of the glyph the effect is being asked to generate an effect texture for.
+	virtual void GenerateGlyphDistanceFieldTexture(byte* destination_data, Vector2i destination_dimensions, int destination_stride,
+		const FontGlyphDistanceField& distance_field) const;
+
 	/// Sets the colour of the effect's geometry.
 	void SetColour(Colourb colour);
 	/// Returns the effect's colour.
@@ -35,6 +35,15 @@
 
 namespace Rml {
 
+/// The placement of a glyph within a string shaped by FontEngineInterface::ShapeString().
+struct ShapedGlyphPosition {
+	/// The byte offset of the first character represented by the glyph. A single glyph may represent several characters, such as for
+	/// ligatures, and several glyphs may represent a single character.
+	int string_offset;
+	/// The glyph's origin relative to the start of the string's baseline, in pixels.
+	Vector2i position;
+};
+
 /**
 	The abstract base class for an application-specific font engine implementation.
 	
@@ -113,6 +122,15 @@ public:
 	/// @return The width, in pixels, this string will occupy if rendered with this handle.
 	virtual int GetStringWidth(FontFaceHandle handle, const String& string, Character prior_character = Character::Null);
 
+	/// Called when the glyphs of a string and their placement are needed, such as to locate characters within shaped text. Glyphs are
+	/// listed in visual order. The default implementation places one glyph per character after the width of the preceding characters, as
+	/// measured by GetStringWidth(). Engines which shape text, such as to form ligatures, should override this.
+	/// @param[in] handle The font handle.
+	/// @param[in] string The string to shape.
+	/// @param[out] glyphs The glyphs of the string are appended to this list.
+	/// @return The width, in pixels, of the shaped string.
+	virtual int ShapeString(FontFaceHandle handle, const String& string, Vector<ShapedGlyphPosition>& glyphs);
+
 	/// Called by RmlUi when it wants to retrieve the geometry required to render a single line of text.
 	/// @param[in] face_handle The font handle.
 	/// @param[in] font_effects_handle The handle to the prepared font effects for which the geometry should be generated.
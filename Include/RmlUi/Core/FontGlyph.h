@@ -77,5 +77,18 @@ public:
 
 using FontGlyphMap = UnorderedMap<Character, FontGlyph>;
 
+/**
+	The signed distance field of a single glyph, used when rendering text in distance field mode.
+ */
+
+struct FontGlyphDistanceField {
+	/// The distance to the glyph's edge, one byte per texel. The edge is at the value 128, and larger values are inside the glyph.
+	const byte* data;
+	/// The dimensions of the distance field, in texels.
+	Vector2i dimensions;
+	/// The change in value for each pixel of distance, at the font size the glyph is rendered at.
+	float units_per_pixel;
+};
+
 } // namespace Rml
 #endif
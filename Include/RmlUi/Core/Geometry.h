@@ -106,6 +106,10 @@ private:
 	CompiledGeometryHandle compiled_geometry = 0;
 	bool compile_attempted = false;
 
+	// Hash of the vertices and indices used for damage tracking, invalidated whenever the geometry may have been modified.
+	size_t content_hash = 0;
+	bool content_hash_valid = false;
+
 	GeometryDatabaseHandle database_handle;
 };
 
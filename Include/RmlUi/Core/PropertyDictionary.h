@@ -35,7 +35,7 @@
 namespace Rml {
 
 /**
-	A dictionary to property names to values.
+	A dictionary to property names to values. The properties are kept ordered by their id, which lets dictionaries be merged in a single pass.
 
 	@author Peter Curry
  */
@@ -76,10 +76,10 @@ public:
 	void SetSourceOfAllProperties(const SharedPtr<const PropertySource>& property_source);
 
 private:
-	// Sets a property on the dictionary and its specificity if there is no name conflict, or its
-	// specificity (given by the parameter, not read from the property itself) is at least equal to
-	// the specificity of the conflicting property.
-	void SetProperty(PropertyId id, const Property& property, int specificity);
+	// Merges the given properties with the dictionary. In the case of id conflicts, the incoming properties overwrite the existing ones if their
+	// specificity is at least equal. The specificity of the incoming properties is the forced specificity if positive, otherwise their original
+	// specificity plus the offset.
+	void MergeProperties(const PropertyMap& other, int forced_specificity, int specificity_offset);
 
 	PropertyMap properties;
 };
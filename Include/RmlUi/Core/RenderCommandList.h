@@ -0,0 +1,101 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+#ifndef RMLUI_CORE_RENDERCOMMANDLIST_H
+#define RMLUI_CORE_RENDERCOMMANDLIST_H
+
+#include "Header.h"
+#include "Types.h"
+#include "Vertex.h"
+
+namespace Rml {
+
+enum class RenderCommandType : uint8_t { RenderGeometry, EnableScissorRegion, SetScissorRegion, SetTransform };
+
+/**
+	A single command recorded during a batched render of a context. Only the members relevant to the command type are used.
+ */
+
+struct RenderCommand {
+	RenderCommandType type;
+
+	// RenderGeometry: Offsets into the command list's vertex and index arrays. Indices are relative to the vertex offset.
+	int vertex_offset = 0;
+	int num_vertices = 0;
+	int index_offset = 0;
+	int num_indices = 0;
+	TextureHandle texture = 0;
+
+	// EnableScissorRegion, SetScissorRegion
+	bool scissor_enabled = false;
+	Vector2i scissor_origin;
+	Vector2i scissor_dimensions;
+
+	// SetTransform: Index into the command list's transforms, or -1 to disable the transform.
+	int transform_index = -1;
+};
+
+/**
+	A rectangular region of the context, in pixels.
+ */
+
+struct RenderRegion {
+	Vector2i origin;
+	Vector2i dimensions;
+};
+
+/**
+	The full set of draw and state commands making up a frame of a context rendered in batched mode.
+
+	Geometry is stored in shared vertex and index arrays. Adjacent geometry sharing the same texture, scissor region and
+	transform is merged into a single RenderGeometry command, with the translation already applied to the vertices.
+	Commands are kept in painting order, and redundant state changes are removed.
+ */
+
+struct RenderCommandList {
+	Vector<RenderCommand> commands;
+	Vector<Vertex> vertices;
+	Vector<int> indices;
+	Vector<Matrix4f> transforms;
+
+	// True if damage tracking is enabled, see Context::EnableDamageTracking().
+	bool damage_tracking = false;
+	// When damage tracking is enabled, the regions of the context whose rendered output changed since the previous frame.
+	Vector<RenderRegion> damaged_regions;
+
+	void Clear()
+	{
+		commands.clear();
+		vertices.clear();
+		indices.clear();
+		transforms.clear();
+		damaged_regions.clear();
+	}
+};
+
+} // namespace Rml
+#endif
@@ -31,6 +31,7 @@
 
 #include "Traits.h"
 #include "Header.h"
+#include "RenderCommandList.h"
 #include "Texture.h"
 #include "Vertex.h"
 #include "Types.h"
@@ -38,6 +39,7 @@
 namespace Rml {
 
 class Context;
+class TextureResource;
 
 /**
 	The abstract base class for application-specific rendering implementation. Your application must provide a concrete
@@ -102,6 +104,27 @@ public:
 	/// @param[in] source_dimensions The dimensions, in pixels, of the source data.
 	/// @return True if the texture generation succeeded and the handle is valid, false if not.
 	virtual bool GenerateTexture(TextureHandle& texture_handle, const byte* source, const Vector2i& source_dimensions);
+	/// Called by RmlUi when a texture containing signed distance fields is required, such as for rendering text in distance field mode.
+	/// Geometry rendered with the texture should be shaded by thresholding the distance at the edge value, with smoothing over about one
+	/// screen pixel, and multiplied by the vertex colour. If not implemented, the distance fields are converted to coverage on the CPU and
+	/// generated as a regular texture through GenerateTexture(). This works with any renderer, but edges are blurry when scaled up.
+	/// @param[out] texture_handle The handle to write the texture handle for the generated texture to.
+	/// @param[in] source The raw 8-bit texture data, in the same format as for GenerateTexture(). Red, green and blue are white, while the
+	/// alpha channel holds the signed distance to the nearest edge. The edge is at the value 128, larger values are inside the shape, and
+	/// each texel of distance changes the value by 8.
+	/// @param[in] source_dimensions The dimensions, in pixels, of the source data.
+	/// @return True if the texture generation succeeded and the handle is valid, false if not.
+	virtual bool GenerateDistanceFieldTexture(TextureHandle& texture_handle, const byte* source, const Vector2i& source_dimensions);
+	/// Called by RmlUi when a region of a previously generated texture should be replaced with new data, such as when new glyphs are
+	/// added to a font texture. If not implemented, or false is returned, the texture is released and generated anew when next needed.
+	/// @param[in] texture_handle The handle of a texture previously generated by GenerateTexture().
+	/// @param[in] region_origin The top-left corner, in pixels, of the region to update.
+	/// @param[in] region_dimensions The dimensions, in pixels, of the region to update. The region is contained within the texture.
+	/// @param[in] source The raw 8-bit texture data of the region, in the same format as for GenerateTexture().
+	/// @param[in] source_stride The distance, in bytes, between the start of each row in the source data.
+	/// @return True if the texture was updated, false if not.
+	virtual bool UpdateTexture(TextureHandle texture_handle, const Vector2i& region_origin, const Vector2i& region_dimensions, const byte* source,
+		int source_stride);
 	/// Called by RmlUi when a loaded texture is no longer required.
 	/// @param texture The texture handle to release.
 	virtual void ReleaseTexture(TextureHandle texture);
@@ -112,14 +135,25 @@ public:
 	/// @param[in] transform The new transform to apply, or nullptr if no transform applies to the current element.
 	virtual void SetTransform(const Matrix4f* transform);
 
+	/// Called by RmlUi when a context with render batching enabled has finished recording a frame, see Context::EnableRenderBatching().
+	/// All geometry and state changes of the frame are submitted at once, in painting order. The default implementation submits each
+	/// command through the functions above, thereby drawing each merged batch using a single call to RenderGeometry().
+	/// With damage tracking enabled, the command list also contains the regions that changed since the previous frame, which can be used to
+	/// limit drawing to these regions.
+	/// @param[in] command_list The commands, geometry and transforms recorded during the frame.
+	virtual void RenderCommands(const RenderCommandList& command_list);
+
 	/// Get the context currently being rendered. This is only valid during RenderGeometry,
-	/// CompileGeometry, RenderCompiledGeometry, EnableScissorRegion and SetScissorRegion.
+	/// CompileGeometry, RenderCompiledGeometry, EnableScissorRegion, SetScissorRegion and RenderCommands.
 	Context* GetContext() const;
 
 private:
 	Context* context;
+	// Set when UpdateTexture() has failed, then texture updates are skipped in favor of generating the texture anew.
+	bool texture_update_failed;
 
 	friend class Rml::Context;
+	friend class Rml::TextureResource;
 };
 
 } // namespace Rml
@@ -77,6 +77,17 @@ public:
 	/// Returns the compiled element definition for a given element and its hierarchy.
 	SharedPtr<const ElementDefinition> GetElementDefinition(const Element* element) const;
 
+	/// Returns true if the two elements are always matched by the same rules in this style sheet, provided that their ancestors are too.
+	/// This is the case when they share tag, id, classes, pseudo classes, and the values of any attributes used by the selectors, and no rules
+	/// depend on the position of the elements among their siblings.
+	bool IsMatchingEquivalent(const Element* a, const Element* b) const;
+
+	/// Returns the elements that may be matched by different rules when the given class, pseudo-class, or attribute is set or removed on an
+	/// element, as a combination of StyleSheetIndex::InvalidationFlags. Zero if no rules depend on it.
+	int GetClassInvalidation(const String& class_name) const;
+	int GetPseudoClassInvalidation(const String& pseudo_class) const;
+	int GetAttributeInvalidation(const String& attribute_name) const;
+
 	/// Returns a list of instanced decorators from the declarations. The instances are cached for faster future retrieval.
 	const Vector<SharedPtr<const Decorator>>& InstanceDecorators(const DecoratorDeclarationList& declaration_list, const PropertySource* decorator_source) const;
 
@@ -85,11 +85,31 @@ using MediaBlockList = Vector<MediaBlock>;
  */
 struct StyleSheetIndex {
 	using NodeList = Vector<const StyleSheetNode*>;
+	// Keyed by the atom (interned name) of the indexed id, class, or tag.
 	using NodeIndex = UnorderedMap<std::size_t, NodeList>;
 
 	// The following objects are given in prioritized order. Any nodes in the first object will not be contained in the next one and so on.
 	NodeIndex ids, classes, tags;
 	NodeList other;
+
+	// Compound selectors of styled nodes that depend on the position of elements among their siblings, by structural selectors or sibling
+	// combinators. Keyed by the atom of their id, first class, or tag, or by the 'any' flag if none of these are set.
+	SmallUnorderedSet<std::size_t> sibling_dependent;
+	bool any_sibling_dependent = false;
+	// The names of all attributes tested by the styled nodes.
+	StringList attribute_names;
+
+	// Invalidation sets: The elements that may be matched by different styled nodes when a class, pseudo-class, or attribute is changed on an
+	// element, as a combination of invalidation flags. Classes and pseudo-classes are keyed by their atom, attributes by their name. Any name
+	// not present here is not tested by any styled node, thus changing it does not affect the style of any element.
+	enum InvalidationFlags {
+		InvalidateSelf = 1 << 0,
+		InvalidateDescendants = 1 << 1,
+		InvalidateSiblings = 1 << 2, // Subsequent siblings, and their descendants.
+		InvalidateAll = InvalidateSelf | InvalidateDescendants | InvalidateSiblings,
+	};
+	UnorderedMap<std::size_t, int> class_invalidation, pseudo_class_invalidation;
+	UnorderedMap<String, int> attribute_invalidation;
 };
 } // namespace Rml
 
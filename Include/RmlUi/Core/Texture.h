@@ -64,7 +64,8 @@ public:
 	/// Set a callback function for generating the texture on first use. The texture is never added to the global cache.
 	/// @param[in] name The name of the texture.
 	/// @param[in] callback The callback function which generates the data of the texture, see TextureCallback.
-	void Set(const String& name, const TextureCallback& callback);
+	/// @param[in] distance_field True if the generated data contains signed distance fields, see RenderInterface::GenerateDistanceFieldTexture().
+	void Set(const String& name, const TextureCallback& callback, bool distance_field = false);
 
 	/// Returns the texture's source name. This is usually the name of the file the texture was loaded from.
 	/// @return The name of the this texture's source. This will be the empty string if this texture is not loaded.
@@ -78,6 +79,25 @@ public:
 	/// @return The texture's dimensions. This will be (0, 0) if the texture isn't loaded.
 	Vector2i GetDimensions(RenderInterface* render_interface) const;
 
+	/// Replaces a region of the texture with new data, keeping its handle for each render interface the texture has been generated for.
+	/// Render interfaces which do not support partial updates release the texture instead, it is then loaded anew from its source on
+	/// next use. Thus, the source or callback should also reflect the new data. Distance field textures are always released.
+	/// @param[in] region_origin The top-left corner, in pixels, of the region to update.
+	/// @param[in] region_dimensions The dimensions, in pixels, of the region to update.
+	/// @param[in] source The raw 8-bit texture data of the region, see TextureCallback.
+	/// @param[in] source_stride The distance, in bytes, between the start of each row in the source data.
+	/// @return True if the texture was updated in place, false if any of its handles was released as a result.
+	bool Update(const Vector2i& region_origin, const Vector2i& region_dimensions, const byte* source, int source_stride);
+	/// Returns false if an update of the texture is known to release it, which is the case for distance field textures and after the render
+	/// interface failed to update any texture. Then, setting the texture anew avoids preparing data for Update() in vain.
+	/// @param[in] render_interface The render interface the texture is rendered with.
+	/// @return True if the texture is set and may be updated in place.
+	bool IsUpdateSupported(RenderInterface* render_interface) const;
+	/// Returns the version of the texture's data, which changes on every call to Update(). Use this to detect that the texture's data
+	/// changed while its handle remained the same.
+	/// @return The texture's version, or zero if the underlying resource is not set.
+	int GetVersion() const;
+
 	/// Returns true if the texture points to the same underlying resource.
 	bool operator==(const Texture&) const;
 
@@ -71,6 +71,8 @@ private:
 	bool LoadAnimation();
 	// Update the texture for the next animation frame when necessary.
 	void UpdateTexture();
+	// Renders the current animation frame into new texture data.
+	UniquePtr<byte[]> GenerateTextureData();
 
 	bool animation_dirty = false;
 	bool geometry_dirty = false;
@@ -89,7 +91,7 @@ private:
 
 	// The absolute time when the current animation was first displayed.
 	double time_animation_start = -1;
-	// The previous animation frame displayed.
+	// The animation frame currently displayed.
 	size_t prev_animation_frame = size_t(-1);
 
 	UniquePtr<rlottie::Animation> animation;
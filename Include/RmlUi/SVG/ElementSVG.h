@@ -71,6 +71,8 @@ private:
 	bool LoadSource();
 	// Update the texture when necessary.
 	void UpdateTexture();
+	// Renders the SVG document into new texture data.
+	UniquePtr<byte[]> GenerateTextureData();
 
 	bool source_dirty = false;
 	bool geometry_dirty = false;
@@ -78,6 +80,8 @@ private:
 
 	// The texture this element is rendering from.
 	Texture texture;
+	// The dimensions of the texture data generated by the texture.
+	Vector2i texture_dimensions;
 
 	// The image's intrinsic dimensions.
 	Vector2f intrinsic_dimensions;
@@ -0,0 +1,86 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_ANCESTORFILTER_H
+#define RMLUI_CORE_ANCESTORFILTER_H
+
+#include "../../Include/RmlUi/Core/Types.h"
+#include "Atom.h"
+
+namespace Rml {
+
+/**
+	Bloom filter over the atoms of a set of elements, used to quickly reject selectors during matching.
+
+	Each element keeps a filter containing the tags, ids, and classes of all its ancestors. Each style sheet node keeps a filter of the atoms its
+	selector requires to be present on the ancestors of a matching element. If any of the required bits are missing from the element's filter, the
+	node can never apply to the element. False positives are possible, false negatives are not.
+ */
+
+class AncestorFilter {
+public:
+	/// Adds the given atom to the filter, the empty atom is ignored.
+	void Add(Atom atom)
+	{
+		if (atom == Atom::None)
+			return;
+		const uint32_t hash = static_cast<uint32_t>(atom) * 2654435761u;
+		SetBit(hash);
+		SetBit(hash >> 16);
+	}
+
+	/// Adds all the atoms in the other filter to this one.
+	void Add(const AncestorFilter& other)
+	{
+		for (int i = 0; i < NumWords; i++)
+			words[i] |= other.words[i];
+	}
+
+	/// Returns false if any atom in the given filter is definitely not contained in this filter.
+	bool MayContainAll(const AncestorFilter& other) const
+	{
+		uint64_t missing = 0;
+		for (int i = 0; i < NumWords; i++)
+			missing |= (other.words[i] & ~words[i]);
+		return missing == 0;
+	}
+
+private:
+	static constexpr int NumWords = 4;
+
+	void SetBit(uint32_t hash)
+	{
+		const uint32_t bit = hash % (NumWords * 64);
+		words[bit / 64] |= (uint64_t(1) << (bit % 64));
+	}
+
+	uint64_t words[NumWords] = {};
+};
+
+} // namespace Rml
+#endif
@@ -0,0 +1,79 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "Atom.h"
+
+namespace Rml {
+
+// An atom is an index into the names vector.
+static Vector<String> names = { String() };
+
+// Reverse lookup map from name to atom.
+static UnorderedMap<String, Atom> name_lookup;
+
+namespace AtomTable {
+
+Atom GetOrInsert(const String& name)
+{
+	if (name.empty())
+		return Atom::None;
+
+	auto it = name_lookup.find(name);
+	if (it != name_lookup.end())
+		return it->second;
+
+	const Atom atom = static_cast<Atom>(names.size());
+	names.push_back(name);
+	name_lookup.emplace(name, atom);
+	return atom;
+}
+
+Atom Find(const String& name)
+{
+	auto it = name_lookup.find(name);
+	if (it != name_lookup.end())
+		return it->second;
+	return Atom::None;
+}
+
+const String& GetName(Atom atom)
+{
+	const size_t i = static_cast<size_t>(atom);
+	if (i < names.size())
+		return names[i];
+	return names[0];
+}
+
+void Clear()
+{
+	Vector<String>{String()}.swap(names);
+	UnorderedMap<String, Atom>().swap(name_lookup);
+}
+
+} // namespace AtomTable
+} // namespace Rml
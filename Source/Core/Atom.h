@@ -0,0 +1,66 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_ATOM_H
+#define RMLUI_CORE_ATOM_H
+
+#include "../../Include/RmlUi/Core/Types.h"
+
+namespace Rml {
+
+/**
+	Interned string identifier.
+
+	Tags, ids, class names and pseudo-class names are interned both on elements and in style sheet selectors, so that selector matching
+	reduces to integer comparisons. The atom of a given string is stable until RmlUi is shut down.
+
+	Names are never removed while RmlUi is running, thus the table grows with the number of distinct names ever given to elements or
+	selectors. Lookups which only query existing names should use Find(), so that arbitrary query strings are not interned.
+ */
+enum class Atom : uint32_t { None = 0 };
+
+namespace AtomTable {
+
+	// Get the atom for the given name.
+	// If not found: Inserts a new entry. The empty string always maps to Atom::None.
+	Atom GetOrInsert(const String& name);
+
+	// Get the atom for the given name, without inserting it.
+	// Returns Atom::None if the name has not been interned.
+	Atom Find(const String& name);
+
+	// Get the name of the given atom.
+	// Returns an empty string if the atom does not exist.
+	const String& GetName(Atom atom);
+
+	// Remove all entries and release their memory. Called during shutdown, after all elements and style sheets have been released.
+	void Clear();
+}
+
+} // namespace Rml
+#endif
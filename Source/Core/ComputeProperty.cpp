@@ -313,4 +313,150 @@ uint16_t ComputeBorderWidth(float computed_length)
 	return uint16_t(computed_length + 0.5f);
 }
 
+// Overloads of the compute functions taking their inputs from the compute context.
+static float ComputeLength(const Property* p, const PropertyComputeContext& c)
+{
+	return ComputeLength(p, c.font_size, c.document_font_size, c.dp_ratio, c.vp_dimensions);
+}
+static Style::LengthPercentage ComputeLengthPercentage(const Property* p, const PropertyComputeContext& c)
+{
+	return ComputeLengthPercentage(p, c.font_size, c.document_font_size, c.dp_ratio, c.vp_dimensions);
+}
+static Style::LengthPercentageAuto ComputeLengthPercentageAuto(const Property* p, const PropertyComputeContext& c)
+{
+	return ComputeLengthPercentageAuto(p, c.font_size, c.document_font_size, c.dp_ratio, c.vp_dimensions);
+}
+static Style::LengthPercentage ComputeOrigin(const Property* p, const PropertyComputeContext& c)
+{
+	return ComputeOrigin(p, c.font_size, c.document_font_size, c.dp_ratio, c.vp_dimensions);
+}
+static Style::LengthPercentage ComputeMaxSize(const Property* p, const PropertyComputeContext& c)
+{
+	return ComputeMaxSize(p, c.font_size, c.document_font_size, c.dp_ratio, c.vp_dimensions);
+}
+
+using PropertyComputeTable = Array<PropertyComputeFunctions, size_t(PropertyId::NumDefinedIds)>;
+
+static PropertyComputeTable BuildPropertyComputeTable()
+{
+	using namespace Style;
+	using Values = ComputedValues;
+	using Context = PropertyComputeContext;
+	const Values& d = DefaultComputedValues;
+
+	PropertyComputeTable table;
+	auto Set = [&table](PropertyId id, PropertyComputeFunctions::Compute compute, PropertyComputeFunctions::Reset reset) {
+		table[size_t(id)].compute = compute;
+		table[size_t(id)].reset = reset;
+	};
+
+	// clang-format off
+	Set(PropertyId::MarginTop,    [](Values& v, const Property* p, const Context& c) { v.margin_top(ComputeLengthPercentageAuto(p, c)); },    [](Values& v) { v.margin_top(d.margin_top()); });
+	Set(PropertyId::MarginRight,  [](Values& v, const Property* p, const Context& c) { v.margin_right(ComputeLengthPercentageAuto(p, c)); },  [](Values& v) { v.margin_right(d.margin_right()); });
+	Set(PropertyId::MarginBottom, [](Values& v, const Property* p, const Context& c) { v.margin_bottom(ComputeLengthPercentageAuto(p, c)); }, [](Values& v) { v.margin_bottom(d.margin_bottom()); });
+	Set(PropertyId::MarginLeft,   [](Values& v, const Property* p, const Context& c) { v.margin_left(ComputeLengthPercentageAuto(p, c)); },   [](Values& v) { v.margin_left(d.margin_left()); });
+
+	Set(PropertyId::PaddingTop,    [](Values& v, const Property* p, const Context& c) { v.padding_top(ComputeLengthPercentage(p, c)); },    [](Values& v) { v.padding_top(d.padding_top()); });
+	Set(PropertyId::PaddingRight,  [](Values& v, const Property* p, const Context& c) { v.padding_right(ComputeLengthPercentage(p, c)); },  [](Values& v) { v.padding_right(d.padding_right()); });
+	Set(PropertyId::PaddingBottom, [](Values& v, const Property* p, const Context& c) { v.padding_bottom(ComputeLengthPercentage(p, c)); }, [](Values& v) { v.padding_bottom(d.padding_bottom()); });
+	Set(PropertyId::PaddingLeft,   [](Values& v, const Property* p, const Context& c) { v.padding_left(ComputeLengthPercentage(p, c)); },   [](Values& v) { v.padding_left(d.padding_left()); });
+
+	Set(PropertyId::BorderTopWidth,    [](Values& v, const Property* p, const Context& c) { v.border_top_width(ComputeBorderWidth(ComputeLength(p, c))); },    [](Values& v) { v.border_top_width((int16_t)d.border_top_width()); });
+	Set(PropertyId::BorderRightWidth,  [](Values& v, const Property* p, const Context& c) { v.border_right_width(ComputeBorderWidth(ComputeLength(p, c))); },  [](Values& v) { v.border_right_width((int16_t)d.border_right_width()); });
+	Set(PropertyId::BorderBottomWidth, [](Values& v, const Property* p, const Context& c) { v.border_bottom_width(ComputeBorderWidth(ComputeLength(p, c))); }, [](Values& v) { v.border_bottom_width((int16_t)d.border_bottom_width()); });
+	Set(PropertyId::BorderLeftWidth,   [](Values& v, const Property* p, const Context& c) { v.border_left_width(ComputeBorderWidth(ComputeLength(p, c))); },   [](Values& v) { v.border_left_width((int16_t)d.border_left_width()); });
+
+	Set(PropertyId::BorderTopColor,    [](Values& v, const Property* p, const Context&) { v.border_top_color(p->Get<Colourb>()); },    [](Values& v) { v.border_top_color(d.border_top_color()); });
+	Set(PropertyId::BorderRightColor,  [](Values& v, const Property* p, const Context&) { v.border_right_color(p->Get<Colourb>()); },  [](Values& v) { v.border_right_color(d.border_right_color()); });
+	Set(PropertyId::BorderBottomColor, [](Values& v, const Property* p, const Context&) { v.border_bottom_color(p->Get<Colourb>()); }, [](Values& v) { v.border_bottom_color(d.border_bottom_color()); });
+	Set(PropertyId::BorderLeftColor,   [](Values& v, const Property* p, const Context&) { v.border_left_color(p->Get<Colourb>()); },   [](Values& v) { v.border_left_color(d.border_left_color()); });
+
+	Set(PropertyId::BorderTopLeftRadius,     [](Values& v, const Property* p, const Context& c) { v.border_top_left_radius(ComputeLength(p, c)); },     [](Values& v) { v.border_top_left_radius(d.border_top_left_radius()); });
+	Set(PropertyId::BorderTopRightRadius,    [](Values& v, const Property* p, const Context& c) { v.border_top_right_radius(ComputeLength(p, c)); },    [](Values& v) { v.border_top_right_radius(d.border_top_right_radius()); });
+	Set(PropertyId::BorderBottomRightRadius, [](Values& v, const Property* p, const Context& c) { v.border_bottom_right_radius(ComputeLength(p, c)); }, [](Values& v) { v.border_bottom_right_radius(d.border_bottom_right_radius()); });
+	Set(PropertyId::BorderBottomLeftRadius,  [](Values& v, const Property* p, const Context& c) { v.border_bottom_left_radius(ComputeLength(p, c)); },  [](Values& v) { v.border_bottom_left_radius(d.border_bottom_left_radius()); });
+
+	Set(PropertyId::Display,  [](Values& v, const Property* p, const Context&) { v.display((Display)p->Get<int>()); },   [](Values& v) { v.display(d.display()); });
+	Set(PropertyId::Position, [](Values& v, const Property* p, const Context&) { v.position((Position)p->Get<int>()); }, [](Values& v) { v.position(d.position()); });
+
+	Set(PropertyId::Top,    [](Values& v, const Property* p, const Context& c) { v.top(ComputeLengthPercentageAuto(p, c)); },    [](Values& v) { v.top(d.top()); });
+	Set(PropertyId::Right,  [](Values& v, const Property* p, const Context& c) { v.right(ComputeLengthPercentageAuto(p, c)); },  [](Values& v) { v.right(d.right()); });
+	Set(PropertyId::Bottom, [](Values& v, const Property* p, const Context& c) { v.bottom(ComputeLengthPercentageAuto(p, c)); }, [](Values& v) { v.bottom(d.bottom()); });
+	Set(PropertyId::Left,   [](Values& v, const Property* p, const Context& c) { v.left(ComputeLengthPercentageAuto(p, c)); },   [](Values& v) { v.left(d.left()); });
+
+	Set(PropertyId::Float,     [](Values& v, const Property* p, const Context&) { v.float_((Float)p->Get<int>()); },         [](Values& v) { v.float_(d.float_()); });
+	Set(PropertyId::Clear,     [](Values& v, const Property* p, const Context&) { v.clear((Clear)p->Get<int>()); },          [](Values& v) { v.clear(d.clear()); });
+	Set(PropertyId::BoxSizing, [](Values& v, const Property* p, const Context&) { v.box_sizing((BoxSizing)p->Get<int>()); }, [](Values& v) { v.box_sizing(d.box_sizing()); });
+
+	Set(PropertyId::ZIndex, [](Values& v, const Property* p, const Context&) { v.z_index((p->unit == Property::KEYWORD ? ZIndex(ZIndex::Auto) : ZIndex(ZIndex::Number, p->Get<float>()))); },
+		[](Values& v) { v.z_index(d.z_index()); });
+
+	Set(PropertyId::Width,     [](Values& v, const Property* p, const Context& c) { v.width(ComputeLengthPercentageAuto(p, c)); }, [](Values& v) { v.width(d.width()); });
+	Set(PropertyId::MinWidth,  [](Values& v, const Property* p, const Context& c) { v.min_width(ComputeLengthPercentage(p, c)); }, [](Values& v) { v.min_width(d.min_width()); });
+	Set(PropertyId::MaxWidth,  [](Values& v, const Property* p, const Context& c) { v.max_width(ComputeMaxSize(p, c)); },          [](Values& v) { v.max_width(d.max_width()); });
+
+	Set(PropertyId::Height,    [](Values& v, const Property* p, const Context& c) { v.height(ComputeLengthPercentageAuto(p, c)); },  [](Values& v) { v.height(d.height()); });
+	Set(PropertyId::MinHeight, [](Values& v, const Property* p, const Context& c) { v.min_height(ComputeLengthPercentage(p, c)); }, [](Values& v) { v.min_height(d.min_height()); });
+	Set(PropertyId::MaxHeight, [](Values& v, const Property* p, const Context& c) { v.max_height(ComputeMaxSize(p, c)); },          [](Values& v) { v.max_height(d.max_height()); });
+
+	Set(PropertyId::VerticalAlign, [](Values& v, const Property* p, const Context& c) { v.vertical_align(ComputeVerticalAlign(p, c.line_height, c.font_size, c.document_font_size, c.dp_ratio, c.vp_dimensions)); },
+		[](Values& v) { v.vertical_align(d.vertical_align()); });
+
+	Set(PropertyId::OverflowX,  [](Values& v, const Property* p, const Context&) { v.overflow_x((Overflow)p->Get<int>()); },     [](Values& v) { v.overflow_x(d.overflow_x()); });
+	Set(PropertyId::OverflowY,  [](Values& v, const Property* p, const Context&) { v.overflow_y((Overflow)p->Get<int>()); },     [](Values& v) { v.overflow_y(d.overflow_y()); });
+	Set(PropertyId::Clip,       [](Values& v, const Property* p, const Context&) { v.clip(ComputeClip(p)); },                     [](Values& v) { v.clip(d.clip()); });
+	Set(PropertyId::Visibility, [](Values& v, const Property* p, const Context&) { v.visibility((Visibility)p->Get<int>()); },   [](Values& v) { v.visibility(d.visibility()); });
+
+	Set(PropertyId::BackgroundColor, [](Values& v, const Property* p, const Context&) { v.background_color(p->Get<Colourb>()); }, [](Values& v) { v.background_color(d.background_color()); });
+	Set(PropertyId::Color,           [](Values& v, const Property* p, const Context&) { v.color(p->Get<Colourb>()); },            nullptr);
+	Set(PropertyId::ImageColor,      [](Values& v, const Property* p, const Context&) { v.image_color(p->Get<Colourb>()); },      [](Values& v) { v.image_color(d.image_color()); });
+	Set(PropertyId::Opacity,         [](Values& v, const Property* p, const Context&) { v.opacity(p->Get<float>()); },            nullptr);
+
+	Set(PropertyId::FontStyle,  [](Values& v, const Property* p, const Context&) { v.font_style((FontStyle)p->Get<int>()); },   nullptr);
+	Set(PropertyId::FontWeight, [](Values& v, const Property* p, const Context&) { v.font_weight((FontWeight)p->Get<int>()); }, nullptr);
+
+	Set(PropertyId::TextAlign,      [](Values& v, const Property* p, const Context&) { v.text_align((TextAlign)p->Get<int>()); },           nullptr);
+	Set(PropertyId::TextDecoration, [](Values& v, const Property* p, const Context&) { v.text_decoration((TextDecoration)p->Get<int>()); }, nullptr);
+	Set(PropertyId::TextTransform,  [](Values& v, const Property* p, const Context&) { v.text_transform((TextTransform)p->Get<int>()); },   nullptr);
+	Set(PropertyId::WhiteSpace,     [](Values& v, const Property* p, const Context&) { v.white_space((WhiteSpace)p->Get<int>()); },         nullptr);
+	Set(PropertyId::WordBreak,      [](Values& v, const Property* p, const Context&) { v.word_break((WordBreak)p->Get<int>()); },           nullptr);
+
+	Set(PropertyId::RowGap,    [](Values& v, const Property* p, const Context& c) { v.row_gap(ComputeLengthPercentage(p, c)); },    [](Values& v) { v.row_gap(d.row_gap()); });
+	Set(PropertyId::ColumnGap, [](Values& v, const Property* p, const Context& c) { v.column_gap(ComputeLengthPercentage(p, c)); }, [](Values& v) { v.column_gap(d.column_gap()); });
+
+	Set(PropertyId::Drag,            [](Values& v, const Property* p, const Context&) { v.drag((Drag)p->Get<int>()); },                     [](Values& v) { v.drag(d.drag()); });
+	Set(PropertyId::TabIndex,        [](Values& v, const Property* p, const Context&) { v.tab_index((TabIndex)p->Get<int>()); },            [](Values& v) { v.tab_index(d.tab_index()); });
+	Set(PropertyId::Focus,           [](Values& v, const Property* p, const Context&) { v.focus((Focus)p->Get<int>()); },                   nullptr);
+	Set(PropertyId::ScrollbarMargin, [](Values& v, const Property* p, const Context& c) { v.scrollbar_margin(ComputeLength(p, c)); },       [](Values& v) { v.scrollbar_margin(d.scrollbar_margin()); });
+	Set(PropertyId::PointerEvents,   [](Values& v, const Property* p, const Context&) { v.pointer_events((PointerEvents)p->Get<int>()); }, nullptr);
+
+	Set(PropertyId::Perspective,        [](Values& v, const Property* p, const Context& c) { v.perspective(ComputeLength(p, c)); },          [](Values& v) { v.perspective(d.perspective()); });
+	Set(PropertyId::PerspectiveOriginX, [](Values& v, const Property* p, const Context& c) { v.perspective_origin_x(ComputeOrigin(p, c)); }, [](Values& v) { v.perspective_origin_x(d.perspective_origin_x()); });
+	Set(PropertyId::PerspectiveOriginY, [](Values& v, const Property* p, const Context& c) { v.perspective_origin_y(ComputeOrigin(p, c)); }, [](Values& v) { v.perspective_origin_y(d.perspective_origin_y()); });
+
+	Set(PropertyId::TransformOriginX, [](Values& v, const Property* p, const Context& c) { v.transform_origin_x(ComputeOrigin(p, c)); }, [](Values& v) { v.transform_origin_x(d.transform_origin_x()); });
+	Set(PropertyId::TransformOriginY, [](Values& v, const Property* p, const Context& c) { v.transform_origin_y(ComputeOrigin(p, c)); }, [](Values& v) { v.transform_origin_y(d.transform_origin_y()); });
+	Set(PropertyId::TransformOriginZ, [](Values& v, const Property* p, const Context& c) { v.transform_origin_z(ComputeLength(p, c)); }, [](Values& v) { v.transform_origin_z(d.transform_origin_z()); });
+
+	Set(PropertyId::Decorator,  [](Values& v, const Property* p, const Context&) { v.has_decorator(p->unit == Property::DECORATOR); },     [](Values& v) { v.has_decorator(d.has_decorator()); });
+	Set(PropertyId::FontEffect, [](Values& v, const Property* p, const Context&) { v.has_font_effect(p->unit == Property::FONTEFFECT); }, nullptr);
+	Set(PropertyId::FlexBasis,  [](Values& v, const Property* p, const Context& c) { v.flex_basis(ComputeLengthPercentageAuto(p, c)); },  [](Values& v) { v.flex_basis(d.flex_basis()); });
+	// clang-format on
+
+	// The remaining properties are either computed separately (font-size, line-height), fetched from the element's properties when needed
+	// (font-family, cursor, transform, animations, flexbox alignment, etc.), or must be retrieved manually (fill-image, caret-color).
+
+	return table;
+}
+
+const PropertyComputeFunctions& GetPropertyComputeFunctions(PropertyId id)
+{
+	static const PropertyComputeTable table = BuildPropertyComputeTable();
+	static const PropertyComputeFunctions no_functions;
+
+	if (size_t(id) >= table.size())
+		return no_functions;
+	return table[size_t(id)];
+}
+
 } // namespace Rml
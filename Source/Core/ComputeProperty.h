@@ -29,6 +29,7 @@
 #ifndef RMLUI_CORE_COMPUTEPROPERTY_H
 #define RMLUI_CORE_COMPUTEPROPERTY_H
 
+#include "../../Include/RmlUi/Core/ID.h"
 #include "../../Include/RmlUi/Core/StyleTypes.h"
 
 namespace Rml {
@@ -64,5 +65,27 @@ uint16_t ComputeBorderWidth(float computed_length);
 
 extern const Style::ComputedValues DefaultComputedValues;
 
+// The inputs that properties are computed from, besides the property values themselves.
+struct PropertyComputeContext {
+	float font_size;
+	float document_font_size;
+	float dp_ratio;
+	Vector2f vp_dimensions;
+	float line_height;
+};
+
+// Functions to compute a property into the computed values, and to reset a non-inherited property to its default computed value.
+struct PropertyComputeFunctions {
+	using Compute = void (*)(Style::ComputedValues& values, const Property* property, const PropertyComputeContext& context);
+	using Reset = void (*)(Style::ComputedValues& values);
+
+	Compute compute = nullptr;
+	Reset reset = nullptr;
+};
+
+// Returns the compute functions of the given property. The functions are null for properties without a computed value, and for
+// properties which are computed separately such as the font size and line height. The reset function is null for inherited properties.
+const PropertyComputeFunctions& GetPropertyComputeFunctions(PropertyId id);
+
 } // namespace Rml
 #endif
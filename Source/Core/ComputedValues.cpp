@@ -28,10 +28,230 @@
 
 #include "../../Include/RmlUi/Core/ComputedValues.h"
 #include "../../Include/RmlUi/Core/Element.h"
+#include "../../Include/RmlUi/Core/Utilities.h"
 #include "ComputeProperty.h"
+#include "Pool.h"
 
 namespace Rml {
 
+namespace Style {
+
+// clang-format off
+bool CommonValues::operator==(const CommonValues& o) const
+{
+	return display == o.display && position == o.position && float_ == o.float_ && clear == o.clear && overflow_x == o.overflow_x &&
+		overflow_y == o.overflow_y && visibility == o.visibility && has_decorator == o.has_decorator && box_sizing == o.box_sizing &&
+		width_type == o.width_type && height_type == o.height_type && margin_top_type == o.margin_top_type &&
+		margin_right_type == o.margin_right_type && margin_bottom_type == o.margin_bottom_type && margin_left_type == o.margin_left_type &&
+		padding_top_type == o.padding_top_type && padding_right_type == o.padding_right_type && padding_bottom_type == o.padding_bottom_type &&
+		padding_left_type == o.padding_left_type && top_type == o.top_type && right_type == o.right_type && bottom_type == o.bottom_type &&
+		left_type == o.left_type && z_index_type == o.z_index_type && width_value == o.width_value && height_value == o.height_value &&
+		margin_top_value == o.margin_top_value && margin_right_value == o.margin_right_value && margin_bottom_value == o.margin_bottom_value &&
+		margin_left_value == o.margin_left_value && padding_top_value == o.padding_top_value && padding_right_value == o.padding_right_value &&
+		padding_bottom_value == o.padding_bottom_value && padding_left_value == o.padding_left_value && top_value == o.top_value &&
+		right_value == o.right_value && bottom_value == o.bottom_value && left_value == o.left_value && z_index_value == o.z_index_value &&
+		border_top_width == o.border_top_width && border_right_width == o.border_right_width && border_bottom_width == o.border_bottom_width &&
+		border_left_width == o.border_left_width && border_top_color == o.border_top_color && border_right_color == o.border_right_color &&
+		border_bottom_color == o.border_bottom_color && border_left_color == o.border_left_color && background_color == o.background_color;
+}
+
+bool InheritedValues::operator==(const InheritedValues& o) const
+{
+	return font_face_handle == o.font_face_handle && font_size == o.font_size && opacity == o.opacity && color == o.color &&
+		font_weight == o.font_weight && font_style == o.font_style && has_font_effect == o.has_font_effect && pointer_events == o.pointer_events &&
+		focus == o.focus && text_align == o.text_align && text_decoration == o.text_decoration && text_transform == o.text_transform &&
+		white_space == o.white_space && word_break == o.word_break && line_height_inherit_type == o.line_height_inherit_type &&
+		line_height == o.line_height && line_height_inherit == o.line_height_inherit;
+}
+
+bool RareValues::operator==(const RareValues& o) const
+{
+	return min_width_type == o.min_width_type && max_width_type == o.max_width_type && min_height_type == o.min_height_type &&
+		max_height_type == o.max_height_type && perspective_origin_x_type == o.perspective_origin_x_type &&
+		perspective_origin_y_type == o.perspective_origin_y_type && transform_origin_x_type == o.transform_origin_x_type &&
+		transform_origin_y_type == o.transform_origin_y_type && flex_basis_type == o.flex_basis_type && row_gap_type == o.row_gap_type &&
+		column_gap_type == o.column_gap_type && vertical_align_type == o.vertical_align_type && drag == o.drag && tab_index == o.tab_index &&
+		clip.GetType() == o.clip.GetType() && clip.GetNumber() == o.clip.GetNumber() && min_width == o.min_width && max_width == o.max_width &&
+		min_height == o.min_height && max_height == o.max_height && vertical_align_length == o.vertical_align_length &&
+		perspective == o.perspective && perspective_origin_x == o.perspective_origin_x && perspective_origin_y == o.perspective_origin_y &&
+		transform_origin_x == o.transform_origin_x && transform_origin_y == o.transform_origin_y && transform_origin_z == o.transform_origin_z &&
+		flex_basis == o.flex_basis && row_gap == o.row_gap && column_gap == o.column_gap && border_top_left_radius == o.border_top_left_radius &&
+		border_top_right_radius == o.border_top_right_radius && border_bottom_right_radius == o.border_bottom_right_radius &&
+		border_bottom_left_radius == o.border_bottom_left_radius && image_color == o.image_color && scrollbar_margin == o.scrollbar_margin;
+}
+// clang-format on
+
+// Only a selection of the values is hashed, the values which most often differ between elements. Groups with equal hashes are told apart by
+// comparing all their values.
+static size_t HashValues(const CommonValues& values)
+{
+	size_t seed = 0;
+	Utilities::HashCombine(seed, int(values.display) | int(values.position) << 4 | int(values.float_) << 6 | int(values.overflow_x) << 8 |
+			int(values.overflow_y) << 10 | int(values.width_type) << 12 | int(values.height_type) << 14);
+	Utilities::HashCombine(seed, values.width_value);
+	Utilities::HashCombine(seed, values.height_value);
+	Utilities::HashCombine(seed, values.margin_top_value);
+	Utilities::HashCombine(seed, values.margin_left_value);
+	Utilities::HashCombine(seed, values.padding_top_value);
+	Utilities::HashCombine(seed, values.padding_left_value);
+	Utilities::HashCombine(seed, values.top_value);
+	Utilities::HashCombine(seed, values.left_value);
+	Utilities::HashCombine(seed, int(values.border_top_width) | int(values.border_left_width) << 16);
+	Utilities::HashCombine(seed, values.background_color.red | values.background_color.green << 8 | values.background_color.blue << 16 |
+			uint32_t(values.background_color.alpha) << 24);
+	return seed;
+}
+
+static size_t HashValues(const InheritedValues& values)
+{
+	size_t seed = 0;
+	Utilities::HashCombine(seed, values.font_face_handle);
+	Utilities::HashCombine(seed, values.font_size);
+	Utilities::HashCombine(seed, values.line_height);
+	Utilities::HashCombine(seed, values.opacity);
+	Utilities::HashCombine(seed, values.color.red | values.color.green << 8 | values.color.blue << 16 | uint32_t(values.color.alpha) << 24);
+	Utilities::HashCombine(seed, int(values.text_align) | int(values.white_space) << 2 | int(values.pointer_events) << 5);
+	return seed;
+}
+
+static size_t HashValues(const RareValues& values)
+{
+	size_t seed = 0;
+	Utilities::HashCombine(seed, values.min_width);
+	Utilities::HashCombine(seed, values.max_width);
+	Utilities::HashCombine(seed, values.min_height);
+	Utilities::HashCombine(seed, values.max_height);
+	Utilities::HashCombine(seed, values.vertical_align_length);
+	Utilities::HashCombine(seed, values.flex_basis);
+	Utilities::HashCombine(seed, values.border_top_left_radius);
+	Utilities::HashCombine(seed, int(values.vertical_align_type) | int(values.drag) << 4 | int(values.tab_index) << 7);
+	return seed;
+}
+
+// Keeps track of the shared groups, keyed by the hash of their values.
+template <typename T>
+class ValuesGroupPool : NonCopyMoveable {
+public:
+	ValuesGroupPool() : allocator(256, true)
+	{
+		default_group = allocator.AllocateAndConstruct();
+		Share(default_group);
+	}
+	~ValuesGroupPool()
+	{
+		for (auto& pair : groups)
+			allocator.DestroyAndDeallocate(pair.second);
+	}
+
+	ValuesGroup<T>* GetDefault() const { return default_group; }
+
+	// Returns the shared group of identical values, or shares the given group if there is none.
+	ValuesGroup<T>* Share(ValuesGroup<T>* group)
+	{
+		RMLUI_ASSERT(!group->shared);
+		group->hash = HashValues(*group);
+
+		auto range = groups.equal_range(group->hash);
+		for (auto it = range.first; it != range.second; ++it)
+		{
+			ValuesGroup<T>* shared_group = it->second;
+			if (static_cast<const T&>(*shared_group) == static_cast<const T&>(*group))
+			{
+				shared_group->num_references += 1;
+				Release(group);
+				return shared_group;
+			}
+		}
+
+		group->shared = true;
+		groups.emplace(group->hash, group);
+		return group;
+	}
+
+	// Returns a private copy of the group, the group itself is made private if it is not referred to from elsewhere.
+	ValuesGroup<T>* Detach(ValuesGroup<T>* group)
+	{
+		if (group->num_references == 1)
+		{
+			RMLUI_ASSERT(group->shared);
+			Remove(group);
+			group->shared = false;
+			return group;
+		}
+
+		ValuesGroup<T>* result = allocator.AllocateAndConstruct(static_cast<const T&>(*group));
+		Release(group);
+		return result;
+	}
+
+	void Release(ValuesGroup<T>* group)
+	{
+		RMLUI_ASSERT(group->num_references > 0);
+		group->num_references -= 1;
+		if (group->num_references == 0)
+		{
+			if (group->shared)
+				Remove(group);
+			allocator.DestroyAndDeallocate(group);
+		}
+	}
+
+	static ValuesGroupPool& Get()
+	{
+		static ValuesGroupPool pool;
+		return pool;
+	}
+
+private:
+	void Remove(ValuesGroup<T>* group)
+	{
+		auto range = groups.equal_range(group->hash);
+		for (auto it = range.first; it != range.second; ++it)
+		{
+			if (it->second == group)
+			{
+				groups.erase(it);
+				return;
+			}
+		}
+		RMLUI_ERROR;
+	}
+
+	Pool<ValuesGroup<T>> allocator;
+
+	// The default group holds an additional reference for the lifetime of the pool.
+	ValuesGroup<T>* default_group;
+
+	UnorderedMultimap<size_t, ValuesGroup<T>*> groups;
+};
+
+template <typename T>
+static void InitializeValuesGroupImpl(ValuesGroup<T>*& group)
+{
+	group = ValuesGroupPool<T>::Get().GetDefault();
+	group->num_references += 1;
+}
+
+// clang-format off
+void InitializeValuesGroup(ValuesGroup<CommonValues>*& group)    { InitializeValuesGroupImpl(group); }
+void InitializeValuesGroup(ValuesGroup<InheritedValues>*& group) { InitializeValuesGroupImpl(group); }
+void InitializeValuesGroup(ValuesGroup<RareValues>*& group)      { InitializeValuesGroupImpl(group); }
+
+void DetachValuesGroup(ValuesGroup<CommonValues>*& group)    { group = ValuesGroupPool<CommonValues>::Get().Detach(group); }
+void DetachValuesGroup(ValuesGroup<InheritedValues>*& group) { group = ValuesGroupPool<InheritedValues>::Get().Detach(group); }
+void DetachValuesGroup(ValuesGroup<RareValues>*& group)      { group = ValuesGroupPool<RareValues>::Get().Detach(group); }
+
+void ShareValuesGroup(ValuesGroup<CommonValues>*& group)    { group = ValuesGroupPool<CommonValues>::Get().Share(group); }
+void ShareValuesGroup(ValuesGroup<InheritedValues>*& group) { group = ValuesGroupPool<InheritedValues>::Get().Share(group); }
+void ShareValuesGroup(ValuesGroup<RareValues>*& group)      { group = ValuesGroupPool<RareValues>::Get().Share(group); }
+
+void ReleaseValuesGroup(ValuesGroup<CommonValues>* group)    { ValuesGroupPool<CommonValues>::Get().Release(group); }
+void ReleaseValuesGroup(ValuesGroup<InheritedValues>* group) { ValuesGroupPool<InheritedValues>::Get().Release(group); }
+void ReleaseValuesGroup(ValuesGroup<RareValues>* group)      { ValuesGroupPool<RareValues>::Get().Release(group); }
+// clang-format on
+
+} // namespace Style
+
 const AnimationList* Style::ComputedValues::animation() const
 {
 	if (auto p = element->GetLocalProperty(PropertyId::Animation))
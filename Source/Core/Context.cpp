@@ -42,6 +42,7 @@
 #include "DataModel.h"
 #include "EventDispatcher.h"
 #include "PluginRegistry.h"
+#include "RenderBatcher.h"
 #include "StreamFile.h"
 #include <algorithm>
 #include <iterator>
@@ -222,6 +223,10 @@ bool Context::Render()
 		return false;
 
 	render_interface->context = this;
+
+	if (render_batcher)
+		render_batcher->BeginFrame(dimensions);
+
 	ElementUtilities::ApplyActiveClipRegion(this, render_interface);
 
 	root->Render();
@@ -238,6 +243,27 @@ bool Context::Render()
 		cursor_proxy->Render();
 	}
 
+	damaged_regions.clear();
+
+	if (render_batcher)
+	{
+		RMLUI_ZoneScopedN("RenderCommands");
+		const RenderCommandList& command_list = render_batcher->EndFrame();
+
+		if (command_list.damage_tracking)
+			damaged_regions = command_list.damaged_regions;
+		else
+			damaged_regions.push_back(RenderRegion{Vector2i(0), dimensions});
+
+		// Without any damage the frame is identical to the previous one, thus there is no need to submit it.
+		if (!damaged_regions.empty())
+			render_interface->RenderCommands(command_list);
+	}
+	else
+	{
+		damaged_regions.push_back(RenderRegion{Vector2i(0), dimensions});
+	}
+
 	render_interface->context = nullptr;
 
 	return true;
@@ -840,6 +866,45 @@ RenderInterface* Context::GetRenderInterface() const
 	return render_interface;
 }
 	
+void Context::EnableRenderBatching(bool enable)
+{
+	RMLUI_ASSERTMSG(!render_batcher || !render_batcher->IsRecording(), "Render batching cannot be toggled during rendering.");
+
+	if (enable && !render_batcher)
+	{
+		render_batcher = MakeUnique<RenderBatcher>();
+		render_batcher->EnableDamageTracking(damage_tracking);
+	}
+	else if (!enable)
+	{
+		render_batcher.reset();
+	}
+}
+
+bool Context::IsRenderBatchingEnabled() const
+{
+	return render_batcher != nullptr;
+}
+
+void Context::EnableDamageTracking(bool enable)
+{
+	RMLUI_ASSERTMSG(!render_batcher || !render_batcher->IsRecording(), "Damage tracking cannot be toggled during rendering.");
+
+	damage_tracking = enable;
+	if (render_batcher)
+		render_batcher->EnableDamageTracking(enable);
+}
+
+bool Context::IsDamageTrackingEnabled() const
+{
+	return damage_tracking;
+}
+
+const Vector<RenderRegion>& Context::GetDamagedRegions() const
+{
+	return damaged_regions;
+}
+
 // Gets the current clipping region for the render traversal
 bool Context::GetActiveClipRegion(Vector2i& origin, Vector2i& dimensions) const
 {
@@ -1329,6 +1394,13 @@ void Context::GenerateDragEventParameters(Dictionary& parameters)
 	parameters["drag_element"] = (void*)drag;
 }
 
+RenderBatcher* Context::GetActiveRenderBatcher() const
+{
+	if (render_batcher && render_batcher->IsRecording())
+		return render_batcher.get();
+	return nullptr;
+}
+
 // Releases all unloaded documents pending destruction.
 void Context::ReleaseUnloadedDocuments()
 {
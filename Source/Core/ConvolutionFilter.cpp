@@ -28,11 +28,98 @@
 
 #include "../../Include/RmlUi/Core/ConvolutionFilter.h"
 #include "../../Include/RmlUi/Core/Profiling.h"
+#include "Memory.h"
 #include <float.h>
 #include <string.h>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define RMLUI_CONVOLUTION_SSE2
+	#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+	#define RMLUI_CONVOLUTION_NEON
+	#include <arm_neon.h>
+#endif
+
 namespace Rml {
 
+namespace {
+
+	// A non-zero kernel value, with its offset into the padded source buffer.
+	struct KernelTap {
+		int offset;
+		float weight;
+	};
+
+	// Number of destination pixels processed together along each row.
+	constexpr int PixelBlockSize = 4;
+
+	template <FilterOperation operation>
+	inline float ApplyOperation(float opacity, float pixel_opacity)
+	{
+		return operation == FilterOperation::Sum ? opacity + pixel_opacity : Math::Max(opacity, pixel_opacity);
+	}
+
+	// Filters a block of destination pixels, writing the resulting opacities to 'result'. Values are clamped to [0, 255].
+	template <FilterOperation operation>
+	inline void FilterPixelBlock(int result[PixelBlockSize], const float* source, const KernelTap* taps, const int num_taps)
+	{
+#if defined(RMLUI_CONVOLUTION_SSE2)
+		__m128 opacity = _mm_setzero_ps();
+		for (int i = 0; i < num_taps; i++)
+		{
+			const __m128 pixel_opacity = _mm_mul_ps(_mm_loadu_ps(source + taps[i].offset), _mm_set1_ps(taps[i].weight));
+			opacity = (operation == FilterOperation::Sum ? _mm_add_ps(opacity, pixel_opacity) : _mm_max_ps(opacity, pixel_opacity));
+		}
+		opacity = _mm_min_ps(_mm_max_ps(opacity, _mm_setzero_ps()), _mm_set1_ps(255.f));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(result), _mm_cvttps_epi32(opacity));
+#elif defined(RMLUI_CONVOLUTION_NEON)
+		float32x4_t opacity = vdupq_n_f32(0.f);
+		for (int i = 0; i < num_taps; i++)
+		{
+			const float32x4_t pixel_opacity = vmulq_f32(vld1q_f32(source + taps[i].offset), vdupq_n_f32(taps[i].weight));
+			opacity = (operation == FilterOperation::Sum ? vaddq_f32(opacity, pixel_opacity) : vmaxq_f32(opacity, pixel_opacity));
+		}
+		opacity = vminq_f32(vmaxq_f32(opacity, vdupq_n_f32(0.f)), vdupq_n_f32(255.f));
+		vst1q_s32(result, vcvtq_s32_f32(opacity));
+#else
+		float opacity[PixelBlockSize] = {};
+		for (int i = 0; i < num_taps; i++)
+		{
+			const float* tap_source = source + taps[i].offset;
+			const float weight = taps[i].weight;
+			for (int j = 0; j < PixelBlockSize; j++)
+				opacity[j] = ApplyOperation<operation>(opacity[j], tap_source[j] * weight);
+		}
+		for (int j = 0; j < PixelBlockSize; j++)
+			result[j] = int(Math::Clamp(opacity[j], 0.f, 255.f));
+#endif
+	}
+
+	template <FilterOperation operation>
+	void FilterRows(byte* destination, const Vector2i destination_dimensions, const int destination_stride, const int destination_bytes_per_pixel,
+		const float* source, const int source_stride, const KernelTap* taps, const int num_taps)
+	{
+		int result[PixelBlockSize];
+
+		for (int y = 0; y < destination_dimensions.y; ++y)
+		{
+			const float* source_row = source + y * source_stride;
+
+			for (int x = 0; x < destination_dimensions.x; x += PixelBlockSize)
+			{
+				FilterPixelBlock<operation>(result, source_row + x, taps, num_taps);
+
+				const int num_pixels = Math::Min(PixelBlockSize, destination_dimensions.x - x);
+				for (int j = 0; j < num_pixels; j++)
+					destination[(x + j) * destination_bytes_per_pixel] = byte(result[j]);
+			}
+
+			destination += destination_stride;
+		}
+	}
+
+} // namespace
+
 ConvolutionFilter::ConvolutionFilter()
 {}
 
@@ -82,41 +169,62 @@ void ConvolutionFilter::Run(byte* destination, const Vector2i destination_dimens
 
 	const Vector2i kernel_radius = (kernel_size - Vector2i(1)) / 2;
 
-	for (int y = 0; y < destination_dimensions.y; ++y)
+	if (destination_dimensions.x <= 0 || destination_dimensions.y <= 0)
+		return;
+
+	// Copy the source opacities to a zero-padded float buffer covering every pixel read by the kernel. This removes all bounds checking from
+	// the inner loops, and lets us process multiple adjacent destination pixels at once. The padded area counts as fully transparent, which
+	// is equivalent to skipping pixels outside the source region for both operations.
+	const int padded_dimensions_x = ((destination_dimensions.x + PixelBlockSize - 1) / PixelBlockSize) * PixelBlockSize;
+	const Vector2i padded_origin = -source_offset - kernel_radius;
+	const Vector2i padded_dimensions = Vector2i(padded_dimensions_x, destination_dimensions.y) + kernel_size - Vector2i(1);
+	const int padded_size = padded_dimensions.x * padded_dimensions.y;
+
+	DynamicArray<float, GlobalStackAllocator<float>> padded_source(padded_size);
+	float* padded = padded_source.data();
+	memset(padded, 0, padded_size * sizeof(float));
+
+	const int copy_begin_x = Math::Max(0, padded_origin.x);
+	const int copy_end_x = Math::Min(source_dimensions.x, padded_origin.x + padded_dimensions.x);
+	const int copy_begin_y = Math::Max(0, padded_origin.y);
+	const int copy_end_y = Math::Min(source_dimensions.y, padded_origin.y + padded_dimensions.y);
+
+	for (int source_y = copy_begin_y; source_y < copy_end_y; ++source_y)
 	{
-		for (int x = 0; x < destination_dimensions.x; ++x)
-		{
-			float opacity = 0.f;
+		const byte* source_row = source + (source_y * source_dimensions.x) * source_bytes_per_pixel + source_alpha_offset;
+		float* padded_row = padded + (source_y - padded_origin.y) * padded_dimensions.x - padded_origin.x;
 
-			for (int kernel_y = 0; kernel_y < kernel_size.y; ++kernel_y)
-			{
-				const int source_y = y - source_offset.y - kernel_radius.y + kernel_y;
-
-				for (int kernel_x = 0; kernel_x < kernel_size.x; ++kernel_x)
-				{
-					const int source_x = x - source_offset.x - kernel_radius.x + kernel_x;
-					if (source_y >= 0 && source_y < source_dimensions.y &&
-						source_x >= 0 && source_x < source_dimensions.x)
-					{
-						const int source_index = (source_y * source_dimensions.x + source_x) * source_bytes_per_pixel + source_alpha_offset;
-						const float pixel_opacity = float(source[source_index]) * kernel[kernel_y * kernel_size.x + kernel_x];
-
-						switch (operation)
-						{
-						case FilterOperation::Sum: opacity += pixel_opacity; break;
-						case FilterOperation::Dilation: opacity = Math::Max(opacity, pixel_opacity); break;
-						}
-					}
-				}
-			}
+		for (int source_x = copy_begin_x; source_x < copy_end_x; ++source_x)
+			padded_row[source_x] = float(source_row[source_x * source_bytes_per_pixel]);
+	}
 
-			opacity = Math::Min(255.f, opacity);
+	// Gather the non-zero kernel values, these are the only ones which can contribute to the result. Values are visited in the same order
+	// as they are stored in the kernel, so that sums are accumulated consistently.
+	DynamicArray<KernelTap, GlobalStackAllocator<KernelTap>> kernel_taps(kernel_size.x * kernel_size.y);
+	int num_taps = 0;
 
-			const int destination_index = x * destination_bytes_per_pixel + destination_alpha_offset;
-			destination[destination_index] = byte(opacity);
+	for (int kernel_y = 0; kernel_y < kernel_size.y; ++kernel_y)
+	{
+		for (int kernel_x = 0; kernel_x < kernel_size.x; ++kernel_x)
+		{
+			const float weight = kernel[kernel_y * kernel_size.x + kernel_x];
+			if (weight != 0.f)
+				kernel_taps[num_taps++] = KernelTap{kernel_y * padded_dimensions.x + kernel_x, weight};
 		}
+	}
 
-		destination += destination_stride;
+	destination += destination_alpha_offset;
+
+	switch (operation)
+	{
+	case FilterOperation::Sum:
+		FilterRows<FilterOperation::Sum>(destination, destination_dimensions, destination_stride, destination_bytes_per_pixel, padded,
+			padded_dimensions.x, kernel_taps.data(), num_taps);
+		break;
+	case FilterOperation::Dilation:
+		FilterRows<FilterOperation::Dilation>(destination, destination_dimensions, destination_stride, destination_bytes_per_pixel, padded,
+			padded_dimensions.x, kernel_taps.data(), num_taps);
+		break;
 	}
 }
 
@@ -38,6 +38,7 @@
 #include "../../Include/RmlUi/Core/StyleSheetSpecification.h"
 #include "../../Include/RmlUi/Core/Types.h"
 
+#include "Atom.h"
 #include "EventSpecification.h"
 #include "FileInterfaceDefault.h"
 #include "GeometryDatabase.h"
@@ -50,6 +51,9 @@
 
 #ifndef RMLUI_NO_FONT_INTERFACE_DEFAULT
 #include "FontEngineDefault/FontEngineInterfaceDefault.h"
+#include "FontEngineDefault/FontFaceDistanceField.h"
+#include "FontEngineDefault/FontProvider.h"
+#include "FontEngineDefault/FontWorker.h"
 #endif
 
 #ifdef RMLUI_ENABLE_LOTTIE_PLUGIN
@@ -169,6 +173,7 @@ void Shutdown()
 	StyleSheetFactory::Shutdown();
 	StyleSheetParser::Shutdown();
 	StyleSheetSpecification::Shutdown();
+	AtomTable::Clear();
 
 	font_interface = nullptr;
 	default_font_interface.reset();
@@ -403,4 +408,40 @@ void ReleaseFontResources()
 	}
 }
 
+void SetFontEngineWorkerThreads(int num_threads)
+{
+#ifndef RMLUI_NO_FONT_INTERFACE_DEFAULT
+	FontWorker::SetNumThreads(num_threads);
+#else
+	RMLUI_UNUSED(num_threads);
+#endif
+}
+
+void SetFontEngineDistanceFieldRendering(bool enable)
+{
+#ifndef RMLUI_NO_FONT_INTERFACE_DEFAULT
+	FontFaceDistanceField::SetEnabled(enable);
+#else
+	RMLUI_UNUSED(enable);
+#endif
+}
+
+void SetFontEngineMemoryBudget(size_t budget)
+{
+#ifndef RMLUI_NO_FONT_INTERFACE_DEFAULT
+	FontProvider::SetMemoryBudget(budget);
+#else
+	RMLUI_UNUSED(budget);
+#endif
+}
+
+Vector<FontFaceMemoryUsage> GetFontEngineMemoryUsage()
+{
+	Vector<FontFaceMemoryUsage> result;
+#ifndef RMLUI_NO_FONT_INTERFACE_DEFAULT
+	FontProvider::GetMemoryUsage(result);
+#endif
+	return result;
+}
+
 } // namespace Rml
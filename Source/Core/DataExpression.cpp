@@ -28,6 +28,7 @@
 
 #include "DataExpression.h"
 #include "../../Include/RmlUi/Core/DataModelHandle.h"
+#include "../../Include/RmlUi/Core/DataVariable.h"
 #include "../../Include/RmlUi/Core/Event.h"
 #include "../../Include/RmlUi/Core/Variant.h"
 #include "DataModel.h"
@@ -66,6 +67,7 @@ enum class Instruction {
 	                        // Assignment (register/stack) = Read (register R/L/C, instruction data D, or stack)
 	Push         = 'P',     //      S+ = R
 	Pop          = 'o',     // <R/L/C> = S-  (D determines R/L/C)
+	Move         = 'M',     //   <L/C> = R   (D determines L/C, R is cleared afterwards)
 	Literal      = 'D',     //       R = D
 	Variable     = 'V',     //       R = DataModel.GetVariable(D)  (D is an index into the variable address list)
 	Add          = '+',     //       R = L + R
@@ -775,10 +777,27 @@ static String DumpProgram(const Program& program)
 	return str;
 }
 
+// Typed fast paths for the most common operand types, avoiding the generic Variant conversions.
+static inline double ToNumber(const Variant& variant)
+{
+	switch (variant.GetType())
+	{
+	case Variant::DOUBLE: return variant.GetReference<double>();
+	case Variant::FLOAT:  return double(variant.GetReference<float>());
+	case Variant::INT:    return double(variant.GetReference<int>());
+	default: break;
+	}
+	return variant.Get<double>();
+}
+static inline bool ToBool(const Variant& variant)
+{
+	return variant.GetType() == Variant::BOOL ? variant.GetReference<bool>() : variant.Get<bool>();
+}
+
 class DataInterpreter {
 public:
-	DataInterpreter(const Program& program, const AddressList& addresses, DataExpressionInterface expression_interface)
-		: program(program), addresses(addresses), expression_interface(expression_interface) {}
+	DataInterpreter(const Program& program, const AddressList& addresses, const VariableList& variables, DataExpressionInterface expression_interface)
+		: program(program), addresses(addresses), variables(variables), expression_interface(expression_interface) {}
 
 	bool Error(const String& message) const
 	{
@@ -823,6 +842,7 @@ private:
 
 	const Program& program;
 	const AddressList& addresses;
+	const VariableList& variables;
 	DataExpressionInterface expression_interface;
 
 	bool Execute(const Instruction instruction, const Variant& data)
@@ -854,6 +874,19 @@ private:
 			}
 		}
 		break;
+		case Instruction::Move:
+		{
+			Register reg = Register(data.Get<int>(-1));
+			switch (reg) {
+			case Register::L:  L = std::move(R); break;
+			case Register::C:  C = std::move(R); break;
+			case Register::R:
+			default:
+				return Error(CreateString(50, "Invalid register %d.", int(reg)));
+			}
+			R.Clear();
+		}
+		break;
 		case Instruction::Literal:
 		{
 			R = data;
@@ -862,7 +895,13 @@ private:
 		case Instruction::Variable:
 		{
 			size_t variable_index = size_t(data.Get<int>(-1));
-			if (variable_index < addresses.size())
+			if (variable_index < variables.size() && variables[variable_index])
+			{
+				DataVariable variable = variables[variable_index];
+				R.Clear();
+				variable.Get(R);
+			}
+			else if (variable_index < addresses.size())
 				R = expression_interface.GetValue(addresses[variable_index]);
 			else
 				return Error("Variable address not found.");
@@ -871,41 +910,41 @@ private:
 		case Instruction::Add:
 		{
 			if (AnyString(L, R))
-				R = Variant(L.Get<String>() + R.Get<String>());
+				R = L.Get<String>() + R.Get<String>();
 			else
-				R = Variant(L.Get<double>() + R.Get<double>());
+				R = ToNumber(L) + ToNumber(R);
 		}
 		break;
-		case Instruction::Subtract:  R = Variant(L.Get<double>() - R.Get<double>());  break;
-		case Instruction::Multiply:  R = Variant(L.Get<double>() * R.Get<double>());  break;
-		case Instruction::Divide:    R = Variant(L.Get<double>() / R.Get<double>());  break;
-		case Instruction::Not:       R = Variant(!R.Get<bool>());                     break;
-		case Instruction::And:       R = Variant(L.Get<bool>() && R.Get<bool>());     break;
-		case Instruction::Or:        R = Variant(L.Get<bool>() || R.Get<bool>());     break;
-		case Instruction::Less:      R = Variant(L.Get<double>() < R.Get<double>());  break;
-		case Instruction::LessEq:    R = Variant(L.Get<double>() <= R.Get<double>()); break;
-		case Instruction::Greater:   R = Variant(L.Get<double>() > R.Get<double>());  break;
-		case Instruction::GreaterEq: R = Variant(L.Get<double>() >= R.Get<double>()); break;
+		case Instruction::Subtract:  R = ToNumber(L) - ToNumber(R);  break;
+		case Instruction::Multiply:  R = ToNumber(L) * ToNumber(R);  break;
+		case Instruction::Divide:    R = ToNumber(L) / ToNumber(R);  break;
+		case Instruction::Not:       R = !ToBool(R);                 break;
+		case Instruction::And:       R = ToBool(L) && ToBool(R);     break;
+		case Instruction::Or:        R = ToBool(L) || ToBool(R);     break;
+		case Instruction::Less:      R = ToNumber(L) < ToNumber(R);  break;
+		case Instruction::LessEq:    R = ToNumber(L) <= ToNumber(R); break;
+		case Instruction::Greater:   R = ToNumber(L) > ToNumber(R);  break;
+		case Instruction::GreaterEq: R = ToNumber(L) >= ToNumber(R); break;
 		case Instruction::Equal:
 		{
 			if (AnyString(L, R))
-				R = Variant(L.Get<String>() == R.Get<String>());
+				R = L.Get<String>() == R.Get<String>();
 			else
-				R = Variant(L.Get<double>() == R.Get<double>());
+				R = ToNumber(L) == ToNumber(R);
 		}
 		break;
 		case Instruction::NotEqual:
 		{
 			if (AnyString(L, R))
-				R = Variant(L.Get<String>() != R.Get<String>());
+				R = L.Get<String>() != R.Get<String>();
 			else
-				R = Variant(L.Get<double>() != R.Get<double>());
+				R = ToNumber(L) != ToNumber(R);
 		}
 		break;
 		case Instruction::Ternary:
 		{
-			if (L.Get<bool>())
-				R = C;
+			if (ToBool(L))
+				R = std::move(C);
 		}
 		break;
 		case Instruction::NumArguments:
@@ -974,6 +1013,132 @@ private:
 };
 
 
+
+// Returns true if the instruction at 'index' matches the given instruction, and register for register-based instructions.
+static bool IsInstruction(const Program& program, size_t index, Instruction instruction, Register reg = Register::R)
+{
+	if (index >= program.size() || program[index].instruction != instruction)
+		return false;
+	if (instruction == Instruction::Pop || instruction == Instruction::Move)
+		return Register(program[index].data.Get<int>(-1)) == reg;
+	return true;
+}
+
+static bool IsFoldableOperator(Instruction instruction)
+{
+	switch (instruction)
+	{
+	case Instruction::Add:
+	case Instruction::Subtract:
+	case Instruction::Multiply:
+	case Instruction::Divide:
+	case Instruction::And:
+	case Instruction::Or:
+	case Instruction::Less:
+	case Instruction::LessEq:
+	case Instruction::Greater:
+	case Instruction::GreaterEq:
+	case Instruction::Equal:
+	case Instruction::NotEqual:
+		return true;
+	default:
+		break;
+	}
+	return false;
+}
+
+// Returns the number of instructions of a constant sub-program starting at 'index', or zero if there is none.
+static size_t MatchConstantExpression(const Program& program, size_t i)
+{
+	if (!IsInstruction(program, i, Instruction::Literal))
+		return 0;
+
+	// [Literal] [Not]
+	if (IsInstruction(program, i + 1, Instruction::Not))
+		return 2;
+
+	// [Literal] [Push] [Literal] [Pop L] [Binary operator]
+	if (IsInstruction(program, i + 1, Instruction::Push) && IsInstruction(program, i + 2, Instruction::Literal) &&
+		IsInstruction(program, i + 3, Instruction::Pop, Register::L) && i + 4 < program.size() && IsFoldableOperator(program[i + 4].instruction))
+		return 5;
+
+	// [Literal] [Push] [Literal] [Push] [Literal] [Pop C] [Pop L] [Ternary]
+	if (IsInstruction(program, i + 1, Instruction::Push) && IsInstruction(program, i + 2, Instruction::Literal) &&
+		IsInstruction(program, i + 3, Instruction::Push) && IsInstruction(program, i + 4, Instruction::Literal) &&
+		IsInstruction(program, i + 5, Instruction::Pop, Register::C) && IsInstruction(program, i + 6, Instruction::Pop, Register::L) &&
+		IsInstruction(program, i + 7, Instruction::Ternary))
+		return 8;
+
+	return 0;
+}
+
+/*
+	Compiles the program produced by the parser into an equivalent, but cheaper program.
+
+	First, constant sub-expressions are folded into single literals, repeatedly until no more folding is possible. Then, operands
+	loaded directly into a register are moved there instead of going through the stack:
+		[Push] [Literal|Variable] [Pop L/C]   ->   [Move L/C] [Literal|Variable]
+*/
+static void OptimizeProgram(Program& program)
+{
+	const AddressList no_addresses;
+	const VariableList no_variables;
+
+	bool folded = true;
+	while (folded)
+	{
+		folded = false;
+		for (size_t i = 0; i < program.size(); i++)
+		{
+			const size_t count = MatchConstantExpression(program, i);
+			if (count == 0)
+				continue;
+
+			const Program sub_program(program.begin() + i, program.begin() + i + count);
+			DataInterpreter interpreter(sub_program, no_addresses, no_variables, DataExpressionInterface());
+			if (!interpreter.Run())
+				continue;
+
+			program[i] = InstructionData{Instruction::Literal, interpreter.Result()};
+			program.erase(program.begin() + i + 1, program.begin() + i + count);
+			folded = true;
+		}
+	}
+
+	for (size_t i = 0; i + 2 < program.size(); i++)
+	{
+		if (program[i].instruction != Instruction::Push)
+			continue;
+
+		const Instruction load = program[i + 1].instruction;
+		if (load != Instruction::Literal && load != Instruction::Variable)
+			continue;
+
+		if (IsInstruction(program, i + 2, Instruction::Pop, Register::L) || IsInstruction(program, i + 2, Instruction::Pop, Register::C))
+		{
+			InstructionData move = {Instruction::Move, program[i + 2].data};
+			program[i] = std::move(move);
+			program.erase(program.begin() + i + 2);
+		}
+	}
+}
+
+// Caches the variables of top-level addresses, which refer to bound data that remains at a stable location for the lifetime of the
+// data model. Nested addresses are resolved during execution, as eg. array members may be relocated between runs.
+static VariableList ResolveVariables(const AddressList& addresses, const DataExpressionInterface& expression_interface)
+{
+	VariableList variables;
+	variables.reserve(addresses.size());
+	for (const DataAddress& address : addresses)
+	{
+		if (address.size() == 1)
+			variables.push_back(expression_interface.GetVariable(address));
+		else
+			variables.push_back(DataVariable());
+	}
+	return variables;
+}
+
 DataExpression::DataExpression(String expression) : expression(std::move(expression))
 {}
 
@@ -989,12 +1154,15 @@ bool DataExpression::Parse(const DataExpressionInterface& expression_interface,
 	program = parser.ReleaseProgram();
 	addresses = parser.ReleaseAddresses();
 
+	OptimizeProgram(program);
+	variables = ResolveVariables(addresses, expression_interface);
+
 	return true;
 }
 
 bool DataExpression::Run(const DataExpressionInterface& expression_interface, Variant& out_value)
 {
-	DataInterpreter interpreter(program, addresses, expression_interface);
+	DataInterpreter interpreter(program, addresses, variables, expression_interface);
 	
 	if (!interpreter.Run())
 		return false;
@@ -1042,6 +1210,11 @@ Variant DataExpressionInterface::GetValue(const DataAddress& address) const
 	return result;
 }
 
+DataVariable DataExpressionInterface::GetVariable(const DataAddress& address) const
+{
+	return data_model ? data_model->GetVariable(address) : DataVariable();
+}
+
 bool DataExpressionInterface::SetValue(const DataAddress& address, const Variant& value) const
 {
 	bool result = false;
@@ -37,9 +37,11 @@ namespace Rml {
 
 class Element;
 class DataModel;
+class DataVariable;
 struct InstructionData;
 using Program = Vector<InstructionData>;
 using AddressList = Vector<DataAddress>;
+using VariableList = Vector<DataVariable>;
 
 class DataExpressionInterface {
 public:
@@ -47,6 +49,7 @@ public:
     DataExpressionInterface(DataModel* data_model, Element* element, Event* event = nullptr);
 
     DataAddress ParseAddress(const String& address_str) const;
+    DataVariable GetVariable(const DataAddress& address) const;
     Variant GetValue(const DataAddress& address) const;
     bool SetValue(const DataAddress& address, const Variant& value) const;
     bool CallTransform(const String& name, const VariantList& arguments, Variant& out_result);
@@ -76,6 +79,7 @@ private:
     
     Program program;
     AddressList addresses;
+    VariableList variables;
 };
 
 } // namespace Rml
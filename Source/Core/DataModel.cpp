@@ -75,6 +75,14 @@ static DataAddress ParseAddress(const String& address_str)
 	return address;
 }
 
+// Regular address entries contain either a name or an index, we use an entry with both to distinguish index references.
+static const String index_reference_name = "#index";
+
+static bool IsIndexReference(const DataAddressEntry& entry)
+{
+	return entry.index >= 0 && !entry.name.empty();
+}
+
 // Returns an error string on error, or nullptr on success.
 static const char* LegalVariableName(const String& name)
 {
@@ -229,9 +237,63 @@ bool DataModel::InsertAlias(Element* element, const String& alias_name, DataAddr
 
 bool DataModel::EraseAliases(Element* element)
 {
+	auto it = element_index_references.find(element);
+	if (it != element_index_references.end())
+	{
+		free_index_references.push_back(it->second);
+		element_index_references.erase(it);
+	}
+
 	return aliases.erase(element) == 1;
 }
 
+DataAddressEntry DataModel::InsertIndexReference(Element* element, int index)
+{
+	int& reference = element_index_references.emplace(element, -1).first->second;
+
+	if (reference < 0)
+	{
+		if (free_index_references.empty())
+		{
+			reference = (int)index_references.size();
+			index_references.push_back(index);
+		}
+		else
+		{
+			reference = free_index_references.back();
+			free_index_references.pop_back();
+		}
+	}
+
+	index_references[reference] = index;
+
+	DataAddressEntry entry(index_reference_name);
+	entry.index = reference;
+	return entry;
+}
+
+void DataModel::SetIndexReference(Element* element, int index)
+{
+	auto it = element_index_references.find(element);
+	RMLUI_ASSERT(it != element_index_references.end());
+
+	int& value = index_references[it->second];
+	if (value != index)
+	{
+		value = index;
+
+		// Views using the index directly refer to it through a literal, which is not a variable we can dirty. Instead, update all literal views.
+		dirty_variables.emplace("literal");
+	}
+}
+
+int DataModel::GetIndex(const DataAddressEntry& entry) const
+{
+	if (IsIndexReference(entry))
+		return index_references[entry.index];
+	return entry.index;
+}
+
 DataAddress DataModel::ResolveAddress(const String& address_str, Element* element) const
 {
 	DataAddress address = ParseAddress(address_str);
@@ -291,7 +353,12 @@ DataVariable DataModel::GetVariable(const DataAddress& address) const
 
 		for (int i = 1; i < (int)address.size() && variable; i++)
 		{
-			variable = variable.Child(address[i]);
+			const DataAddressEntry& entry = address[i];
+			if (IsIndexReference(entry))
+				variable = variable.Child(DataAddressEntry(GetIndex(entry)));
+			else
+				variable = variable.Child(entry);
+
 			if (!variable)
 				return DataVariable();
 		}
@@ -302,7 +369,7 @@ DataVariable DataModel::GetVariable(const DataAddress& address) const
 	if (address[0].name == "literal")
 	{
 		if (address.size() > 2 && address[1].name == "int")
-			return MakeLiteralIntVariable(address[2].index);
+			return MakeLiteralIntVariable(GetIndex(address[2]));
 	}
 
 	return DataVariable();
@@ -60,6 +60,11 @@ public:
 	bool InsertAlias(Element* element, const String& alias_name, DataAddress replace_with_address);
 	bool EraseAliases(Element* element);
 
+	// Index references are array indices that can be changed after having been inserted into addresses, such as in the aliases of the element.
+	// The reference is owned by the element, and erased together with its aliases.
+	DataAddressEntry InsertIndexReference(Element* element, int index);
+	void SetIndexReference(Element* element, int index);
+
 	DataAddress ResolveAddress(const String& address_str, Element* element) const;
 	const DataEventFunc* GetEventCallback(const String& name);
 
@@ -93,6 +98,12 @@ private:
 	using ScopedAliases = UnorderedMap<Element*, SmallUnorderedMap<String, DataAddress>>;
 	ScopedAliases aliases;
 
+	int GetIndex(const DataAddressEntry& entry) const;
+
+	Vector<int> index_references;
+	Vector<int> free_index_references;
+	UnorderedMap<Element*, int> element_index_references;
+
 	const TransformFuncRegister* transform_register;
 
 	SmallUnorderedSet<Element*> attached_elements;
@@ -29,6 +29,7 @@
 #include "DataViewDefault.h"
 #include "DataExpression.h"
 #include "DataModel.h"
+#include "ElementPrototype.h"
 #include "XMLParseTools.h"
 #include "../../Include/RmlUi/Core/Core.h"
 #include "../../Include/RmlUi/Core/DataVariable.h"
@@ -528,19 +529,45 @@ bool DataViewFor::Initialize(DataModel& model, Element* element, const String& i
 	if (container_address.empty())
 		return false;
 
-	element->SetProperty(PropertyId::Display, Property(Style::Display::None));
-
-	// Copy over the attributes, but remove the 'data-for' which would otherwise recreate the data-for loop on all constructed children recursively.
-	attributes = element->GetAttributes();
-	for (auto it = attributes.begin(); it != attributes.end(); ++it)
+	// The optional key uniquely identifies each item, given as an address relative to the iterator. Eg. 'it.id'.
+	const String key_expression = element->GetAttribute<String>("data-key", "");
+	if (!key_expression.empty())
 	{
-		if (it->first == "data-for")
+		if (key_expression.substr(0, key_expression.find_first_of(".[")) != iterator_name)
 		{
-			attributes.erase(it);
-			break;
+			Log::Message(Log::LT_WARNING, "Invalid data-key '%s', expected an address starting with the iterator name '%s'.", key_expression.c_str(),
+				iterator_name.c_str());
+			return false;
 		}
+
+		// Resolve the key as seen from an item, then we only need the part following the item's address. The data-for element itself is never given
+		// any aliases, so we can safely insert and erase a temporary one here.
+		DataAddress iterator_address = container_address;
+		iterator_address.push_back(DataAddressEntry(0));
+
+		model.InsertAlias(element, iterator_name, iterator_address);
+		DataAddress address = model.ResolveAddress(key_expression, element);
+		model.EraseAliases(element);
+
+		if (address.size() < iterator_address.size())
+			return false;
+
+		key_address.assign(address.begin() + iterator_address.size(), address.end());
+		keyed = true;
 	}
 
+	element->SetProperty(PropertyId::Display, Property(Style::Display::None));
+
+	// Copy over the attributes, but remove the 'data-for' which would otherwise recreate the data-for loop on all constructed children recursively.
+	attributes = element->GetAttributes();
+	attributes.erase("data-for");
+	attributes.erase("data-key");
+
+	// Parse the contents once up front, so that new items can be instanced without running the XML parser.
+	prototype = MakeUnique<ElementPrototype>();
+	if (!prototype->Compile(rml_contents))
+		prototype.reset();
+
 	return true;
 }
 
@@ -551,40 +578,24 @@ bool DataViewFor::Update(DataModel& model)
 	if (!variable)
 		return false;
 
+	if (keyed)
+		return UpdateKeyed(model, variable);
+
 	bool result = false;
 	const int size = variable.Size();
 	const int num_elements = (int)elements.size();
-	Element* element = GetElement();
 
 	for (int i = 0; i < Math::Max(size, num_elements); i++)
 	{
 		if (i >= num_elements)
 		{
-			ElementPtr new_element_ptr = Factory::InstanceElement(nullptr, element->GetTagName(), element->GetTagName(), attributes);
-
-			DataAddress iterator_address;
-			iterator_address.reserve(container_address.size() + 1);
-			iterator_address = container_address;
-			iterator_address.push_back(DataAddressEntry(i));
-
-			DataAddress iterator_index_address = {
-				{"literal"}, {"int"}, {i}
-			};
-
-			model.InsertAlias(new_element_ptr.get(), iterator_name, std::move(iterator_address));
-			model.InsertAlias(new_element_ptr.get(), iterator_index_name, std::move(iterator_index_address));
-
-			Element* new_element = element->GetParentNode()->InsertBefore(std::move(new_element_ptr), element);
-			elements.push_back(new_element);
-
-			elements[i]->SetInnerRML(rml_contents);
+			elements.push_back(InsertItem(model, i));
 
 			RMLUI_ASSERT(i < (int)elements.size());
 		}
 		if (i >= size)
 		{
-			model.EraseAliases(elements[i]);
-			elements[i]->GetParentNode()->RemoveChild(elements[i]).reset();
+			RemoveItem(model, elements[i]);
 			elements[i] = nullptr;
 		}
 	}
@@ -595,6 +606,167 @@ bool DataViewFor::Update(DataModel& model)
 	return result;
 }
 
+bool DataViewFor::UpdateKeyed(DataModel& model, DataVariable variable)
+{
+	const int size = variable.Size();
+
+	// Retrieve the key of every item. Items whose key could not be retrieved or is not unique are instead matched by their index.
+	StringList new_keys(size);
+	Vector<bool> new_keys_valid(size, true);
+	{
+		DataAddress address = container_address;
+		address.push_back(DataAddressEntry(0));
+		address.insert(address.end(), key_address.begin(), key_address.end());
+
+		const size_t index_position = container_address.size();
+		Variant key;
+		UnorderedMap<String, int> item_index_by_key;
+		item_index_by_key.reserve(size);
+
+		for (int i = 0; i < size; i++)
+		{
+			address[index_position].index = i;
+			if (!model.GetVariableInto(address, key))
+			{
+				Log::Message(Log::LT_WARNING, "Could not retrieve data-key of item %d in data-for view on element %s. The item is matched by its index instead.",
+					i, GetElement()->GetAddress().c_str());
+				new_keys_valid[i] = false;
+				continue;
+			}
+
+			new_keys[i] = key.Get<String>();
+
+			auto it_inserted = item_index_by_key.emplace(new_keys[i], i);
+			if (!it_inserted.second)
+			{
+				const int first_index = it_inserted.first->second;
+				if (new_keys_valid[first_index])
+				{
+					Log::Message(Log::LT_WARNING, "Duplicate data-key '%s' in data-for view on element %s. Items with this key are matched by their index instead.",
+						new_keys[i].c_str(), GetElement()->GetAddress().c_str());
+					new_keys_valid[first_index] = false;
+				}
+				new_keys_valid[i] = false;
+			}
+		}
+	}
+
+	// Match the new items with the existing elements by their keys. The elements remaining in 'elements' are no longer used afterwards.
+	UnorderedMap<String, int> element_index_by_key;
+	element_index_by_key.reserve(elements.size());
+	for (int i = 0; i < (int)elements.size(); i++)
+	{
+		if (element_keys_valid[i])
+			element_index_by_key.emplace(element_keys[i], i);
+	}
+
+	ElementList new_elements(size, nullptr);
+	Vector<int> previous_element_indices(size, -1);
+
+	auto MatchElement = [&](int i, int element_index) {
+		new_elements[i] = elements[element_index];
+		elements[element_index] = nullptr;
+		previous_element_indices[i] = element_index;
+		model.SetIndexReference(new_elements[i], i);
+	};
+
+	for (int i = 0; i < size; i++)
+	{
+		if (!new_keys_valid[i])
+			continue;
+
+		auto it = element_index_by_key.find(new_keys[i]);
+		if (it != element_index_by_key.end())
+		{
+			MatchElement(i, it->second);
+			element_index_by_key.erase(it);
+		}
+	}
+
+	// Items without a valid key take the element at their index, unless it was already taken by a key.
+	for (int i = 0; i < size && i < (int)elements.size(); i++)
+	{
+		if (!new_keys_valid[i] && elements[i])
+			MatchElement(i, i);
+	}
+
+	// New elements are inserted at the end, thus any existing element following them must be moved.
+	bool in_order = true;
+	int previous_element_index = -1;
+	bool new_item_inserted = false;
+
+	for (int i = 0; i < size && in_order; i++)
+	{
+		const int element_index = previous_element_indices[i];
+		if (element_index < 0)
+			new_item_inserted = true;
+		else if (element_index < previous_element_index || new_item_inserted)
+			in_order = false;
+		else
+			previous_element_index = element_index;
+	}
+
+	for (Element* element : elements)
+	{
+		if (element)
+			RemoveItem(model, element);
+	}
+
+	for (int i = 0; i < size; i++)
+	{
+		if (!new_elements[i])
+			new_elements[i] = InsertItem(model, i);
+	}
+
+	if (!in_order)
+	{
+		Element* element = GetElement();
+		element->GetParentNode()->MoveChildrenBefore(new_elements, element);
+	}
+
+	elements = std::move(new_elements);
+	element_keys = std::move(new_keys);
+	element_keys_valid = std::move(new_keys_valid);
+
+	return false;
+}
+
+Element* DataViewFor::InsertItem(DataModel& model, int index)
+{
+	Element* element = GetElement();
+	ElementPtr new_element_ptr = Factory::InstanceElement(nullptr, element->GetTagName(), element->GetTagName(), attributes);
+
+	// Keyed items may be moved later, then we need to be able to change their index after it has been resolved into the item's views.
+	const DataAddressEntry index_entry = (keyed ? model.InsertIndexReference(new_element_ptr.get(), index) : DataAddressEntry(index));
+
+	DataAddress iterator_address;
+	iterator_address.reserve(container_address.size() + 1);
+	iterator_address = container_address;
+	iterator_address.push_back(index_entry);
+
+	DataAddress iterator_index_address = {
+		{"literal"}, {"int"}, index_entry
+	};
+
+	model.InsertAlias(new_element_ptr.get(), iterator_name, std::move(iterator_address));
+	model.InsertAlias(new_element_ptr.get(), iterator_index_name, std::move(iterator_index_address));
+
+	Element* new_element = element->GetParentNode()->InsertBefore(std::move(new_element_ptr), element);
+
+	if (prototype)
+		prototype->Instance(new_element);
+	else
+		new_element->SetInnerRML(rml_contents);
+
+	return new_element;
+}
+
+void DataViewFor::RemoveItem(DataModel& model, Element* item)
+{
+	model.EraseAliases(item);
+	item->GetParentNode()->RemoveChild(item).reset();
+}
+
 StringList DataViewFor::GetVariableNameList() const {
 	RMLUI_ASSERT(!container_address.empty());
 	return StringList{ container_address.front().name };
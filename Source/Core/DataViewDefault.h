@@ -38,6 +38,7 @@ namespace Rml {
 
 class Element;
 class DataExpression;
+class ElementPrototype;
 using DataExpressionPtr = UniquePtr<DataExpression>;
 
 
@@ -172,12 +173,25 @@ protected:
 	void Release() override;
 
 private:
+	bool UpdateKeyed(DataModel& model, DataVariable variable);
+
+	Element* InsertItem(DataModel& model, int index);
+	void RemoveItem(DataModel& model, Element* item);
+
 	DataAddress container_address;
 	String iterator_name;
 	String iterator_index_name;
 	String rml_contents;
+	UniquePtr<ElementPrototype> prototype;
 	ElementAttributes attributes;
 
+	// Keyed views identify items by the value at the key address relative to each item, instead of by their index.
+	bool keyed = false;
+	DataAddress key_address;
+	StringList element_keys;
+	// False for elements whose key could not be retrieved or was not unique, these are matched by their index instead.
+	Vector<bool> element_keys_valid;
+
 	ElementList elements;
 };
 
@@ -53,6 +53,7 @@
 #include "EventDispatcher.h"
 #include "EventSpecification.h"
 #include "ElementDecoration.h"
+#include "LayoutCache.h"
 #include "LayoutEngine.h"
 #include "PluginRegistry.h"
 #include "PropertiesIterator.h"
@@ -108,11 +109,11 @@ static Pool< ElementMeta > element_meta_chunk_pool(200, true);
 
 Element::Element(const String& tag) :
 	local_stacking_context(false), local_stacking_context_forced(false), stacking_context_dirty(false), computed_values_are_default_initialized(true),
-	visible(true), offset_fixed(false), absolute_offset_dirty(true), dirty_definition(false), dirty_child_definitions(false), dirty_animation(false),
+	visible(true), offset_fixed(false), absolute_offset_dirty(true), layout_boundary(false), dirty_definition(false), dirty_own_definition(false), dirty_child_definitions(false), dirty_animation(false),
 	dirty_transition(false), dirty_transform(false), dirty_perspective(false),
 
 	tag(tag), relative_offset_base(0, 0), relative_offset_position(0, 0), absolute_offset(0, 0), scroll_offset(0, 0), content_offset(0, 0),
-	content_box(0, 0)
+	content_box(0, 0), layout_boundary_containing_block(0, 0)
 {
 	RMLUI_ASSERT(tag == StringUtilities::ToLower(tag));
 	parent = nullptr;
@@ -299,7 +300,10 @@ ElementPtr Element::Clone() const
 void Element::SetClass(const String& class_name, bool activate)
 {
 	if (meta->style.SetClass(class_name, activate))
-		DirtyDefinition(DirtyNodes::SelfAndSiblings);
+	{
+		const StyleSheet* style_sheet = GetStyleSheet();
+		DirtyDefinition(style_sheet ? style_sheet->GetClassInvalidation(class_name) : StyleSheetIndex::InvalidateAll);
+	}
 }
 
 // Checks if a class is set on the element.
@@ -476,6 +480,10 @@ void Element::SetBox(const Box& box)
 		main_box = box;
 		additional_boxes.clear();
 
+		// The element's layout no longer necessarily corresponds to its last formatting, such as when set externally.
+		if (layout_cache)
+			layout_cache->format_valid = false;
+
 		OnResize();
 
 		meta->background_border.DirtyBackground();
@@ -771,8 +779,9 @@ void Element::SetPseudoClass(const String& pseudo_class, bool activate)
 {
 	if (meta->style.SetPseudoClass(pseudo_class, activate, false))
 	{
-		// Include siblings in case of RCSS presence of sibling combinators '+', '~'.
-		DirtyDefinition(DirtyNodes::SelfAndSiblings);
+		// Only elements matched by rules using the pseudo-class can be affected, this may include siblings due to sibling combinators '+', '~'.
+		const StyleSheet* style_sheet = GetStyleSheet();
+		DirtyDefinition(style_sheet ? style_sheet->GetPseudoClassInvalidation(pseudo_class) : StyleSheetIndex::InvalidateAll);
 		OnPseudoClassChange(pseudo_class, activate);
 	}
 }
@@ -1354,7 +1363,7 @@ Element* Element::AppendChild(ElementPtr child, bool dom_element)
 	DirtyDefinition(DirtyNodes::Self);
 
 	if (dom_element)
-		DirtyLayout();
+		DirtyLayoutOfContents();
 
 	return child_ptr;
 }
@@ -1390,7 +1399,7 @@ Element* Element::InsertBefore(ElementPtr child, Element* adjacent_element)
 		if ((int) child_index >= GetNumChildren())
 			num_non_dom_children++;
 		else
-			DirtyLayout();
+			DirtyLayoutOfContents();
 
 		children.insert(children.begin() + child_index, std::move(child));
 		child_ptr->SetParent(this);
@@ -1485,7 +1494,7 @@ ElementPtr Element::RemoveChild(Element* child)
 
 			detached_child->SetParent(nullptr);
 
-			DirtyLayout();
+			DirtyLayoutOfContents();
 			DirtyStackingContext();
 			DirtyDefinition(DirtyNodes::Self);
 
@@ -1695,13 +1704,23 @@ void Element::OnStyleSheetChange()
 // Called when attributes on the element are changed.
 void Element::OnAttributeChange(const ElementAttributes& changed_attributes)
 {
+	const StyleSheet* style_sheet = GetStyleSheet();
+	int invalidation = 0;
+
 	for (const auto& element_attribute : changed_attributes)
 	{
 		const auto& attribute = element_attribute.first;
 		const auto& value = element_attribute.second;
+
+		if (!style_sheet || attribute == "id" || attribute == "class")
+			invalidation = StyleSheetIndex::InvalidateAll;
+		else
+			invalidation |= style_sheet->GetAttributeInvalidation(attribute);
+
 		if (attribute == "id")
 		{
 			id = value.Get<String>();
+			meta->style.SetId(id);
 		}
 		else if (attribute == "class")
 		{
@@ -1758,8 +1777,9 @@ void Element::OnAttributeChange(const ElementAttributes& changed_attributes)
 	}
 
 	// Any change to the attributes may affect which styles apply to the current element, in particular due to attribute selectors, ID selectors, and
-	// class selectors. This can further affect all siblings or descendants due to sibling or descendant combinators.
-	DirtyDefinition(DirtyNodes::SelfAndSiblings);
+	// class selectors. This can further affect all siblings or descendants due to sibling or descendant combinators. The style sheet tells us which
+	// of these elements may actually be affected by the changed attributes.
+	DirtyDefinition(invalidation);
 }
 
 // Called when properties on the element are changed.
@@ -1773,33 +1793,30 @@ void Element::OnPropertyChange(const PropertyIdSet& changed_properties)
 		changed_properties.Contains(PropertyId::Left)
 	);
 
-	// See if the document layout needs to be updated.
-	if (!IsLayoutDirty())
-	{
-		// Force a relayout if any of the changed properties require it.
-		const PropertyIdSet changed_properties_forcing_layout =
-			(changed_properties & StyleSheetSpecification::GetRegisteredPropertiesForcingLayout());
+	// Force a relayout if any of the changed properties require it. This is done even if the whole document layout is already dirty, so that
+	// any cached layout results of this element and its ancestors are invalidated.
+	const PropertyIdSet changed_properties_forcing_layout =
+		(changed_properties & StyleSheetSpecification::GetRegisteredPropertiesForcingLayout());
 
-		if (!changed_properties_forcing_layout.Empty())
-		{
+	if (!changed_properties_forcing_layout.Empty())
+	{
+		DirtyLayout();
+	}
+	else if (top_right_bottom_left_changed)
+	{
+		// Normally, the position properties only affect the position of the element and not the layout. Thus, these properties are not registered
+		// as affecting layout. However, when absolutely positioned elements with both left & right, or top & bottom are set to definite values,
+		// they affect the size of the element and thereby also the layout. This layout-dirtying condition needs to be registered manually.
+		using namespace Style;
+		const ComputedValues& computed = GetComputedValues();
+		const bool absolutely_positioned = (computed.position() == Position::Absolute || computed.position() == Position::Fixed);
+		const bool sized_width =
+			(computed.width().type == Width::Auto && computed.left().type != Left::Auto && computed.right().type != Right::Auto);
+		const bool sized_height =
+			(computed.height().type == Height::Auto && computed.top().type != Top::Auto && computed.bottom().type != Bottom::Auto);
+
+		if (absolutely_positioned && (sized_width || sized_height))
 			DirtyLayout();
-		}
-		else if (top_right_bottom_left_changed)
-		{
-			// Normally, the position properties only affect the position of the element and not the layout. Thus, these properties are not registered
-			// as affecting layout. However, when absolutely positioned elements with both left & right, or top & bottom are set to definite values,
-			// they affect the size of the element and thereby also the layout. This layout-dirtying condition needs to be registered manually.
-			using namespace Style;
-			const ComputedValues& computed = GetComputedValues();
-			const bool absolutely_positioned = (computed.position() == Position::Absolute || computed.position() == Position::Fixed);
-			const bool sized_width =
-				(computed.width().type == Width::Auto && computed.left().type != Left::Auto && computed.right().type != Right::Auto);
-			const bool sized_height =
-				(computed.height().type == Height::Auto && computed.top().type != Top::Auto && computed.bottom().type != Bottom::Auto);
-
-			if (absolutely_positioned && (sized_width || sized_height))
-				DirtyLayout();
-		}
 	}
 
 	// Update the position.
@@ -1962,8 +1979,32 @@ void Element::OnChildRemove(Element* /*child*/)
 
 void Element::DirtyLayout()
 {
-	if (Element* document = GetOwnerDocument())
-		document->DirtyLayout();
+	DirtyLayoutCache();
+
+	// Our own box may change, thus the layout must be updated starting from our parent's contents.
+	if (ElementDocument* document = GetOwnerDocument())
+		document->DirtyLayoutFrom(parent);
+}
+
+void Element::DirtyLayoutOfContents()
+{
+	DirtyLayoutCache();
+
+	if (ElementDocument* document = GetOwnerDocument())
+		document->DirtyLayoutFrom(this);
+}
+
+void Element::DirtyLayoutCache()
+{
+	for (Element* element = this; element; element = element->parent)
+	{
+		if (LayoutCache* cache = element->layout_cache.get())
+		{
+			cache->format_valid = false;
+			cache->measure_valid = false;
+			cache->shrink_to_fit_valid = false;
+		}
+	}
 }
 
 bool Element::IsLayoutDirty()
@@ -2116,6 +2157,54 @@ void Element::SetDataModel(DataModel* new_data_model)
 		child->SetDataModel(new_data_model);
 }
 
+void Element::MoveChildrenBefore(const ElementList& ordered_children, Element* adjacent_element)
+{
+	RMLUI_ASSERT(adjacent_element && adjacent_element->GetParentNode() == this);
+
+	if (ordered_children.empty())
+		return;
+
+	SmallUnorderedMap<Element*, int> new_positions;
+	new_positions.reserve(ordered_children.size());
+	for (int i = 0; i < (int)ordered_children.size(); i++)
+		new_positions.emplace(ordered_children[i], i);
+
+	OwnedElementList moved_children(ordered_children.size());
+	OwnedElementList new_children;
+	new_children.reserve(children.size());
+
+	for (ElementPtr& child : children)
+	{
+		auto it = new_positions.find(child.get());
+		if (it != new_positions.end())
+			moved_children[it->second] = std::move(child);
+	}
+
+	for (ElementPtr& child : children)
+	{
+		if (!child)
+			continue;
+
+		if (child.get() == adjacent_element)
+		{
+			for (ElementPtr& moved_child : moved_children)
+			{
+				RMLUI_ASSERT(moved_child);
+				new_children.push_back(std::move(moved_child));
+			}
+		}
+
+		new_children.push_back(std::move(child));
+	}
+
+	RMLUI_ASSERT(new_children.size() == children.size());
+	children = std::move(new_children);
+
+	DirtyLayoutOfContents();
+	DirtyStackingContext();
+	DirtyDefinition(DirtyNodes::Self);
+}
+
 void Element::Release()
 {
 	if (instancer)
@@ -2429,16 +2518,32 @@ void Element::DirtyDefinition(DirtyNodes dirty_nodes)
 	}
 }
 
-void Element::UpdateDefinition()
+void Element::DirtyDefinition(int invalidation)
 {
-	if (dirty_definition)
+	if (invalidation & StyleSheetIndex::InvalidateSiblings)
 	{
-		dirty_definition = false;
+		DirtyDefinition(DirtyNodes::SelfAndSiblings);
+		return;
+	}
 
+	if (invalidation & StyleSheetIndex::InvalidateSelf)
+		dirty_own_definition = true;
+	if (invalidation & StyleSheetIndex::InvalidateDescendants)
+		dirty_child_definitions = true;
+}
+
+void Element::UpdateDefinition()
+{
+	if (dirty_definition || dirty_own_definition)
+	{
 		// Dirty definition implies all our descendent elements. Anything that can change the definition of this element can also change the
 		// definition of any descendants due to the presence of RCSS descendant or child combinators. In principle this also applies to sibling
-		// combinators, but those are handled during the DirtyDefinition call.
-		dirty_child_definitions = true;
+		// combinators, but those are handled during the DirtyDefinition call. Changes known to affect only this element are excluded from this.
+		if (dirty_definition)
+			dirty_child_definitions = true;
+
+		dirty_definition = false;
+		dirty_own_definition = false;
 
 		GetStyle()->UpdateDefinition();
 	}
@@ -43,6 +43,7 @@
 #include "Template.h"
 #include "TemplateCache.h"
 #include "XMLParseTools.h"
+#include <algorithm>
 
 namespace Rml {
 
@@ -420,6 +421,38 @@ void ElementDocument::UpdateLayout()
 {
 	// Note: Carefully consider when to call this function for performance reasons.
 	// Ideally, only called once per update loop.
+	if (!layout_dirty && !dirty_layout_boundaries.empty())
+	{
+		RMLUI_ZoneScopedN("FormatLayoutBoundaries");
+
+		// Formatting may dirty the layout again, make sure that doesn't interfere with the iteration.
+		Vector<ObserverPtr<Element>> boundaries;
+		std::swap(boundaries, dirty_layout_boundaries);
+
+		for (const ObserverPtr<Element>& boundary : boundaries)
+		{
+			Element* element = boundary.get();
+			if (!element || element->GetOwnerDocument() != this)
+				continue;
+
+			// Boundaries nested within other dirty boundaries are formatted together with their ancestor.
+			bool nested = false;
+			for (Element* ancestor = element->GetParentNode(); ancestor && ancestor != this && !nested; ancestor = ancestor->GetParentNode())
+			{
+				nested = std::any_of(boundaries.begin(), boundaries.end(),
+					[ancestor](const ObserverPtr<Element>& other) { return other.get() == ancestor; });
+			}
+			if (nested)
+				continue;
+
+			if (!LayoutEngine::FormatLayoutBoundary(element))
+			{
+				layout_dirty = true;
+				break;
+			}
+		}
+	}
+
 	if(layout_dirty)
 	{
 		RMLUI_ZoneScoped;
@@ -435,6 +468,8 @@ void ElementDocument::UpdateLayout()
 		// In particular, scrollbars being enabled may set the dirty flag, but this case is already handled within the layout engine.
 		layout_dirty = false;
 	}
+
+	dirty_layout_boundaries.clear();
 }
 
 // Updates the position of the document based on the style properties.
@@ -483,6 +518,7 @@ void ElementDocument::DirtyPosition()
 
 void ElementDocument::DirtyLayout()
 {
+	DirtyLayoutCache();
 	layout_dirty = true;
 }
 
@@ -491,6 +527,27 @@ bool ElementDocument::IsLayoutDirty()
 	return layout_dirty;
 }
 
+void ElementDocument::DirtyLayoutFrom(Element* element)
+{
+	if (layout_dirty)
+		return;
+
+	// Find the nearest layout boundary, its contents can be formatted without affecting anything outside it.
+	for (; element && element != this; element = element->GetParentNode())
+	{
+		if (LayoutEngine::IsLayoutBoundary(element))
+		{
+			const auto it = std::find_if(dirty_layout_boundaries.begin(), dirty_layout_boundaries.end(),
+				[element](const ObserverPtr<Element>& boundary) { return boundary.get() == element; });
+			if (it == dirty_layout_boundaries.end())
+				dirty_layout_boundaries.push_back(element->GetObserverPtr());
+			return;
+		}
+	}
+
+	DirtyLayout();
+}
+
 void ElementDocument::DirtyVwAndVhProperties()
 {
 	GetStyle()->DirtyPropertiesWithUnitsRecursive(Property::VW | Property::VH);
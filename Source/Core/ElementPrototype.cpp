@@ -0,0 +1,187 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "ElementPrototype.h"
+#include "../../Include/RmlUi/Core/Core.h"
+#include "../../Include/RmlUi/Core/Element.h"
+#include "../../Include/RmlUi/Core/ElementUtilities.h"
+#include "../../Include/RmlUi/Core/Factory.h"
+#include "../../Include/RmlUi/Core/Log.h"
+#include "../../Include/RmlUi/Core/Profiling.h"
+#include "../../Include/RmlUi/Core/StreamMemory.h"
+#include "../../Include/RmlUi/Core/StringUtilities.h"
+#include "../../Include/RmlUi/Core/SystemInterface.h"
+#include "../../Include/RmlUi/Core/XMLParser.h"
+#include <algorithm>
+
+namespace Rml {
+
+// Records the parsed nodes in place of instancing them. Sets up the parser the same way as the XML parser used for instancing RML.
+class ElementPrototypeParser final : public BaseXMLParser {
+public:
+	ElementPrototypeParser(Vector<ElementPrototype::Node>& nodes) : nodes(nodes)
+	{
+		RegisterCDATATag("script");
+		RegisterCDATATag("style");
+
+		for (const String& name : Factory::GetStructuralDataViewAttributeNames())
+			RegisterInnerXMLAttribute(name);
+	}
+
+	bool IsValid() const { return valid && open_nodes.empty(); }
+
+	void HandleElementStart(const String& in_name, const XMLAttributes& attributes) override
+	{
+		// Skip the enclosing root tag.
+		depth += 1;
+		if (depth == 1)
+			return;
+
+		String name = StringUtilities::ToLower(in_name);
+
+		// Tags with a custom node handler may construct elements in any manner, we can only represent the default node handler.
+		if (XMLParser::GetNodeHandler(name))
+			valid = false;
+
+		open_nodes.push_back((int)nodes.size());
+		nodes.push_back(ElementPrototype::Node{ElementPrototype::NodeType::Element, XMLDataType::Text, std::move(name), attributes, -1});
+	}
+
+	void HandleElementEnd(const String& name) override
+	{
+		depth -= 1;
+		if (depth == 0)
+			return;
+
+		if (open_nodes.empty())
+		{
+			valid = false;
+			return;
+		}
+
+		ElementPrototype::Node& node = nodes[open_nodes.back()];
+		open_nodes.pop_back();
+
+		if (node.tag_or_data != StringUtilities::ToLower(name))
+			valid = false;
+
+		node.end_index = (int)nodes.size();
+	}
+
+	void HandleData(const String& data, XMLDataType type) override
+	{
+		if (depth == 0)
+			return;
+
+		// White-space is never instanced as text elements, we can leave it out already. As when instancing text, the data is translated
+		// before looking for white-space. The data itself is kept untranslated, it is translated again for each instance.
+		if (type != XMLDataType::InnerXML)
+		{
+			String text;
+			if (SystemInterface* system_interface = GetSystemInterface())
+				system_interface->TranslateString(text, data);
+
+			if (std::all_of(text.begin(), text.end(), &StringUtilities::IsWhitespace))
+				return;
+		}
+
+		nodes.push_back(ElementPrototype::Node{ElementPrototype::NodeType::Data, type, data, XMLAttributes(), (int)nodes.size() + 1});
+	}
+
+private:
+	Vector<ElementPrototype::Node>& nodes;
+	Vector<int> open_nodes;
+	int depth = 0;
+	bool valid = true;
+};
+
+bool ElementPrototype::Compile(const String& rml)
+{
+	RMLUI_ZoneScoped;
+
+	nodes.clear();
+	compiled = false;
+
+	const String open_tag = "<body>";
+	const String close_tag = "</body>";
+
+	auto stream = MakeUnique<StreamMemory>(rml.size() + open_tag.size() + close_tag.size());
+	stream->Write(open_tag.c_str(), open_tag.size());
+	stream->Write(rml);
+	stream->Write(close_tag.c_str(), close_tag.size());
+	stream->Seek(0, SEEK_SET);
+
+	ElementPrototypeParser parser(nodes);
+	parser.Parse(stream.get());
+
+	compiled = parser.IsValid();
+	if (!compiled)
+		nodes.clear();
+
+	return compiled;
+}
+
+void ElementPrototype::Instance(Element* parent) const
+{
+	RMLUI_ZoneScoped;
+	RMLUI_ASSERT(compiled);
+
+	InstanceNodes(parent, 0, (int)nodes.size());
+}
+
+void ElementPrototype::InstanceNodes(Element* parent, const int begin_index, const int end_index) const
+{
+	// This mirrors the construction done by the default XML node handler.
+	for (int i = begin_index; i < end_index; i = nodes[i].end_index)
+	{
+		const Node& node = nodes[i];
+
+		if (node.type == NodeType::Element)
+		{
+			Element* node_parent = parent;
+
+			ElementPtr element = Factory::InstanceElement(parent, node.tag_or_data, node.tag_or_data, node.attributes);
+			if (element)
+				node_parent = parent->AppendChild(std::move(element));
+			else
+				Log::Message(Log::LT_ERROR, "Failed to create element for tag %s, instancer returned nullptr.", node.tag_or_data.c_str());
+
+			InstanceNodes(node_parent, i + 1, node.end_index);
+		}
+		else
+		{
+			// Structural data views use the raw inner xml contents of the node, submit them now.
+			if (node.data_type == XMLDataType::InnerXML && ElementUtilities::ApplyStructuralDataViews(parent, node.tag_or_data))
+				continue;
+
+			Factory::InstanceElementText(parent, node.tag_or_data);
+		}
+	}
+}
+
+} // namespace Rml
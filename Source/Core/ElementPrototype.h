@@ -0,0 +1,78 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_ELEMENTPROTOTYPE_H
+#define RMLUI_CORE_ELEMENTPROTOTYPE_H
+
+#include "../../Include/RmlUi/Core/BaseXMLParser.h"
+#include "../../Include/RmlUi/Core/Types.h"
+
+namespace Rml {
+
+class Element;
+
+/**
+	An immutable, pre-parsed representation of an RML fragment, which can be instanced repeatedly without running the XML parser.
+
+	Only fragments handled entirely by the default node handler can be compiled, that is, fragments without any tags registered with a custom
+	node handler, such as 'select' or 'template'. Such fragments should instead be instanced through the XML parser, eg. using SetInnerRML().
+ */
+
+class ElementPrototype {
+public:
+	/// Parses the given RML fragment into the prototype.
+	/// @param[in] rml The RML fragment, as would be submitted to Element::SetInnerRML().
+	/// @return True if the fragment could be compiled, otherwise the prototype is left empty.
+	bool Compile(const String& rml);
+
+	/// Instances the compiled fragment, appending the resulting elements to the given parent.
+	/// @param[in] parent The element to append the new elements to.
+	void Instance(Element* parent) const;
+
+private:
+	enum class NodeType { Element, Data };
+
+	// Nodes are stored in document order, each element node refers to the node following its last descendant.
+	struct Node {
+		NodeType type;
+		XMLDataType data_type;
+		String tag_or_data;
+		XMLAttributes attributes;
+		int end_index;
+	};
+
+	void InstanceNodes(Element* parent, int begin_index, int end_index) const;
+
+	bool compiled = false;
+	Vector<Node> nodes;
+
+	friend class ElementPrototypeParser;
+};
+
+} // namespace Rml
+#endif
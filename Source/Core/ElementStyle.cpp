@@ -65,6 +65,7 @@ inline PseudoClassState operator&(PseudoClassState lhs, PseudoClassState rhs)
 ElementStyle::ElementStyle(Element* _element)
 {
 	element = _element;
+	tag_atom = AtomTable::GetOrInsert(element->GetTagName());
 }
 
 // Returns one of this element's properties.
@@ -173,11 +174,32 @@ void ElementStyle::UpdateDefinition()
 {
 	RMLUI_ZoneScoped;
 
+	// Any change to our ancestors' tags, ids, or classes which may be required by a descendant or child combinator dirties our definition, and
+	// ancestors are always updated first. Thus, we can update the ancestor filter here based on our parent.
+	ancestor_filter = AncestorFilter();
+	if (Element* parent = element->GetParentNode())
+	{
+		const ElementStyle* parent_style = parent->GetStyle();
+		ancestor_filter = parent_style->ancestor_filter;
+		ancestor_filter.Add(parent_style->tag_atom);
+		ancestor_filter.Add(parent_style->id_atom);
+		for (Atom name : parent_style->class_atoms)
+			ancestor_filter.Add(name);
+	}
+
 	SharedPtr<const ElementDefinition> new_definition;
+	style_sharing_source.reset();
 
 	if (const StyleSheet* style_sheet = element->GetStyleSheet())
 	{
-		new_definition = style_sheet->GetElementDefinition(element);
+		// Elements such as repeated rows in a list often match the same rules, reuse their definition when possible.
+		if (Element* source = FindStyleSharingSource(element, style_sheet, 0))
+		{
+			new_definition = source->GetStyle()->definition;
+			style_sharing_source = source->GetObserverPtr();
+		}
+		else
+			new_definition = style_sheet->GetElementDefinition(element);
 	}
 
 	// Switch the property definitions if the definition has changed.
@@ -214,6 +236,74 @@ void ElementStyle::UpdateDefinition()
 	}
 }
 
+bool ElementStyle::IsStyleEquivalent(const Element* a, const Element* b, const StyleSheet* style_sheet)
+{
+	// Inline properties are not part of the definition, but we require them to be empty so that the computed values can be shared too. This also
+	// rules out any elements with animations or transitions.
+	const ElementStyle* style_a = a->GetStyle();
+	const ElementStyle* style_b = b->GetStyle();
+	if (style_a->inline_properties.GetNumProperties() > 0 || style_b->inline_properties.GetNumProperties() > 0)
+		return false;
+
+	return b->GetStyleSheet() == style_sheet && style_sheet->IsMatchingEquivalent(a, b);
+}
+
+Element* ElementStyle::FindStyleSharingSource(const Element* element, const StyleSheet* style_sheet, int depth)
+{
+	// Limit the number of ancestors to consider when looking for equivalent cousins.
+	static constexpr int max_depth = 4;
+
+	Element* parent = element->GetParentNode();
+	if (!parent)
+		return nullptr;
+
+	// Elements earlier in document order have already been updated during this pass, unless they were dirtied since.
+	auto IsValidSource = [&](const Element* candidate) {
+		return candidate && !candidate->dirty_definition && !candidate->dirty_own_definition && !candidate->GetStyle()->AnyPropertiesDirty() &&
+			IsStyleEquivalent(element, candidate, style_sheet);
+	};
+
+	// First, look for an equivalent sibling. Siblings have the same ancestors, thus they match the same rules.
+	const int index = element->GetStyle()->GetChildIndex(parent);
+
+	if (index > 0 && IsValidSource(parent->children[index - 1].get()))
+		return parent->children[index - 1].get();
+
+	// Then, look for an equivalent cousin at the same position in an equivalent parent, with equivalent ancestors by induction.
+	if (depth >= max_depth)
+		return nullptr;
+
+	const Element* parent_source = FindStyleSharingSource(parent, style_sheet, depth + 1);
+	if (parent_source && index < (int)parent_source->children.size() && IsValidSource(parent_source->children[index].get()))
+		return parent_source->children[index].get();
+
+	return nullptr;
+}
+
+int ElementStyle::GetChildIndex(const Element* parent)
+{
+	const auto& children = parent->children;
+	const int num_children = (int)children.size();
+
+	// Search outwards from the previous index, siblings are usually only moved by a small number of insertions or removals at a time.
+	const int hint = Math::Clamp(child_index_hint, 0, num_children - 1);
+	for (int distance = 0; hint - distance >= 0 || hint + distance < num_children; distance++)
+	{
+		int index = hint + distance;
+		if (index >= num_children || children[index].get() != element)
+			index = hint - distance;
+
+		if (index >= 0 && children[index].get() == element)
+		{
+			child_index_hint = index;
+			return index;
+		}
+	}
+
+	RMLUI_ERROR;
+	return 0;
+}
+
 // Sets or removes a pseudo-class on the element.
 bool ElementStyle::SetPseudoClass(const String& pseudo_class, bool activate, bool override_class)
 {
@@ -224,6 +314,8 @@ bool ElementStyle::SetPseudoClass(const String& pseudo_class, bool activate, boo
 		PseudoClassState& state = pseudo_classes[pseudo_class];
 		changed = (state == PseudoClassState::Clear);
 		state = (state | (override_class ? PseudoClassState::Override : PseudoClassState::Set));
+		if (changed)
+			pseudo_class_atoms.push_back(AtomTable::GetOrInsert(pseudo_class));
 	}
 	else
 	{
@@ -235,6 +327,8 @@ bool ElementStyle::SetPseudoClass(const String& pseudo_class, bool activate, boo
 			if (state == PseudoClassState::Clear)
 			{
 				pseudo_classes.erase(it);
+				const Atom atom = AtomTable::GetOrInsert(pseudo_class);
+				pseudo_class_atoms.erase(std::find(pseudo_class_atoms.begin(), pseudo_class_atoms.end(), atom));
 				changed = true;
 			}
 		}
@@ -264,6 +358,7 @@ bool ElementStyle::SetClass(const String& class_name, bool activate)
 		if (class_location == classes.end())
 		{
 			classes.push_back(class_name);
+			class_atoms.push_back(AtomTable::GetOrInsert(class_name));
 			changed = true;
 		}
 	}
@@ -271,6 +366,7 @@ bool ElementStyle::SetClass(const String& class_name, bool activate)
 	{
 		if (class_location != classes.end())
 		{
+			class_atoms.erase(class_atoms.begin() + (class_location - classes.begin()));
 			classes.erase(class_location);
 			changed = true;
 		}
@@ -290,6 +386,10 @@ void ElementStyle::SetClassNames(const String& class_names)
 {
 	classes.clear();
 	StringUtilities::ExpandString(classes, class_names, ' ');
+
+	class_atoms.clear();
+	for (const String& name : classes)
+		class_atoms.push_back(AtomTable::GetOrInsert(name));
 }
 
 // Returns the list of classes specified for this element.
@@ -313,6 +413,11 @@ const StringList& ElementStyle::GetClassNameList() const
 	return classes;
 }
 
+void ElementStyle::SetId(const String& id)
+{
+	id_atom = AtomTable::GetOrInsert(id);
+}
+
 // Sets a local property override on the element to a pre-parsed value.
 bool ElementStyle::SetProperty(PropertyId id, const Property& property)
 {
@@ -459,6 +564,9 @@ void ElementStyle::DirtyInheritedProperties()
 
 void ElementStyle::DirtyPropertiesWithUnits(Property::Unit units)
 {
+	if (!(used_units & units))
+		return;
+
 	// Dirty all the properties of this element that use the unit(s).
 	for (auto it = Iterate(); !it.AtEnd(); ++it)
 	{
@@ -472,12 +580,25 @@ void ElementStyle::DirtyPropertiesWithUnits(Property::Unit units)
 
 void ElementStyle::DirtyPropertiesWithUnitsRecursive(Property::Unit units)
 {
+	// Skip subtrees without any properties using the unit(s).
+	if (!(subtree_used_units & units))
+		return;
+
 	DirtyPropertiesWithUnits(units);
 
-	// Now dirty all of our descendant's properties that use the unit(s).
+	// Now dirty all of our descendant's properties that use the unit(s). Meanwhile, narrow down our subtree units in case any properties or
+	// elements using them have been removed.
+	int subtree_units = used_units;
+
 	int num_children = element->GetNumChildren(true);
 	for (int i = 0; i < num_children; ++i)
-		element->GetChild(i)->GetStyle()->DirtyPropertiesWithUnitsRecursive(units);
+	{
+		ElementStyle* child_style = element->GetChild(i)->GetStyle();
+		child_style->DirtyPropertiesWithUnitsRecursive(units);
+		subtree_units |= child_style->subtree_used_units;
+	}
+
+	subtree_used_units = subtree_units;
 }
 
 bool ElementStyle::AnyPropertiesDirty() const 
@@ -527,29 +648,61 @@ PropertyIdSet ElementStyle::ComputeValues(Style::ComputedValues& values, const S
 
 	RMLUI_ZoneScopedC(0xFF7F50);
 
+	// The source of our definition has equal inputs and equivalent ancestors, thus it also has the same computed values. Newly created elements can
+	// simply copy them. Their dirty properties cover every non-default value, we just need to add the ones derived from the font size.
+	const Element* source = style_sharing_source.get();
+	style_sharing_source.reset();
+
+	if (source && values_are_default_initialized && !source->GetStyle()->AnyPropertiesDirty())
+	{
+		const Style::ComputedValues& source_values = source->GetComputedValues();
+		values.CopyNonInherited(source_values);
+		values.CopyInherited(source_values);
+
+		if (dirty_properties.Contains(PropertyId::FontSize))
+			dirty_properties.Insert(PropertyId::LineHeight);
+		if (dirty_properties.Contains(PropertyId::LineHeight))
+			dirty_properties.Insert(PropertyId::VerticalAlign);
+
+		SetUsedUnits(source->GetStyle()->used_units);
+
+		return TakeDirtyProperties();
+	}
+
 	// Generally, this is how it works:
-	//   1. Assign default values (clears any removed properties)
+	//   1. Assign default values to the dirty, non-inherited properties (clears any removed properties)
 	//   2. Inherit inheritable values from parent
-	//   3. Assign any local properties (from inline style or stylesheet)
+	//   3. Assign the dirty local properties (from inline style or stylesheet)
 	//   4. Dirty properties in children that are inherited
+	// Properties which are not dirty keep their previously computed value. Changes to the values they depend on mark them dirty: The font-size
+	// for 'em' units below, while 'rem', 'vw', 'vh', and 'dp' units are dirtied through DirtyPropertiesWithUnits() when those values change.
 
 	const float font_size_before = values.font_size();
 	const Style::LineHeight line_height_before = values.line_height();
 
-	// The next flag is just a small optimization, if the element was just created we don't need to copy all the default values.
+	// Copying the inherited values replaces all of them, so any local inherited properties need to be re-applied afterwards.
+	const bool inherit_values =
+		(values_are_default_initialized || !(dirty_properties & StyleSheetSpecification::GetRegisteredInheritedProperties()).Empty());
+
+	// The next flag is just a small optimization, if the element was just created we don't need to reset any values.
 	if (!values_are_default_initialized)
 	{
 		// This needs to be done in case some properties were removed and thus not in our local style anymore.
 		// If we skipped this, the old dirty value would be unmodified, instead, now it is set to its default value.
-		// Strictly speaking, we only really need to do this for the dirty, non-inherited values. However, in most
-		// cases it seems simply assigning all non-inherited values is faster than iterating the dirty properties.
-		values.CopyNonInherited(DefaultComputedValues);
+		for (const PropertyId id : dirty_properties)
+		{
+			if (auto reset = GetPropertyComputeFunctions(id).reset)
+				reset(values);
+		}
 	}
 
-	if (parent_values)
-		values.CopyInherited(*parent_values);
-	else if (!values_are_default_initialized)
-		values.CopyInherited(DefaultComputedValues);
+	if (inherit_values)
+	{
+		if (parent_values)
+			values.CopyInherited(*parent_values);
+		else if (!values_are_default_initialized)
+			values.CopyInherited(DefaultComputedValues);
+	}
 
 	bool dirty_em_properties = false;
 
@@ -567,7 +720,7 @@ PropertyIdSet ElementStyle::ComputeValues(Style::ComputedValues& values, const S
 			dirty_properties.Insert(PropertyId::LineHeight);
 		}
 	}
-	else
+	else if (values.font_size() != font_size_before)
 	{
 		values.font_size(font_size_before);
 	}
@@ -598,10 +751,17 @@ PropertyIdSet ElementStyle::ComputeValues(Style::ComputedValues& values, const S
 	}
 	else
 	{
-		values.line_height(line_height_before);
+		const Style::LineHeight line_height = values.line_height();
+		if (line_height.value != line_height_before.value || line_height.inherit_type != line_height_before.inherit_type ||
+			line_height.inherit_value != line_height_before.inherit_value)
+			values.line_height(line_height_before);
 	}
 
+	const PropertyComputeContext context = {font_size, document_font_size, dp_ratio, vp_dimensions, values.line_height().value};
+	const PropertyIdSet& inherited_properties = StyleSheetSpecification::GetRegisteredInheritedProperties();
+
 	bool dirty_font_face_handle = false;
+	int units = 0;
 
 	for (auto it = Iterate(); !it.AtEnd(); ++it)
 	{
@@ -609,285 +769,50 @@ PropertyIdSet ElementStyle::ComputeValues(Style::ComputedValues& values, const S
 		const PropertyId id = name_property_pair.first;
 		const Property* p = &name_property_pair.second;
 
+		units |= p->unit;
+
 		if (dirty_em_properties && p->unit == Property::EM)
 			dirty_properties.Insert(id);
 
-		using namespace Style;
+		if (!dirty_properties.Contains(id) && !(inherit_values && inherited_properties.Contains(id)))
+			continue;
 
 		switch (id)
 		{
-		case PropertyId::MarginTop:
-			values.margin_top(ComputeLengthPercentageAuto(p, font_size, document_font_size, dp_ratio, vp_dimensions));
-			break;
-		case PropertyId::MarginRight:
-			values.margin_right(ComputeLengthPercentageAuto(p, font_size, document_font_size, dp_ratio, vp_dimensions));
-			break;
-		case PropertyId::MarginBottom:
-			values.margin_bottom(ComputeLengthPercentageAuto(p, font_size, document_font_size, dp_ratio, vp_dimensions));
-			break;
-		case PropertyId::MarginLeft:
-			values.margin_left(ComputeLengthPercentageAuto(p, font_size, document_font_size, dp_ratio, vp_dimensions));
-			break;
-
-		case PropertyId::PaddingTop:
-			values.padding_top(ComputeLengthPercentage(p, font_size, document_font_size, dp_ratio, vp_dimensions));
-			break;
-		case PropertyId::PaddingRight:
-			values.padding_right(ComputeLengthPercentage(p, font_size, document_font_size, dp_ratio, vp_dimensions));
-			break;
-		case PropertyId::PaddingBottom:
-			values.padding_bottom(ComputeLengthPercentage(p, font_size, document_font_size, dp_ratio, vp_dimensions));
-			break;
-		case PropertyId::PaddingLeft:
-			values.padding_left(ComputeLengthPercentage(p, font_size, document_font_size, dp_ratio, vp_dimensions));
-			break;
-
-		case PropertyId::BorderTopWidth:
-			values.border_top_width(ComputeBorderWidth(ComputeLength(p, font_size, document_font_size, dp_ratio, vp_dimensions)));
-			break;
-		case PropertyId::BorderRightWidth:
-			values.border_right_width(ComputeBorderWidth(ComputeLength(p, font_size, document_font_size, dp_ratio, vp_dimensions)));
-			break;
-		case PropertyId::BorderBottomWidth:
-			values.border_bottom_width(ComputeBorderWidth(ComputeLength(p, font_size, document_font_size, dp_ratio, vp_dimensions)));
-			break;
-		case PropertyId::BorderLeftWidth:
-			values.border_left_width(ComputeBorderWidth(ComputeLength(p, font_size, document_font_size, dp_ratio, vp_dimensions)));
-			break;
-
-		case PropertyId::BorderTopColor:
-			values.border_top_color(p->Get<Colourb>());
-			break;
-		case PropertyId::BorderRightColor:
-			values.border_right_color(p->Get<Colourb>());
-			break;
-		case PropertyId::BorderBottomColor:
-			values.border_bottom_color(p->Get<Colourb>());
-			break;
-		case PropertyId::BorderLeftColor:
-			values.border_left_color(p->Get<Colourb>());
-			break;
-
-		case PropertyId::BorderTopLeftRadius:
-			values.border_top_left_radius(ComputeLength(p, font_size, document_font_size, dp_ratio, vp_dimensions));
-			break;
-		case PropertyId::BorderTopRightRadius:
-			values.border_top_right_radius(ComputeLength(p, font_size, document_font_size, dp_ratio, vp_dimensions));
-			break;
-		case PropertyId::BorderBottomRightRadius:
-			values.border_bottom_right_radius(ComputeLength(p, font_size, document_font_size, dp_ratio, vp_dimensions));
-			break;
-		case PropertyId::BorderBottomLeftRadius:
-			values.border_bottom_left_radius(ComputeLength(p, font_size, document_font_size, dp_ratio, vp_dimensions));
-			break;
-
-		case PropertyId::Display:
-			values.display((Display)p->Get<int>());
-			break;
-		case PropertyId::Position:
-			values.position((Position)p->Get<int>());
-			break;
-
-		case PropertyId::Top:
-			values.top(ComputeLengthPercentageAuto(p, font_size, document_font_size, dp_ratio, vp_dimensions));
-			break;
-		case PropertyId::Right:
-			values.right(ComputeLengthPercentageAuto(p, font_size, document_font_size, dp_ratio, vp_dimensions));
-			break;
-		case PropertyId::Bottom:
-			values.bottom(ComputeLengthPercentageAuto(p, font_size, document_font_size, dp_ratio, vp_dimensions));
-			break;
-		case PropertyId::Left:
-			values.left(ComputeLengthPercentageAuto(p, font_size, document_font_size, dp_ratio, vp_dimensions));
-			break;
-
-		case PropertyId::Float:
-			values.float_((Float)p->Get<int>());
-			break;
-		case PropertyId::Clear:
-			values.clear((Clear)p->Get<int>());
-			break;
-		case PropertyId::BoxSizing:
-			values.box_sizing((BoxSizing)p->Get<int>());
-			break;
-
-		case PropertyId::ZIndex:
-			values.z_index((p->unit == Property::KEYWORD ? ZIndex(ZIndex::Auto) : ZIndex(ZIndex::Number, p->Get<float>())));
-			break;
-
-		case PropertyId::Width:
-			values.width(ComputeLengthPercentageAuto(p, font_size, document_font_size, dp_ratio, vp_dimensions));
-			break;
-		case PropertyId::MinWidth:
-			values.min_width(ComputeLengthPercentage(p, font_size, document_font_size, dp_ratio, vp_dimensions));
-			break;
-		case PropertyId::MaxWidth:
-			values.max_width(ComputeMaxSize(p, font_size, document_font_size, dp_ratio, vp_dimensions));
-			break;
-
-		case PropertyId::Height:
-			values.height(ComputeLengthPercentageAuto(p, font_size, document_font_size, dp_ratio, vp_dimensions));
-			break;
-		case PropertyId::MinHeight:
-			values.min_height(ComputeLengthPercentage(p, font_size, document_font_size, dp_ratio, vp_dimensions));
-			break;
-		case PropertyId::MaxHeight:
-			values.max_height(ComputeMaxSize(p, font_size, document_font_size, dp_ratio, vp_dimensions));
-			break;
-
-		case PropertyId::LineHeight:
-			// (Line-height computed above)
-			break;
-		case PropertyId::VerticalAlign:
-			values.vertical_align(ComputeVerticalAlign(p, values.line_height().value, font_size, document_font_size, dp_ratio, vp_dimensions));
-			break;
-
-		case PropertyId::OverflowX:
-			values.overflow_x((Overflow)p->Get< int >());
-			break;
-		case PropertyId::OverflowY:
-			values.overflow_y((Overflow)p->Get< int >());
-			break;
-		case PropertyId::Clip:
-			values.clip(ComputeClip(p));
-			break;
-		case PropertyId::Visibility:
-			values.visibility((Visibility)p->Get< int >());
-			break;
-
-		case PropertyId::BackgroundColor:
-			values.background_color(p->Get<Colourb>());
-			break;
-		case PropertyId::Color:
-			values.color(p->Get<Colourb>());
-			break;
-		case PropertyId::ImageColor:
-			values.image_color(p->Get<Colourb>());
-			break;
-		case PropertyId::Opacity:
-			values.opacity(p->Get<float>());
-			break;
-
 		case PropertyId::FontFamily:
-			// Fetched from element's properties.
-			dirty_font_face_handle = true;
-			break;
 		case PropertyId::FontStyle:
-			values.font_style((FontStyle)p->Get< int >());
-			dirty_font_face_handle = true;
-			break;
 		case PropertyId::FontWeight:
-			values.font_weight((FontWeight)p->Get< int >());
-			dirty_font_face_handle = true;
-			break;
 		case PropertyId::FontSize:
-			// (font-size computed above)
 			dirty_font_face_handle = true;
 			break;
-
-		case PropertyId::TextAlign:
-			values.text_align((TextAlign)p->Get<int>());
-			break;
-		case PropertyId::TextDecoration:
-			values.text_decoration((TextDecoration)p->Get<int>());
-			break;
-		case PropertyId::TextTransform:
-			values.text_transform((TextTransform)p->Get<int>());
-			break;
-		case PropertyId::WhiteSpace:
-			values.white_space((WhiteSpace)p->Get<int>());
-			break;
-		case PropertyId::WordBreak:
-			values.word_break((WordBreak)p->Get<int>());
-			break;
-
-		case PropertyId::RowGap:
-			values.row_gap(ComputeLengthPercentage(p, font_size, document_font_size, dp_ratio, vp_dimensions));
-			break;
-		case PropertyId::ColumnGap:
-			values.column_gap(ComputeLengthPercentage(p, font_size, document_font_size, dp_ratio, vp_dimensions));
-			break;
-
-		case PropertyId::Drag:
-			values.drag((Drag)p->Get< int >());
-			break;
-		case PropertyId::TabIndex:
-			values.tab_index((TabIndex)p->Get< int >());
-			break;
-		case PropertyId::Focus:
-			values.focus((Focus)p->Get<int>());
-			break;
-		case PropertyId::ScrollbarMargin:
-			values.scrollbar_margin(ComputeLength(p, font_size, document_font_size, dp_ratio, vp_dimensions));
-			break;
-		case PropertyId::PointerEvents:
-			values.pointer_events((PointerEvents)p->Get<int>());
-			break;
-
-		case PropertyId::Perspective:
-			values.perspective(ComputeLength(p, font_size, document_font_size, dp_ratio, vp_dimensions));
-			break;
-		case PropertyId::PerspectiveOriginX:
-			values.perspective_origin_x(ComputeOrigin(p, font_size, document_font_size, dp_ratio, vp_dimensions));
-			break;
-		case PropertyId::PerspectiveOriginY:
-			values.perspective_origin_y(ComputeOrigin(p, font_size, document_font_size, dp_ratio, vp_dimensions));
-			break;
-
-		case PropertyId::TransformOriginX:
-			values.transform_origin_x(ComputeOrigin(p, font_size, document_font_size, dp_ratio, vp_dimensions));
-			break;
-		case PropertyId::TransformOriginY:
-			values.transform_origin_y(ComputeOrigin(p, font_size, document_font_size, dp_ratio, vp_dimensions));
-			break;
-		case PropertyId::TransformOriginZ:
-			values.transform_origin_z(ComputeLength(p, font_size, document_font_size, dp_ratio, vp_dimensions));
-			break;
-
-		case PropertyId::Decorator:
-			values.has_decorator(p->unit == Property::DECORATOR);
-			break;
-		case PropertyId::FontEffect:
-			values.has_font_effect((p->unit == Property::FONTEFFECT));
-			break;
-		case PropertyId::FlexBasis:
-			values.flex_basis(ComputeLengthPercentageAuto(p, font_size, document_font_size, dp_ratio, vp_dimensions));
-			break;
-
-		// Fetched from element's properties.
-		case PropertyId::Cursor:
-		case PropertyId::Transform:
-		case PropertyId::Transition:
-		case PropertyId::Animation:
-		case PropertyId::AlignContent:
-		case PropertyId::AlignItems:
-		case PropertyId::AlignSelf:
-		case PropertyId::FlexDirection:
-		case PropertyId::FlexGrow:
-		case PropertyId::FlexShrink:
-		case PropertyId::FlexWrap:
-		case PropertyId::JustifyContent:
-			break;
-		// Unhandled properties. Must be manually retrieved with 'GetProperty()'.
-		case PropertyId::FillImage:
-		case PropertyId::CaretColor:
-			break;
-		// Invalid properties
-		case PropertyId::Invalid:
-		case PropertyId::NumDefinedIds:
-		case PropertyId::MaxNumIds:
+		default:
 			break;
 		}
+
+		if (auto compute = GetPropertyComputeFunctions(id).compute)
+			compute(values, p, context);
 	}
 
+	SetUsedUnits(units);
+
 	// The font-face handle is nulled when local font properties are set. In that case we need to retrieve a new handle.
 	if (dirty_font_face_handle)
 	{
 		RMLUI_ZoneScopedN("FontFaceHandle");
-		values.font_face_handle(
-			GetFontEngineInterface()->GetFontFaceHandle(values.font_family(), values.font_style(), values.font_weight(), (int)values.font_size()));
+		const FontFaceHandle font_face_handle =
+			GetFontEngineInterface()->GetFontFaceHandle(values.font_family(), values.font_style(), values.font_weight(), (int)values.font_size());
+		if (font_face_handle != values.font_face_handle())
+			values.font_face_handle(font_face_handle);
 	}
 
+	// Let elements with identical values refer to the same groups of values, and let our children inherit our values by reference.
+	values.ShareValues();
+
+	return TakeDirtyProperties();
+}
+
+PropertyIdSet ElementStyle::TakeDirtyProperties()
+{
 	// Next, pass inheritable dirty properties onto our children
 	PropertyIdSet dirty_inherited_properties = (dirty_properties & StyleSheetSpecification::GetRegisteredInheritedProperties());
 
@@ -905,4 +830,19 @@ PropertyIdSet ElementStyle::ComputeValues(Style::ComputedValues& values, const S
 	return result;
 }
 
+void ElementStyle::SetUsedUnits(int units)
+{
+	used_units = units;
+	subtree_used_units |= units;
+
+	// Our subtree may have just been attached to a new parent, so always check the ancestors. Stop as soon as they already contain our units.
+	for (Element* ancestor = element->GetParentNode(); ancestor; ancestor = ancestor->GetParentNode())
+	{
+		ElementStyle* ancestor_style = ancestor->GetStyle();
+		if ((ancestor_style->subtree_used_units & subtree_used_units) == subtree_used_units)
+			break;
+		ancestor_style->subtree_used_units |= subtree_used_units;
+	}
+}
+
 } // namespace Rml
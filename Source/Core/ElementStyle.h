@@ -33,11 +33,15 @@
 #include "../../Include/RmlUi/Core/Types.h"
 #include "../../Include/RmlUi/Core/PropertyIdSet.h"
 #include "../../Include/RmlUi/Core/PropertyDictionary.h"
+#include "AncestorFilter.h"
+#include "Atom.h"
+#include <algorithm>
 
 namespace Rml {
 
 class ElementDefinition;
 class PropertiesIterator;
+class StyleSheet;
 enum class RelativeTarget;
 
 enum class PseudoClassState : std::uint8_t { Clear = 0, Set = 1, Override = 2 };
@@ -91,6 +95,28 @@ public:
 	/// Return the active class list.
 	const StringList& GetClassNameList() const;
 
+	/// Updates the interned id after the id of the element has changed.
+	void SetId(const String& id);
+
+	/// Returns the interned tag of the element.
+	Atom GetTagAtom() const { return tag_atom; }
+	/// Returns the interned id of the element, or Atom::None if the element has no id.
+	Atom GetIdAtom() const { return id_atom; }
+	/// Returns the interned active class list.
+	const Vector<Atom>& GetClassAtoms() const { return class_atoms; }
+	/// Returns the interned active pseudo-class list, in the order they were set.
+	const Vector<Atom>& GetPseudoClassAtoms() const { return pseudo_class_atoms; }
+	/// Checks if a class is set on the element, by its interned name.
+	bool IsClassSet(Atom class_name) const { return std::find(class_atoms.begin(), class_atoms.end(), class_name) != class_atoms.end(); }
+	/// Returns the filter of all the tags, ids, and classes set on the element's ancestors.
+	/// @note Only valid after the definition is updated, and it is only updated along with the definition.
+	const AncestorFilter& GetAncestorFilter() const { return ancestor_filter; }
+	/// Checks if a pseudo-class is set on the element, by its interned name.
+	bool IsPseudoClassSet(Atom pseudo_class) const
+	{
+		return std::find(pseudo_class_atoms.begin(), pseudo_class_atoms.end(), pseudo_class) != pseudo_class_atoms.end();
+	}
+
 	/// Sets a local property override on the element to a pre-parsed value.
 	/// @param[in] name The name of the new property.
 	/// @param[in] property The parsed property to set.
@@ -131,6 +157,7 @@ public:
 	/// Dirties all properties with any of the given units (OR-ed together) on the current element (*not* recursive).
 	void DirtyPropertiesWithUnits(Property::Unit units);
 	/// Dirties all properties with any of the given units (OR-ed together) on the current element and recursively on all children.
+	/// @note Only subtrees which use the units according to the unit-usage index are visited.
 	void DirtyPropertiesWithUnitsRecursive(Property::Unit units);
 
 	/// Returns true if any properties are dirty such that computed values need to be recomputed
@@ -148,6 +175,19 @@ private:
 	// Sets a list of properties as dirty.
 	void DirtyProperties(const PropertyIdSet& properties);
 
+	// Pass dirty inherited properties onto our children, then return and clear all dirty properties.
+	PropertyIdSet TakeDirtyProperties();
+
+	// Sets the units used by our local properties, and adds our subtree's units to the unit-usage index of our ancestors.
+	void SetUsedUnits(int units);
+
+	// Returns true if the style of the two elements can be shared, assuming their ancestors are equivalent or the same.
+	static bool IsStyleEquivalent(const Element* a, const Element* b, const StyleSheet* style_sheet);
+	// Finds an element already updated in document order, which is guaranteed to get the same definition and computed values as the given element.
+	static Element* FindStyleSharingSource(const Element* element, const StyleSheet* style_sheet, int depth);
+	// Returns the index of our element among the children of its parent.
+	int GetChildIndex(const Element* parent);
+
 	static const Property* GetLocalProperty(PropertyId id, const PropertyDictionary & inline_properties, const ElementDefinition * definition);
 	static const Property* GetProperty(PropertyId id, const Element * element, const PropertyDictionary & inline_properties, const ElementDefinition * definition);
 	static void TransitionPropertyChanges(Element * element, PropertyIdSet & properties, const PropertyDictionary & inline_properties, const ElementDefinition * old_definition, const ElementDefinition * new_definition);
@@ -160,12 +200,29 @@ private:
 	// This element's current pseudo-classes.
 	PseudoClassMap pseudo_classes;
 
+	// Interned names of the element, the atom lists are kept in sync with their respective class and pseudo-class containers above.
+	Atom tag_atom;
+	Atom id_atom = Atom::None;
+	Vector<Atom> class_atoms;
+	Vector<Atom> pseudo_class_atoms;
+	AncestorFilter ancestor_filter;
+
 	// Any properties that have been overridden in this element.
 	PropertyDictionary inline_properties;
 	// The definition of this element, provides applicable properties from the stylesheet.
 	SharedPtr<const ElementDefinition> definition;
+	// An equivalent element our definition was shared from during the last definition update, its computed values can also be shared.
+	ObserverPtr<Element> style_sharing_source;
+	// Our index among the parent's children when last looked up. Used as the starting point of the next lookup, so that it stays cheap even when
+	// nearby siblings have been inserted or removed since.
+	int child_index_hint = 0;
 
 	PropertyIdSet dirty_properties;
+
+	// Unit-usage index: The units (OR-ed together) used by our local properties as of the last computed values, and the units used anywhere
+	// in our subtree including ourself. The subtree units may be a superset of the actual units, they are narrowed down during recursive dirtying.
+	int used_units = 0;
+	int subtree_used_units = 0;
 };
 
 } // namespace Rml
@@ -38,6 +38,7 @@
 #include "../../Include/RmlUi/Core/GeometryUtilities.h"
 #include "../../Include/RmlUi/Core/Property.h"
 #include "../../Include/RmlUi/Core/Profiling.h"
+#include <algorithm>
 
 namespace Rml {
 
@@ -45,7 +46,9 @@ static bool BuildToken(String& token, const char*& token_begin, const char* stri
 static bool LastToken(const char* token_begin, const char* string_end, bool collapse_white_space, bool break_at_endline);
 
 ElementText::ElementText(const String& tag) :
-	Element(tag), colour(255, 255, 255), opacity(1), font_handle_version(0), geometry_dirty(true), dirty_layout_on_change(true),
+	Element(tag), tokens_font_face_handle(0), tokens_font_version(0), tokens_text_transform(Style::TextTransform::None), tokens_dirty(true),
+	tokens_collapse_white_space(false), tokens_break_at_endline(false), tokens_decode_escape_characters(false), colour(255, 255, 255), opacity(1),
+	font_handle_version(0), geometry_dirty(true), dirty_layout_on_change(true),
 	generated_decoration(Style::TextDecoration::None), decoration_property(Style::TextDecoration::None), font_effects_dirty(true),
 	font_effects_handle(0)
 {}
@@ -57,6 +60,7 @@ void ElementText::SetText(const String& _text)
 	if (text != _text)
 	{
 		text = _text;
+		tokens_dirty = true;
 
 		if (dirty_layout_on_change)
 			DirtyLayout();
@@ -157,7 +161,7 @@ void ElementText::OnRender()
 }
 
 // Generates a token of text from this element, returning only the width.
-bool ElementText::GenerateToken(float& token_width, int line_begin)
+bool ElementText::GenerateToken(float& token_width, int line_begin, bool decode_escape_characters)
 {
 	RMLUI_ZoneScoped;
 
@@ -177,10 +181,24 @@ bool ElementText::GenerateToken(float& token_width, int line_begin)
 							white_space_property == WhiteSpace::Prewrap ||
 							white_space_property == WhiteSpace::Preline;
 
+	UpdateTokens(font_face_handle, collapse_white_space, break_at_endline, computed.text_transform(), decode_escape_characters);
+
+	const size_t token_index = FindToken(line_begin);
+	if (token_index < tokens.size() && tokens[token_index].begin == line_begin)
+	{
+		TextToken& token = tokens[token_index];
+		int width = 0;
+		MeasureToken(token, width, font_face_handle, true, Character::Null);
+		token_width = (float)width;
+
+		return token.last_token;
+	}
+
 	const char* token_begin = text.c_str() + line_begin;
 	String token;
 
-	BuildToken(token, token_begin, text.c_str() + text.size(), true, collapse_white_space, break_at_endline, computed.text_transform(), true);
+	BuildToken(token, token_begin, text.c_str() + text.size(), true, collapse_white_space, break_at_endline, computed.text_transform(),
+		decode_escape_characters);
 	token_width = (float) GetFontEngineInterface()->GetStringWidth(font_face_handle, token);
 
 	return LastToken(token_begin, text.c_str() + text.size(), collapse_white_space, break_at_endline);
@@ -222,27 +240,50 @@ bool ElementText::GenerateLine(String& line, int& line_length, float& line_width
 
 	FontEngineInterface* font_engine_interface = GetFontEngineInterface();
 
-	// Starting at the line_begin character, we generate sections of the text (we'll call them tokens) depending on the
-	// white-space parsing parameters. Each section is then appended to the line if it can fit. If not, or if an
-	// endline is found (and we're processing them), then the line is ended. kthxbai!
-	const char* token_begin = text.c_str() + line_begin;
-	const char* string_end = text.c_str() + text.size();
+	// The text is split into sections (we'll call them tokens) depending on the white-space parsing parameters. The
+	// tokens are built once for the text and reused for every line layout, so that re-wrapping the text at a new width
+	// only needs to walk through the token widths.
+	UpdateTokens(font_face_handle, collapse_white_space, break_at_endline, text_transform_property, decode_escape_characters);
+
+	// Starting at the line_begin character, each token is appended to the line if it can fit. If not, or if an endline
+	// is found (and we're processing them), then the line is ended. kthxbai!
+	const char* string_begin = text.c_str();
+	const char* token_begin = string_begin + line_begin;
+	const char* string_end = string_begin + text.size();
+	size_t token_index = FindToken(line_begin);
 	while (token_begin != string_end)
 	{
-		String token;
+		String built_token;
+		const String* token = &built_token;
 		const char* next_token_begin = token_begin;
 		Character previous_codepoint = Character::Null;
 		if (!line.empty())
 			previous_codepoint = StringUtilities::ToCharacter(StringUtilities::SeekBackwardUTF8(&line.back(), line.data()));
 
-		// Generate the next token and determine its pixel-length.
-		bool break_line = BuildToken(token, next_token_begin, string_end, line.empty() && trim_whitespace_prefix, collapse_white_space, break_at_endline, text_transform_property, decode_escape_characters);
-		int token_width = font_engine_interface->GetStringWidth(font_face_handle, token, previous_codepoint);
+		// Use the pre-built token if one begins here, otherwise generate the token from the text. This happens when the
+		// line begins with the remainder of a word that was broken up on the previous line.
+		TextToken* cached_token = nullptr;
+		if (token_index < tokens.size() && tokens[token_index].begin == int(token_begin - string_begin))
+			cached_token = &tokens[token_index];
+
+		bool break_line;
+		int token_width;
+		if (cached_token)
+		{
+			token = &MeasureToken(*cached_token, token_width, font_face_handle, line.empty() && trim_whitespace_prefix, previous_codepoint);
+			next_token_begin = string_begin + cached_token->end;
+			break_line = cached_token->break_line;
+		}
+		else
+		{
+			break_line = BuildToken(built_token, next_token_begin, string_end, line.empty() && trim_whitespace_prefix, collapse_white_space, break_at_endline, text_transform_property, decode_escape_characters);
+			token_width = font_engine_interface->GetStringWidth(font_face_handle, built_token, previous_codepoint);
+		}
 
 		// If we're breaking to fit a line box, check if the token can fit on the line before we add it.
 		if (break_at_line)
 		{
-			const bool is_last_token = LastToken(next_token_begin, string_end, collapse_white_space, break_at_endline);
+			const bool is_last_token = (cached_token ? cached_token->last_token : LastToken(next_token_begin, string_end, collapse_white_space, break_at_endline));
 			int max_token_width = int(maximum_line_width - (is_last_token ? line_width + right_spacing_width : line_width));
 
 			if (token_width > max_token_width)
@@ -257,11 +298,12 @@ bool ElementText::GenerateLine(String& line, int& line_length, float& line_width
 					// @performance: Can be made much faster. Use string width heuristics and logarithmic search.
 					for (int i = token_max_size - 1; i > 0; --i)
 					{
-						token.clear();
+						built_token.clear();
+						token = &built_token;
 						next_token_begin = token_begin;
 						const char* partial_string_end = StringUtilities::SeekBackwardUTF8(token_begin + i, token_begin);
-						BuildToken(token, next_token_begin, partial_string_end, line.empty() && trim_whitespace_prefix, collapse_white_space, break_at_endline, text_transform_property, decode_escape_characters);
-						token_width = font_engine_interface->GetStringWidth(font_face_handle, token, previous_codepoint);
+						BuildToken(built_token, next_token_begin, partial_string_end, line.empty() && trim_whitespace_prefix, collapse_white_space, break_at_endline, text_transform_property, decode_escape_characters);
+						token_width = font_engine_interface->GetStringWidth(font_face_handle, built_token, previous_codepoint);
 
 						if (force_loop_break_after_next || token_width <= max_token_width)
 						{
@@ -290,7 +332,7 @@ bool ElementText::GenerateLine(String& line, int& line_length, float& line_width
 		}
 
 		// The token can fit on the end of the line, so add it onto the end and increment our width and length counters.
-		line += token;
+		line += *token;
 		line_length += (int)(next_token_begin - token_begin);
 		line_width += token_width;
 
@@ -300,11 +342,109 @@ bool ElementText::GenerateLine(String& line, int& line_length, float& line_width
 
 		// Set the beginning of the next token.
 		token_begin = next_token_begin;
+		token_index = (cached_token ? token_index + 1 : FindToken(int(token_begin - string_begin)));
 	}
 
 	return true;
 }
 
+void ElementText::UpdateTokens(FontFaceHandle font_face_handle, bool collapse_white_space, bool break_at_endline, Style::TextTransform text_transform, bool decode_escape_characters)
+{
+	if (tokens_dirty || tokens_collapse_white_space != collapse_white_space || tokens_break_at_endline != break_at_endline ||
+		tokens_text_transform != text_transform || tokens_decode_escape_characters != decode_escape_characters)
+	{
+		RMLUI_ZoneScopedN("BuildTextTokens");
+
+		tokens_dirty = false;
+		tokens_collapse_white_space = collapse_white_space;
+		tokens_break_at_endline = break_at_endline;
+		tokens_text_transform = text_transform;
+		tokens_decode_escape_characters = decode_escape_characters;
+		tokens_font_face_handle = 0;
+
+		tokens.clear();
+
+		const char* string_begin = text.c_str();
+		const char* string_end = string_begin + text.size();
+		const char* token_begin = string_begin;
+		String token;
+
+		while (token_begin != string_end)
+		{
+			const char* token_end = token_begin;
+			token.clear();
+
+			TextToken text_token;
+			text_token.break_line = BuildToken(token, token_end, string_end, false, collapse_white_space, break_at_endline, text_transform, decode_escape_characters);
+			text_token.begin = int(token_begin - string_begin);
+			text_token.end = int(token_end - string_begin);
+			text_token.string = token;
+			text_token.first_string_built = false;
+			text_token.last_token = LastToken(token_end, string_end, collapse_white_space, break_at_endline);
+			text_token.width_prior = Character::Null;
+			text_token.width = -1;
+			text_token.first_width = -1;
+
+			tokens.push_back(std::move(text_token));
+			token_begin = token_end;
+		}
+	}
+
+	// Token widths are only valid for the font version they were measured with, since glyphs may be provided by
+	// fallback fonts added in the meantime.
+	const int font_version = GetFontEngineInterface()->GetVersion(font_face_handle);
+	if (tokens_font_face_handle != font_face_handle || tokens_font_version != font_version)
+	{
+		tokens_font_face_handle = font_face_handle;
+		tokens_font_version = font_version;
+
+		for (TextToken& token : tokens)
+		{
+			token.width = -1;
+			token.first_width = -1;
+		}
+	}
+}
+
+size_t ElementText::FindToken(int offset) const
+{
+	auto it = std::lower_bound(tokens.begin(), tokens.end(), offset, [](const TextToken& token, int offset) { return token.begin < offset; });
+	return size_t(it - tokens.begin());
+}
+
+const String& ElementText::MeasureToken(TextToken& token, int& token_width, FontFaceHandle font_face_handle, bool first_token, Character previous_codepoint)
+{
+	FontEngineInterface* font_engine_interface = GetFontEngineInterface();
+
+	if (first_token)
+	{
+		if (!token.first_string_built)
+		{
+			// The trimmed token only differs by its white-space prefix, but is otherwise built the same way.
+			const char* token_begin = text.c_str() + token.begin;
+			String first_string;
+			BuildToken(first_string, token_begin, text.c_str() + text.size(), true, tokens_collapse_white_space, tokens_break_at_endline, tokens_text_transform, tokens_decode_escape_characters);
+			token.first_string = first_string;
+			token.first_string_built = true;
+		}
+
+		if (token.first_width < 0)
+			token.first_width = font_engine_interface->GetStringWidth(font_face_handle, token.first_string);
+
+		token_width = token.first_width;
+		return token.first_string;
+	}
+
+	if (token.width < 0 || token.width_prior != previous_codepoint)
+	{
+		token.width = font_engine_interface->GetStringWidth(font_face_handle, token.string, previous_codepoint);
+		token.width_prior = previous_codepoint;
+	}
+
+	token_width = token.width;
+	return token.string;
+}
+
 // Clears all lines of generated text and prepares the element for generating new lines.
 void ElementText::ClearLines()
 {
@@ -384,6 +524,7 @@ void ElementText::OnPropertyChange(const PropertyIdSet& changed_properties)
 		font_effects_handle = 0;
 		font_effects_dirty = true;
 		font_handle_version = 0;
+		tokens_font_face_handle = 0;
 	}
 
 	if (changed_properties.Contains(PropertyId::FontEffect))
@@ -40,6 +40,7 @@
 #include "ElementStyle.h"
 #include "LayoutDetails.h"
 #include "LayoutEngine.h"
+#include "RenderBatcher.h"
 #include "TransformState.h"
 #include <limits>
 
@@ -287,6 +288,14 @@ void ElementUtilities::ApplyActiveClipRegion(Context* context, RenderInterface*
 	Vector2i dimensions;
 	bool clip_enabled = context->GetActiveClipRegion(origin, dimensions);
 
+	if (RenderBatcher* render_batcher = context->GetActiveRenderBatcher())
+	{
+		render_batcher->EnableScissorRegion(clip_enabled);
+		if (clip_enabled)
+			render_batcher->SetScissorRegion(origin, dimensions);
+		return;
+	}
+
 	render_interface->EnableScissorRegion(clip_enabled);
 	if (clip_enabled)
 	{
@@ -355,6 +364,19 @@ bool ElementUtilities::ApplyTransform(Element &element)
 	if (const TransformState* state = element.GetTransformState())
 		new_transform = state->GetTransform();
 
+	// The render batcher does its own filtering of redundant transforms, and needs to know the transform of every element.
+	Context* context = element.GetContext();
+	if (RenderBatcher* render_batcher = (context ? context->GetActiveRenderBatcher() : nullptr))
+	{
+		render_batcher->SetTransform(new_transform);
+
+		// Keep the previous transform in sync, as the render interface will receive the transform when the batch is submitted.
+		if (new_transform)
+			it->second.value = *new_transform;
+		old_transform = new_transform;
+		return true;
+	}
+
 	// Only changed transforms are submitted.
 	if (old_transform != new_transform)
 	{
@@ -57,6 +57,20 @@ void FontEffect::GenerateGlyphTexture(byte* RMLUI_UNUSED_PARAMETER(destination_d
 	RMLUI_UNUSED(glyph);
 }
 
+FontEffect::DistanceFieldOutput FontEffect::GetDistanceFieldOutput() const
+{
+	return DistanceFieldOutput::None;
+}
+
+void FontEffect::GenerateGlyphDistanceFieldTexture(byte* RMLUI_UNUSED_PARAMETER(destination_data), Vector2i RMLUI_UNUSED_PARAMETER(destination_dimensions),
+	int RMLUI_UNUSED_PARAMETER(destination_stride), const FontGlyphDistanceField& RMLUI_UNUSED_PARAMETER(distance_field)) const
+{
+	RMLUI_UNUSED(destination_data);
+	RMLUI_UNUSED(destination_dimensions);
+	RMLUI_UNUSED(destination_stride);
+	RMLUI_UNUSED(distance_field);
+}
+
 void FontEffect::SetColour(const Colourb _colour)
 {
 	colour = _colour;
@@ -29,6 +29,7 @@
 #include "FontEffectBlur.h"
 #include "Memory.h"
 #include "../../Include/RmlUi/Core/PropertyDefinition.h"
+#include <cmath>
 
 namespace Rml {
 
@@ -115,6 +116,31 @@ void FontEffectBlur::GenerateGlyphTexture(byte* destination_data, const Vector2i
 		ColorFormat::A8);
 }
 
+FontEffect::DistanceFieldOutput FontEffectBlur::GetDistanceFieldOutput() const
+{
+	return DistanceFieldOutput::Coverage;
+}
+
+void FontEffectBlur::GenerateGlyphDistanceFieldTexture(byte* destination_data, const Vector2i destination_dimensions, int destination_stride,
+	const FontGlyphDistanceField& distance_field) const
+{
+	// Evaluate the Gaussian blur of the glyph analytically, from the distance to its edge.
+	const float std_dev = .4f * float(width);
+	const float inv_blur_scale = 1.f / (std_dev * Math::SquareRoot(2.f));
+
+	for (int y = 0; y < destination_dimensions.y; ++y)
+	{
+		const byte* source = distance_field.data + y * distance_field.dimensions.x;
+		byte* destination = destination_data + y * destination_stride;
+
+		for (int x = 0; x < destination_dimensions.x; ++x)
+		{
+			const float distance = (128.f - float(source[x])) / distance_field.units_per_pixel;
+			destination[x * 4 + 3] = byte(0.5f * std::erfc(distance * inv_blur_scale) * 255.f + 0.5f);
+		}
+	}
+}
+
 
 
 
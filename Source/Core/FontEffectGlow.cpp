@@ -29,6 +29,7 @@
 #include "FontEffectGlow.h"
 #include "Memory.h"
 #include "../../Include/RmlUi/Core/PropertyDefinition.h"
+#include <cmath>
 
 namespace Rml {
 
@@ -146,6 +147,32 @@ void FontEffectGlow::GenerateGlyphTexture(byte* destination_data, const Vector2i
 		Vector2i(0), ColorFormat::A8);
 }
 
+FontEffect::DistanceFieldOutput FontEffectGlow::GetDistanceFieldOutput() const
+{
+	return DistanceFieldOutput::Coverage;
+}
+
+void FontEffectGlow::GenerateGlyphDistanceFieldTexture(byte* destination_data, const Vector2i destination_dimensions, int destination_stride,
+	const FontGlyphDistanceField& distance_field) const
+{
+	// Evaluate the Gaussian blur of the outlined glyph analytically, from the distance to the outline's edge.
+	const float std_dev = .4f * float(width_blur);
+	const float inv_blur_scale = (width_blur == 0 ? 0.f : 1.f / (std_dev * Math::SquareRoot(2.f)));
+
+	for (int y = 0; y < destination_dimensions.y; ++y)
+	{
+		const byte* source = distance_field.data + y * distance_field.dimensions.x;
+		byte* destination = destination_data + y * destination_stride;
+
+		for (int x = 0; x < destination_dimensions.x; ++x)
+		{
+			const float distance = (128.f - float(source[x])) / distance_field.units_per_pixel - float(width_outline);
+			const float coverage = (width_blur == 0 ? Math::Clamp(0.5f - distance, 0.f, 1.f) : 0.5f * std::erfc(distance * inv_blur_scale));
+			destination[x * 4 + 3] = byte(coverage * 255.f + 0.5f);
+		}
+	}
+}
+
 
 
 FontEffectGlowInstancer::FontEffectGlowInstancer() : id_width_outline(PropertyId::Invalid), id_width_blur(PropertyId::Invalid),id_color(PropertyId::Invalid)
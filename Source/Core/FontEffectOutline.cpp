@@ -98,6 +98,27 @@ void FontEffectOutline::GenerateGlyphTexture(byte* destination_data, const Vecto
 		Vector2i(width), glyph.color_format);
 }
 
+FontEffect::DistanceFieldOutput FontEffectOutline::GetDistanceFieldOutput() const
+{
+	return DistanceFieldOutput::DistanceField;
+}
+
+void FontEffectOutline::GenerateGlyphDistanceFieldTexture(byte* destination_data, const Vector2i destination_dimensions, int destination_stride,
+	const FontGlyphDistanceField& distance_field) const
+{
+	// The outline is the glyph's distance field with its edge moved outwards by the outline width.
+	const int edge_offset = int(float(width) * distance_field.units_per_pixel + 0.5f);
+
+	for (int y = 0; y < destination_dimensions.y; ++y)
+	{
+		const byte* source = distance_field.data + y * distance_field.dimensions.x;
+		byte* destination = destination_data + y * destination_stride;
+
+		for (int x = 0; x < destination_dimensions.x; ++x)
+			destination[x * 4 + 3] = byte(Math::Min(int(source[x]) + edge_offset, 255));
+	}
+}
+
 
 
 FontEffectOutlineInstancer::FontEffectOutlineInstancer() : id_width(PropertyId::Invalid), id_color(PropertyId::Invalid)
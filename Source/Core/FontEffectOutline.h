@@ -55,6 +55,11 @@ public:
 
 	void GenerateGlyphTexture(byte* destination_data, Vector2i destination_dimensions, int destination_stride, const FontGlyph& glyph) const override;
 
+	DistanceFieldOutput GetDistanceFieldOutput() const override;
+
+	void GenerateGlyphDistanceFieldTexture(byte* destination_data, Vector2i destination_dimensions, int destination_stride,
+		const FontGlyphDistanceField& distance_field) const override;
+
 private:
 	int width;
 	ConvolutionFilter filter;
@@ -29,6 +29,7 @@
 #include "FontProvider.h"
 #include "FontFaceHandleDefault.h"
 #include "FontEngineInterfaceDefault.h"
+#include "FontWorker.h"
 
 namespace Rml {
 
@@ -39,6 +40,8 @@ FontEngineInterfaceDefault::FontEngineInterfaceDefault()
 
 FontEngineInterfaceDefault::~FontEngineInterfaceDefault()
 {
+	// The worker jobs may still be using the font faces, finish them first.
+	FontWorker::Shutdown();
 	FontProvider::Shutdown();
 }
 
@@ -55,13 +58,16 @@ bool FontEngineInterfaceDefault::LoadFontFace(const byte* data, int data_size, c
 FontFaceHandle FontEngineInterfaceDefault::GetFontFaceHandle(const String& family, Style::FontStyle style, Style::FontWeight weight, int size)
 {
 	auto handle = FontProvider::GetFontFaceHandle(family, style, weight, size);
+	FontProvider::EnforceMemoryBudget();
 	return reinterpret_cast<FontFaceHandle>(handle);
 }
 	
 FontEffectsHandle FontEngineInterfaceDefault::PrepareFontEffects(FontFaceHandle handle, const FontEffectList& font_effects)
 {
 	auto handle_default = reinterpret_cast<FontFaceHandleDefault *>(handle);
-	return (FontEffectsHandle)handle_default->GenerateLayerConfiguration(font_effects);
+	const int layer_configuration = handle_default->GenerateLayerConfiguration(font_effects);
+	FontProvider::EnforceMemoryBudget();
+	return (FontEffectsHandle)layer_configuration;
 }
 
 int FontEngineInterfaceDefault::GetSize(FontFaceHandle handle)
@@ -100,11 +106,19 @@ int FontEngineInterfaceDefault::GetStringWidth(FontFaceHandle handle, const Stri
 	return handle_default->GetStringWidth(string, prior_character);
 }
 
+int FontEngineInterfaceDefault::ShapeString(FontFaceHandle handle, const String& string, Vector<ShapedGlyphPosition>& glyphs)
+{
+	auto handle_default = reinterpret_cast<FontFaceHandleDefault*>(handle);
+	return handle_default->ShapeString(string, glyphs);
+}
+
 int FontEngineInterfaceDefault::GenerateString(FontFaceHandle handle, FontEffectsHandle font_effects_handle, const String& string,
 	const Vector2f& position, const Colourb& colour, float opacity, GeometryList& geometry)
 {
 	auto handle_default = reinterpret_cast<FontFaceHandleDefault *>(handle);
-	return handle_default->GenerateString(geometry, string, position, colour, opacity, (int)font_effects_handle);
+	const int width = handle_default->GenerateString(geometry, string, position, colour, opacity, (int)font_effects_handle);
+	FontProvider::EnforceMemoryBudget();
+	return width;
 }
 
 int FontEngineInterfaceDefault::GetVersion(FontFaceHandle handle)
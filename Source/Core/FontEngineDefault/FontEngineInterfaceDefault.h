@@ -68,6 +68,9 @@ public:
 	/// Returns the width a string will take up if rendered with this handle.
 	int GetStringWidth(FontFaceHandle, const String& string, Character prior_character) override;
 
+	/// Returns the glyphs of a string and their placement, as shaped for rendering.
+	int ShapeString(FontFaceHandle, const String& string, Vector<ShapedGlyphPosition>& glyphs) override;
+
 	/// Generates the geometry required to render a single line of text.
 	int GenerateString(FontFaceHandle, FontEffectsHandle, const String& string, const Vector2f& position, const Colourb& colour, float opacity,
 		GeometryList& geometry) override;
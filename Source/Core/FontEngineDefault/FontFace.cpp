@@ -26,8 +26,10 @@
  *
  */
 
+#include "../../../Include/RmlUi/Core/Core.h"
 #include "../../../Include/RmlUi/Core/Log.h"
 #include "FontFace.h"
+#include "FontFaceDistanceField.h"
 #include "FontFaceHandleDefault.h"
 #include "FreeTypeInterface.h"
 
@@ -71,9 +73,27 @@ FontFaceHandleDefault* FontFace::GetHandle(int size, bool load_default_glyphs)
 		return nullptr;
 	}
 
+	// In distance field mode, the glyphs of all sizes are rendered from a single atlas shared by the handles.
+	FontFaceDistanceField* handle_distance_field = nullptr;
+	if (FontFaceDistanceField::IsEnabled() && FreeType::SupportsDistanceField(face))
+	{
+		if (!distance_field)
+			distance_field = MakeUnique<FontFaceDistanceField>(face);
+		handle_distance_field = distance_field.get();
+	}
+
+	if (!kerning_pairs_loaded)
+	{
+		kerning_pairs_loaded = true;
+
+		auto face_kerning_pairs = MakeUnique<FontKerningPairList>();
+		if (FreeType::HasKerning(face) && FreeType::GetKerningPairs(face, *face_kerning_pairs))
+			kerning_pairs = std::move(face_kerning_pairs);
+	}
+
 	// Construct and initialise the new handle.
 	auto handle = MakeUnique<FontFaceHandleDefault>();
-	if (!handle->Initialize(face, size, load_default_glyphs))
+	if (!handle->Initialize(face, size, load_default_glyphs, handle_distance_field, kerning_pairs.get()))
 	{
 		handles[size] = nullptr;
 		return nullptr;
@@ -90,6 +110,31 @@ FontFaceHandleDefault* FontFace::GetHandle(int size, bool load_default_glyphs)
 void FontFace::ReleaseFontResources()
 {
 	HandleMap().swap(handles);
+	distance_field.reset();
+}
+
+void FontFace::GetHandles(Vector<FontFaceHandleDefault*>& out_handles) const
+{
+	for (const auto& pair : handles)
+	{
+		if (pair.second)
+			out_handles.push_back(pair.second.get());
+	}
+}
+
+void FontFace::GetMemoryUsage(Vector<FontFaceMemoryUsage>& out_usage) const
+{
+	for (const auto& pair : handles)
+	{
+		if (!pair.second)
+			continue;
+
+		FontFaceMemoryUsage usage;
+		usage.style = style;
+		usage.weight = weight;
+		pair.second->GetMemoryUsage(usage);
+		out_usage.push_back(std::move(usage));
+	}
 }
 
 } // namespace Rml
@@ -34,6 +34,8 @@
 
 namespace Rml {
 
+struct FontFaceMemoryUsage;
+class FontFaceDistanceField;
 class FontFaceHandleDefault;
 
 /**
@@ -58,10 +60,22 @@ public:
 	/// Releases resources owned by sized font faces, including their textures and rendered glyphs.
 	void ReleaseFontResources();
 
+	/// Appends the handles of all sizes generated for this face.
+	void GetHandles(Vector<FontFaceHandleDefault*>& out_handles) const;
+	/// Appends the memory usage of each handle of this face.
+	void GetMemoryUsage(Vector<FontFaceMemoryUsage>& out_usage) const;
+
 private:
 	Style::FontStyle style;
 	Style::FontWeight weight;
 
+	// Distance fields of the glyphs shared by all handles, when rendering the face in distance field mode.
+	UniquePtr<FontFaceDistanceField> distance_field;
+
+	// The kerning pairs of the face, read once and scaled by each handle to its size. Null if the face has no kerning, or it must be queried per pair.
+	UniquePtr<FontKerningPairList> kerning_pairs;
+	bool kerning_pairs_loaded = false;
+
 	// Key is font size
 	using HandleMap = UnorderedMap< int, UniquePtr<FontFaceHandleDefault> >;
 	HandleMap handles;
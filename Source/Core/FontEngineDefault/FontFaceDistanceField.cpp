@@ -0,0 +1,230 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "FontFaceDistanceField.h"
+#include "../../../Include/RmlUi/Core/FontEffect.h"
+#include "FreeTypeInterface.h"
+#include <algorithm>
+
+namespace Rml {
+
+static bool distance_field_enabled = false;
+
+FontFaceDistanceField::FontFaceDistanceField(FontFaceHandleFreetype face) : face(face) {}
+
+FontFaceDistanceField::~FontFaceDistanceField() {}
+
+void FontFaceDistanceField::SetEnabled(bool enable)
+{
+	distance_field_enabled = enable;
+}
+
+bool FontFaceDistanceField::IsEnabled()
+{
+	return distance_field_enabled;
+}
+
+bool FontFaceDistanceField::AddGlyph(Character character)
+{
+	if (glyphs.find(character) != glyphs.end())
+		return true;
+
+	if (!FreeType::AppendDistanceFieldGlyph(face, ReferenceSize, character, glyphs))
+		return false;
+
+	is_dirty = true;
+	return true;
+}
+
+void FontFaceDistanceField::Update()
+{
+	if (!is_dirty)
+		return;
+
+	is_dirty = false;
+
+	// Add the new glyphs to the texture layout, the existing glyphs keep their place in the layout. Glyphs which could not be placed
+	// previously are attempted again along with the new ones.
+	const int first_new_rectangle = texture_layout.GetNumLaidOutRectangles();
+
+	for (auto& pair : glyphs)
+	{
+		const Character character = pair.first;
+		const FontGlyph& glyph = pair.second;
+
+		if (glyph_boxes.find(character) != glyph_boxes.end())
+			continue;
+
+		GlyphBox& box = glyph_boxes[character];
+		box.origin = Vector2f(float(glyph.bearing.x), float(-glyph.bearing.y));
+		box.dimensions = Vector2f(glyph.bitmap_dimensions);
+
+		// Glyphs without a distance field, such as spaces, are left out of the atlas and never rendered.
+		if (glyph.bitmap_data)
+			texture_layout.AddRectangle((int)character, glyph.bitmap_dimensions);
+	}
+
+	if (first_new_rectangle == texture_layout.GetNumRectangles())
+		return;
+
+	Vector<Vector2i> previous_texture_dimensions(texture_layout.GetNumTextures());
+	for (int i = 0; i < texture_layout.GetNumTextures(); ++i)
+		previous_texture_dimensions[i] = texture_layout.GetTexture(i).GetDimensions();
+
+	constexpr int max_texture_dimensions = 1024;
+	texture_layout.GenerateLayout(max_texture_dimensions);
+
+	// New textures and textures which changed size must also update the texture coordinates of the glyphs already placed on them.
+	const int num_textures = texture_layout.GetNumTextures();
+	Vector<bool> dirty_textures(num_textures, false);
+	Vector<bool> resized_textures(num_textures, false);
+
+	for (int i = 0; i < num_textures; ++i)
+	{
+		if (i >= (int)previous_texture_dimensions.size() || previous_texture_dimensions[i] != texture_layout.GetTexture(i).GetDimensions())
+			dirty_textures[i] = resized_textures[i] = true;
+	}
+
+	const bool any_resized_textures = (std::find(resized_textures.begin(), resized_textures.end(), true) != resized_textures.end());
+
+	for (int i = (any_resized_textures ? 0 : first_new_rectangle); i < texture_layout.GetNumRectangles(); ++i)
+	{
+		TextureLayoutRectangle& rectangle = texture_layout.GetRectangle(i);
+		const int texture_index = rectangle.GetTextureIndex();
+
+		if (texture_index < 0 || (i < first_new_rectangle && !resized_textures[texture_index]))
+			continue;
+
+		const Vector2f texture_dimensions = Vector2f(texture_layout.GetTexture(texture_index).GetDimensions());
+		GlyphBox& box = glyph_boxes[(Character)rectangle.GetId()];
+
+		box.texture_index = texture_index;
+		box.texcoords[0] = Vector2f(rectangle.GetPosition()) / texture_dimensions;
+		box.texcoords[1] = Vector2f(rectangle.GetPosition() + rectangle.GetDimensions()) / texture_dimensions;
+
+		dirty_textures[texture_index] = true;
+	}
+
+	// The textures are shared by all handles of the face, give the dirty ones a new resource so that they are generated anew on next use.
+	textures.resize(num_textures);
+
+	for (int i = 0; i < num_textures; ++i)
+	{
+		if (!dirty_textures[i])
+			continue;
+
+		const int texture_id = i;
+		TextureCallback texture_callback = [this, texture_id](const String& /*name*/, UniquePtr<const byte[]>& data, Vector2i& dimensions) -> bool {
+			return GenerateTexture(data, dimensions, texture_id);
+		};
+
+		textures[i].Set("font-face-distance-field", texture_callback, true);
+	}
+
+	++version;
+}
+
+const FontFaceDistanceField::GlyphBox* FontFaceDistanceField::GetGlyphBox(Character character) const
+{
+	auto it = glyph_boxes.find(character);
+	if (it == glyph_boxes.end())
+		return nullptr;
+
+	return &it->second;
+}
+
+const Vector<Texture>& FontFaceDistanceField::GetTextures() const
+{
+	return textures;
+}
+
+size_t FontFaceDistanceField::GetTextureMemoryUsage() const
+{
+	size_t result = 0;
+	for (int i = 0; i < texture_layout.GetNumTextures(); ++i)
+	{
+		const Vector2i dimensions = texture_layout.GetTexture(i).GetDimensions();
+		result += size_t(dimensions.x) * size_t(dimensions.y) * 4;
+	}
+	return result;
+}
+
+int FontFaceDistanceField::GetVersion() const
+{
+	return version;
+}
+
+bool FontFaceDistanceField::GenerateTexture(UniquePtr<const byte[]>& texture_data, Vector2i& texture_dimensions, int texture_id,
+	const FontEffect* effect, int font_size)
+{
+	if (texture_id < 0 || texture_id >= texture_layout.GetNumTextures())
+		return false;
+
+	TextureLayoutTexture& texture = texture_layout.GetTexture(texture_id);
+	UniquePtr<byte[]> data = texture.AllocateTexture(texture_layout);
+	texture_dimensions = texture.GetDimensions();
+
+	const float units_per_pixel = float(128 / DistanceFieldSpread) * float(ReferenceSize) / float(font_size);
+
+	for (int i = 0; i < texture_layout.GetNumRectangles(); ++i)
+	{
+		TextureLayoutRectangle& rectangle = texture_layout.GetRectangle(i);
+		if (rectangle.GetTextureIndex() != texture_id)
+			continue;
+
+		auto it = glyphs.find((Character)rectangle.GetId());
+		if (it == glyphs.end() || !it->second.bitmap_data)
+			continue;
+
+		const FontGlyph& glyph = it->second;
+		byte* destination = rectangle.GetTextureData();
+		const int stride = rectangle.GetTextureStride();
+
+		if (effect)
+		{
+			const FontGlyphDistanceField distance_field = {glyph.bitmap_data, glyph.bitmap_dimensions, units_per_pixel};
+			effect->GenerateGlyphDistanceFieldTexture(destination, glyph.bitmap_dimensions, stride, distance_field);
+			continue;
+		}
+
+		const byte* source = glyph.bitmap_data;
+		for (int y = 0; y < glyph.bitmap_dimensions.y; ++y)
+		{
+			for (int x = 0; x < glyph.bitmap_dimensions.x; ++x)
+				destination[x * 4 + 3] = source[x];
+
+			destination += stride;
+			source += glyph.bitmap_dimensions.x;
+		}
+	}
+
+	texture_data = std::move(data);
+	return true;
+}
+
+} // namespace Rml
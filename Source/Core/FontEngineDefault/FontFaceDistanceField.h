@@ -0,0 +1,121 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_FONTENGINEDEFAULT_FONTFACEDISTANCEFIELD_H
+#define RMLUI_CORE_FONTENGINEDEFAULT_FONTFACEDISTANCEFIELD_H
+
+#include "../../../Include/RmlUi/Core/Texture.h"
+#include "../../../Include/RmlUi/Core/Traits.h"
+#include "../TextureLayout.h"
+#include "FontGlyphTable.h"
+#include "FontTypes.h"
+
+namespace Rml {
+
+class FontEffect;
+
+/**
+	An atlas of signed distance fields for the glyphs of a font face, shared by the handles of all sizes of the face.
+
+	The distance fields are rendered once at a reference size, and scaled to the size of each handle when generating geometry. This avoids
+	rasterizing glyphs and allocating textures for every font size in use, such as when animating the font size.
+ */
+
+class FontFaceDistanceField final : public NonCopyMoveable
+{
+public:
+	/// The font size at which the distance fields are rendered.
+	static constexpr int ReferenceSize = 48;
+
+	FontFaceDistanceField(FontFaceHandleFreetype face);
+	~FontFaceDistanceField();
+
+	/// Enables or disables distance field rendering for font face handles created from now on.
+	static void SetEnabled(bool enable);
+	/// Returns true if distance field rendering is enabled.
+	static bool IsEnabled();
+
+	struct GlyphBox
+	{
+		// The offset from the baseline to the top-left corner of the glyph's distance field, in pixels at the reference size.
+		Vector2f origin;
+		// The dimensions of the distance field, in pixels at the reference size.
+		Vector2f dimensions;
+		// The texture coordinates of the distance field.
+		Vector2f texcoords[2];
+		// The atlas texture containing the distance field, or -1 if the glyph has no visible area.
+		int texture_index = -1;
+	};
+
+	/// Renders the distance field of a character, to be placed into the atlas on next update. Does nothing if the character was already added.
+	/// @return True if the face provides a glyph for the character.
+	bool AddGlyph(Character character);
+
+	/// Places the glyphs added since the last update into the atlas textures, and increments the version if any textures were changed.
+	void Update();
+
+	/// Returns the box of a glyph placed in the atlas, or nullptr if the glyph has not been placed.
+	const GlyphBox* GetGlyphBox(Character character) const;
+
+	/// Returns the textures of the atlas.
+	const Vector<Texture>& GetTextures() const;
+
+	/// Returns the size in bytes of the atlas textures.
+	size_t GetTextureMemoryUsage() const;
+
+	/// Version is changed whenever the atlas textures are changed, which invalidates the boxes and textures derived from them.
+	int GetVersion() const;
+
+	/// Generates the data of an atlas texture, optionally with a font effect applied to the distance field of each glyph.
+	/// @param[out] texture_data The pointer to be set to the generated texture data.
+	/// @param[out] texture_dimensions The dimensions of the texture.
+	/// @param[in] texture_id The index of the atlas texture to generate.
+	/// @param[in] effect The font effect to generate the texture for, or nullptr to generate the distance fields themselves.
+	/// @param[in] font_size The font size the font effect is rendered at.
+	/// @return True if the texture was generated.
+	bool GenerateTexture(UniquePtr<const byte[]>& texture_data, Vector2i& texture_dimensions, int texture_id, const FontEffect* effect = nullptr,
+		int font_size = ReferenceSize);
+
+private:
+	FontFaceHandleFreetype face;
+
+	// The glyphs rendered at the reference size, with their distance fields as bitmaps.
+	FontGlyphTable glyphs;
+
+	using GlyphBoxMap = UnorderedMap<Character, GlyphBox>;
+	GlyphBoxMap glyph_boxes;
+
+	TextureLayout texture_layout;
+	Vector<Texture> textures;
+
+	bool is_dirty = false;
+	int version = 0;
+};
+
+} // namespace Rml
+#endif
@@ -27,17 +27,40 @@
  */
 
 #include "FontFaceHandleDefault.h"
+#include "../../../Include/RmlUi/Core/Core.h"
 #include "../../../Include/RmlUi/Core/StringUtilities.h"
 #include "../TextureLayout.h"
 #include "FontProvider.h"
+#include "FontFaceDistanceField.h"
 #include "FontFaceLayer.h"
+#include "FontWorker.h"
 #include "FreeTypeInterface.h"
+#include "HarfBuzzInterface.h"
 #include <algorithm>
+#include <string.h>
 
 namespace Rml {
 
 static constexpr char32_t KerningCache_AsciiSubsetBegin = 32;
 static constexpr char32_t KerningCache_AsciiSubsetLast = 126;
+static constexpr size_t ShapedRunCacheGenerationSize = 2048;
+
+// Advanced whenever a handle is used, to order the handles and their layers by recent use.
+static uint64_t usage_tick = 0;
+
+// Copies a glyph along with its bitmap, so that it stays valid when the resources of the handle it was copied from are released.
+static FontGlyph CopyGlyph(const FontGlyph& glyph)
+{
+	FontGlyph result = glyph.WeakCopy();
+	if (glyph.bitmap_data)
+	{
+		const size_t num_bytes = size_t(glyph.bitmap_dimensions.x * glyph.bitmap_dimensions.y * (glyph.color_format == ColorFormat::RGBA8 ? 4 : 1));
+		result.bitmap_owned_data.reset(new byte[num_bytes]);
+		result.bitmap_data = result.bitmap_owned_data.get();
+		memcpy(result.bitmap_owned_data.get(), glyph.bitmap_data, num_bytes);
+	}
+	return result;
+}
 
 FontFaceHandleDefault::FontFaceHandleDefault()
 {
@@ -48,25 +71,79 @@ FontFaceHandleDefault::FontFaceHandleDefault()
 
 FontFaceHandleDefault::~FontFaceHandleDefault()
 {
+	if (prerasterize_job)
+		prerasterize_job->Cancel();
+
+#ifdef RMLUI_ENABLE_HARFBUZZ
+	if (harfbuzz_font)
+		HarfBuzz::ReleaseShapingFont(harfbuzz_font);
+#endif
+
 	glyphs.clear();
 	layers.clear();
 }
 
-bool FontFaceHandleDefault::Initialize(FontFaceHandleFreetype face, int font_size, bool load_default_glyphs)
+bool FontFaceHandleDefault::Initialize(FontFaceHandleFreetype face, int font_size, bool load_default_glyphs, FontFaceDistanceField* _distance_field,
+	const FontKerningPairList* _kerning_pairs)
 {
 	ft_face = face;
+	distance_field = _distance_field;
+	kerning_pairs = _kerning_pairs;
 
 	RMLUI_ASSERTMSG(layer_configurations.empty(), "Initialize must only be called once.");
 
-	if (!FreeType::InitialiseFaceHandle(ft_face, font_size, glyphs, metrics, load_default_glyphs))
+	// With worker threads enabled, only the metrics are generated here. The default glyphs and kerning pairs are built in the background using
+	// a separate instance of the face, and merged on first use. This lets any work done before then overlap with the rasterization.
+	const bool prerasterize = (load_default_glyphs && !distance_field && FontWorker::IsEnabled());
+
+	// In distance field mode, only the glyph metrics are loaded for this size. Their distance fields are rendered into the shared atlas.
+	if (!FreeType::InitialiseFaceHandle(ft_face, font_size, glyphs, metrics, load_default_glyphs && !prerasterize, !distance_field))
 		return false;
 
+	if (distance_field)
+	{
+		for (auto& pair : glyphs)
+		{
+			if (!pair.second.bitmap_data)
+				distance_field->AddGlyph(pair.first);
+		}
+
+		distance_field->Update();
+		distance_field_version = distance_field->GetVersion();
+	}
+
 	has_kerning = FreeType::HasKerning(ft_face);
-	FillKerningPairCache();
+
+	if (prerasterize)
+	{
+		auto result = MakeShared<PrerasterizedGlyphs>();
+		// Scaling the kerning pairs of the face is cheap, only the per-pair queries are worth moving to the worker.
+		const bool fill_kerning = (has_kerning && !kerning_pairs);
+
+		prerasterize_job = FontWorker::Submit([face, font_size, fill_kerning, result]() {
+			FontFaceHandleFreetype face_instance = FreeType::LoadFaceInstance(face);
+			if (!face_instance)
+				return;
+
+			FontMetrics instance_metrics = {};
+			result->success = FreeType::InitialiseFaceHandle(face_instance, font_size, result->glyphs, instance_metrics, true);
+			if (result->success && fill_kerning)
+				FillKerningPairCache(face_instance, font_size, result->kerning_table);
+
+			FreeType::ReleaseFaceInstance(face_instance);
+		});
+		prerasterized_glyphs = std::move(result);
+	}
+
+	if (has_kerning && (!prerasterize || kerning_pairs))
+		LoadKerningTable();
 
 	// Generate the default layer and layer configuration.
 	base_layer = GetOrCreateLayer(nullptr);
 	layer_configurations.push_back(LayerConfiguration{ base_layer });
+	layer_configuration_usage.emplace_back();
+
+	last_used = ++usage_tick;
 
 	return true;
 }
@@ -96,11 +173,16 @@ int FontFaceHandleDefault::GetBaseline() const
 }
 
 // Returns the font's glyphs.
-const FontGlyphMap& FontFaceHandleDefault::GetGlyphs() const
+const FontGlyphTable& FontFaceHandleDefault::GetGlyphs() const
 {
 	return glyphs;
 }
 
+FontFaceDistanceField* FontFaceHandleDefault::GetDistanceField() const
+{
+	return distance_field;
+}
+
 float FontFaceHandleDefault::GetUnderline(float& thickness) const
 {
 	thickness = metrics.underline_thickness;
@@ -110,30 +192,34 @@ float FontFaceHandleDefault::GetUnderline(float& thickness) const
 // Returns the width a string will take up if rendered with this handle.
 int FontFaceHandleDefault::GetStringWidth(const String& string, Character prior_character)
 {
-	int width = 0;
-	for (auto it_string = StringIteratorU8(string); it_string; ++it_string)
-	{
-		Character character = *it_string;
+	last_used = ++usage_tick;
 
-		const FontGlyph* glyph = GetOrAppendGlyph(character);
-		if (!glyph)
-			continue;
+	const ShapedRun& run = GetShapedRun(string);
+	if (run.glyphs.empty())
+		return 0;
+
+	// Adjust for the kerning between the prior character and the first one, the run itself is shaped without a prior character.
+	return GetKerning(prior_character, run.glyphs.front().character) + run.width;
+}
 
-		// Adjust the cursor for the kerning between this character and the previous one.
-		width += GetKerning(prior_character, character);
+int FontFaceHandleDefault::ShapeString(const String& string, Vector<ShapedGlyphPosition>& glyphs)
+{
+	last_used = ++usage_tick;
 
-		// Adjust the cursor for this character's advance.
-		width += glyph->advance;
+	const ShapedRun& run = GetShapedRun(string);
 
-		prior_character = character;
-	}
+	glyphs.reserve(glyphs.size() + run.glyphs.size());
+	for (const ShapedGlyph& glyph : run.glyphs)
+		glyphs.push_back(ShapedGlyphPosition{glyph.string_offset, glyph.position});
 
-	return width;
+	return run.width;
 }
 
 // Generates, if required, the layer configuration for a given array of font effects.
 int FontFaceHandleDefault::GenerateLayerConfiguration(const FontEffectList& font_effects)
 {
+	last_used = ++usage_tick;
+
 	if (font_effects.empty())
 		return 0;
 
@@ -167,13 +253,19 @@ int FontFaceHandleDefault::GenerateLayerConfiguration(const FontEffectList& font
 		}
 
 		if (effect_index == font_effects.size())
+		{
+			layer_configuration_usage[configuration_index].last_used = last_used;
 			return configuration_index;
+		}
 	}
 
 	// No match, so we have to generate a new layer configuration.
 	layer_configurations.push_back(LayerConfiguration());
 	LayerConfiguration& layer_configuration = layer_configurations.back();
 
+	layer_configuration_usage.emplace_back();
+	layer_configuration_usage.back().last_used = last_used;
+
 	bool added_base_layer = false;
 
 	for (size_t i = 0; i < font_effects.size(); ++i)
@@ -196,14 +288,8 @@ int FontFaceHandleDefault::GenerateLayerConfiguration(const FontEffectList& font
 }
 
 // Generates the texture data for a layer (for the texture database).
-bool FontFaceHandleDefault::GenerateLayerTexture(UniquePtr<const byte[]>& texture_data, Vector2i& texture_dimensions, const FontEffect* font_effect, int texture_id, int handle_version) const
+bool FontFaceHandleDefault::GenerateLayerTexture(UniquePtr<const byte[]>& texture_data, Vector2i& texture_dimensions, const FontEffect* font_effect, int texture_id) const
 {
-	if (handle_version != version)
-	{
-		RMLUI_ERRORMSG("While generating font layer texture: Handle version mismatch in texture vs font-face.");
-		return false;
-	}
-
 	auto it = std::find_if(layers.begin(), layers.end(), [font_effect](const EffectLayerPair& pair) { return pair.font_effect == font_effect; });
 
 	if (it == layers.end())
@@ -220,16 +306,29 @@ int FontFaceHandleDefault::GenerateString(GeometryList& geometry, const String&
 	const float opacity, const int layer_configuration_index)
 {
 	int geometry_index = 0;
-	int line_width = 0;
 
 	RMLUI_ASSERT(layer_configuration_index >= 0);
 	RMLUI_ASSERT(layer_configuration_index < (int) layer_configurations.size());
 
+	// Shape the string before updating the layers, so that any glyphs appended while shaping are included in this geometry.
+	const ShapedRun& run = GetShapedRun(string);
+
 	UpdateLayersOnDirty();
 
 	// Fetch the requested configuration and generate the geometry for each one.
 	const LayerConfiguration& layer_configuration = layer_configurations[layer_configuration_index];
 
+	// Layers released to stay within the memory budget are generated anew once used. Generate them in the order the layers were created,
+	// as for any other layer regeneration.
+	for (auto& pair : layers)
+	{
+		if (pair.layer->IsReleased() && std::find(layer_configuration.begin(), layer_configuration.end(), pair.layer.get()) != layer_configuration.end())
+		{
+			bool geometry_invalidated = false;
+			GenerateLayer(pair.layer.get(), geometry_invalidated);
+		}
+	}
+
 	// Reserve for the common case of one texture per layer.
 	geometry.reserve(layer_configuration.size());
 
@@ -264,31 +363,15 @@ int FontFaceHandleDefault::GenerateString(GeometryList& geometry, const String&
 		for (int tex_index = 0; tex_index < num_textures; ++tex_index)
 			geometry[geometry_index + tex_index].SetTexture(layer->GetTexture(tex_index));
 
-		line_width = 0;
-		Character prior_character = Character::Null;
+		geometry[geometry_index].GetIndices().reserve(run.glyphs.size() * 6);
+		geometry[geometry_index].GetVertices().reserve(run.glyphs.size() * 4);
 
-		geometry[geometry_index].GetIndices().reserve(string.size() * 6);
-		geometry[geometry_index].GetVertices().reserve(string.size() * 4);
-
-		for (auto it_string = StringIteratorU8(string); it_string; ++it_string)
+		for (const ShapedGlyph& glyph : run.glyphs)
 		{
-			Character character = *it_string;
-
-			const FontGlyph* glyph = GetOrAppendGlyph(character);
-			if (!glyph)
-				continue;
-
-			// Adjust the cursor for the kerning between this character and the previous one.
-			line_width += GetKerning(prior_character, character);
-
 			// Use white vertex colors on RGB glyphs.
-			const Colourb glyph_color =
-				(layer == base_layer && glyph->color_format == ColorFormat::RGBA8 ? Colourb(255, layer_colour.alpha) : layer_colour);
+			const Colourb glyph_color = (layer == base_layer && glyph.is_color ? Colourb(255, layer_colour.alpha) : layer_colour);
 
-			layer->GenerateGeometry(&geometry[geometry_index], character, Vector2f(position.x + line_width, position.y), glyph_color);
-
-			line_width += glyph->advance;
-			prior_character = character;
+			layer->GenerateGeometry(&geometry[geometry_index], glyph.character, position + Vector2f(glyph.position), glyph_color);
 		}
 
 		geometry_index += num_textures;
@@ -297,49 +380,386 @@ int FontFaceHandleDefault::GenerateString(GeometryList& geometry, const String&
 	// Cull any excess geometry from a previous generation.
 	geometry.resize(geometry_index);
 
-	return line_width;
+	// Glyphs appended while generating the string are missing from its geometry, make sure it is regenerated once they are added to the layers.
+	if (is_layers_dirty)
+		is_geometry_incomplete = true;
+
+	last_used = ++usage_tick;
+	layer_configuration_usage[layer_configuration_index] = LayerConfigurationUsage{last_used, version};
+
+	return run.width;
 }
 
 bool FontFaceHandleDefault::UpdateLayersOnDirty()
 {
 	bool result = false;
 
-	// If we are dirty, regenerate all the layers and increment the version
+	if (distance_field)
+	{
+		// Place any new glyphs into the shared atlas. The atlas may also have been changed by the handles of other sizes.
+		distance_field->Update();
+		if (distance_field->GetVersion() != distance_field_version)
+		{
+			distance_field_version = distance_field->GetVersion();
+			is_layers_dirty = true;
+		}
+	}
+
+	// If we are dirty, add the new glyphs to all the layers, and increment the version if existing geometry was invalidated.
 	if(is_layers_dirty && base_layer)
 	{
 		is_layers_dirty = false;
-		++version;
 
-		// Regenerate all the layers.
+		// Update all the layers. Each layer keeps its existing glyph layout, and only updates the textures receiving new glyphs.
 		// Note: The layer regeneration needs to happen in the order in which the layers were created,
 		// otherwise we may end up cloning a layer which has not yet been regenerated. This means trouble!
+		bool geometry_invalidated = is_geometry_incomplete;
 		for (auto& pair : layers)
 		{
-			GenerateLayer(pair.layer.get());
+			if (!pair.layer->IsReleased())
+				GenerateLayer(pair.layer.get(), geometry_invalidated);
 		}
 
+		is_geometry_incomplete = false;
+		if (geometry_invalidated)
+			++version;
+
 		result = true;
 	}
 
 	return result;
 }
 
-int FontFaceHandleDefault::GetVersion() const 
+int FontFaceHandleDefault::GetVersion()
 {
+	last_used = ++usage_tick;
+
+	if (has_pending_layers)
+		UpdatePendingLayers();
+
+	// Pick up changes to the shared distance field atlas made by the handles of other sizes.
+	if (distance_field && distance_field->GetVersion() != distance_field_version)
+		UpdateLayersOnDirty();
+
 	return version;
 }
 
+int FontFaceHandleDefault::GetNumShapedRuns() const
+{
+	return int(shaped_run_cache.size() + shaped_run_cache_previous.size());
+}
+
+uint64_t FontFaceHandleDefault::GetLastUsed() const
+{
+	return last_used;
+}
+
+void FontFaceHandleDefault::GetMemoryUsage(FontFaceMemoryUsage& usage) const
+{
+	usage.size = metrics.size;
+	usage.num_glyphs = (int)glyphs.size();
+	usage.num_layers = 0;
+	usage.glyph_bytes = glyphs.GetMemoryUsage();
+	usage.texture_bytes = 0;
+	usage.cache_bytes = kerning_table.size() * sizeof(FontKerningTable::value_type);
+
+	for (const auto& pair : glyphs)
+	{
+		const FontGlyph& glyph = pair.second;
+		if (glyph.bitmap_owned_data)
+			usage.glyph_bytes += size_t(glyph.bitmap_dimensions.x * glyph.bitmap_dimensions.y * (glyph.color_format == ColorFormat::RGBA8 ? 4 : 1));
+	}
+
+	for (const auto& pair : layers)
+	{
+		if (pair.font_effect && !pair.layer->IsReleased())
+			usage.num_layers += 1;
+		usage.texture_bytes += pair.layer->GetTextureMemoryUsage();
+	}
+
+	for (const ShapedRunCache* cache : {&shaped_run_cache, &shaped_run_cache_previous})
+	{
+		for (const auto& pair : *cache)
+			usage.cache_bytes += sizeof(ShapedRunCache::value_type) + pair.first.capacity() + pair.second.glyphs.capacity() * sizeof(ShapedGlyph);
+	}
+}
+
+void FontFaceHandleDefault::GetLayerUsage(Vector<LayerUsage>& out_layers) const
+{
+	// A layer was last used by the most recent configuration containing it.
+	SmallUnorderedMap<const FontFaceLayer*, uint64_t> layer_last_used;
+
+	for (size_t i = 0; i < layer_configurations.size(); ++i)
+	{
+		// Geometry generated since the last version change still refers to the layers of its configuration.
+		const LayerConfigurationUsage& usage = layer_configuration_usage[i];
+		const uint64_t configuration_last_used = (usage.version == version ? last_used : usage.last_used);
+
+		for (const FontFaceLayer* layer : layer_configurations[i])
+		{
+			uint64_t& value = layer_last_used[layer];
+			value = std::max(value, configuration_last_used);
+		}
+	}
+
+	for (const auto& pair : layers)
+	{
+		const FontEffect* effect = pair.font_effect;
+		const size_t texture_bytes = pair.layer->GetTextureMemoryUsage();
+		if (!effect || texture_bytes == 0)
+			continue;
+
+		// Layers cloned from this one share its textures, and are released along with it.
+		uint64_t shared_last_used = 0;
+		for (const auto& other : layers)
+		{
+			if (other.font_effect && other.font_effect->HasUniqueTexture() && other.font_effect->GetFingerprint() == effect->GetFingerprint())
+				shared_last_used = std::max(shared_last_used, layer_last_used[other.layer.get()]);
+		}
+
+		out_layers.push_back(LayerUsage{pair.layer.get(), shared_last_used, texture_bytes});
+	}
+}
+
+void FontFaceHandleDefault::ReleaseLayer(FontFaceLayer* layer)
+{
+	const FontEffect* effect = layer->GetFontEffect();
+	RMLUI_ASSERT(effect && layer != base_layer);
+	const size_t fingerprint = effect->GetFingerprint();
+
+	for (auto& pair : layers)
+	{
+		if (pair.layer.get() == layer ||
+			(pair.font_effect && pair.font_effect->HasUniqueTexture() && pair.font_effect->GetFingerprint() == fingerprint))
+			pair.layer->Release();
+	}
+
+	// The first of the layers to be generated again will then generate new textures for the others to share.
+	layer_cache.erase(fingerprint);
+
+	// Existing geometry may refer to the released textures.
+	++version;
+}
+
+void FontFaceHandleDefault::ReleaseResources()
+{
+	if (prerasterize_job)
+	{
+		prerasterize_job->Cancel();
+		prerasterize_job.reset();
+		prerasterized_glyphs.reset();
+	}
+
+	FontGlyphTable().swap(glyphs);
+	FontKerningTable().swap(kerning_table);
+	ShapedRunCache().swap(shaped_run_cache);
+	ShapedRunCache().swap(shaped_run_cache_previous);
+	uncached_shaped_run = ShapedRun();
+
+	for (auto& pair : layers)
+		pair.layer->Release();
+	layer_cache.clear();
+
+	is_kerning_table_released = has_kerning;
+	is_layers_dirty = false;
+	is_geometry_incomplete = false;
+	has_pending_layers = false;
+
+	++version;
+}
+
+void FontFaceHandleDefault::RefreshLayerUsage(uint64_t since_tick)
+{
+	// The base configuration has no layers of its own to release.
+	for (size_t i = 1; i < layer_configuration_usage.size(); ++i)
+	{
+		const LayerConfigurationUsage& usage = layer_configuration_usage[i];
+		if (usage.version == version && usage.last_used <= since_tick)
+		{
+			++version;
+			break;
+		}
+	}
+}
+
+uint64_t FontFaceHandleDefault::GetUsageTick()
+{
+	return usage_tick;
+}
+
+const FontFaceHandleDefault::ShapedRun& FontFaceHandleDefault::GetShapedRun(const String& string)
+{
+	auto it_run = shaped_run_cache.find(string);
+	if (it_run != shaped_run_cache.end())
+		return it_run->second;
+
+	ShapedRun run;
+	bool cacheable = true;
+
+	// Runs used since the last generation change are carried over to the current generation.
+	auto it_previous_run = shaped_run_cache_previous.find(string);
+	if (it_previous_run != shaped_run_cache_previous.end())
+	{
+		run = std::move(it_previous_run->second);
+		shaped_run_cache_previous.erase(it_previous_run);
+	}
+	else
+	{
+#ifdef RMLUI_ENABLE_HARFBUZZ
+		if (!ShapeRunHarfBuzz(string, run, cacheable))
+#endif
+			ShapeRun(string, run, cacheable);
+	}
+
+	if (!cacheable)
+	{
+		uncached_shaped_run = std::move(run);
+		return uncached_shaped_run;
+	}
+
+	// Keep the cache bounded by starting a new generation when the current one is full. Runs not used during the last generation are
+	// then dropped, while those still in use are kept.
+	if (shaped_run_cache.size() >= ShapedRunCacheGenerationSize)
+	{
+		shaped_run_cache_previous = std::move(shaped_run_cache);
+		shaped_run_cache.clear();
+	}
+
+	return shaped_run_cache.emplace(string, std::move(run)).first->second;
+}
+
+void FontFaceHandleDefault::ShapeRun(const String& string, ShapedRun& run, bool& cacheable)
+{
+	run.glyphs.reserve(string.size());
+
+	Character prior_character = Character::Null;
+	for (auto it_string = StringIteratorU8(string); it_string; ++it_string)
+		ShapeCharacter(*it_string, int(it_string.offset()), run, prior_character, cacheable);
+}
+
+void FontFaceHandleDefault::ShapeCharacter(Character character, int string_offset, ShapedRun& run, Character& prior_character, bool& cacheable)
+{
+	const Character code_point = character;
+	const FontGlyph* glyph = GetOrAppendGlyph(character);
+
+	// Missing glyphs may later be provided by a newly added fallback font, so don't cache runs containing them.
+	const bool is_control_character = ((char32_t)code_point < (char32_t)' ');
+	if ((!glyph && !is_control_character) || character != code_point)
+		cacheable = false;
+
+	if (!glyph)
+		return;
+
+	// Adjust the cursor for the kerning between this character and the previous one.
+	run.width += GetKerning(prior_character, character);
+
+	run.glyphs.push_back(ShapedGlyph{character, string_offset, Vector2i(run.width, 0), glyph->color_format == ColorFormat::RGBA8});
+
+	// Adjust the cursor for this character's advance.
+	run.width += glyph->advance;
+
+	prior_character = character;
+}
+
+#ifdef RMLUI_ENABLE_HARFBUZZ
+bool FontFaceHandleDefault::ShapeRunHarfBuzz(const String& string, ShapedRun& run, bool& cacheable)
+{
+	// Bitmap fonts which are scaled to reach our size are laid out by the built-in shaper, which accounts for the scaling.
+	if (!FreeType::SetFaceSize(ft_face, metrics.size))
+		return false;
+
+	if (!harfbuzz_font)
+		harfbuzz_font = HarfBuzz::CreateShapingFont(ft_face);
+
+	Vector<HarfBuzz::GlyphPosition> shaped_glyphs;
+	if (!HarfBuzz::Shape(harfbuzz_font, string, shaped_glyphs))
+		return false;
+
+	// The clusters in logical order, to find the characters each cluster spans. Glyphs are in visual order, which is reversed for
+	// right-to-left text.
+	Vector<uint32_t> cluster_offsets;
+	cluster_offsets.reserve(shaped_glyphs.size());
+	for (const HarfBuzz::GlyphPosition& shaped_glyph : shaped_glyphs)
+		cluster_offsets.push_back(shaped_glyph.cluster);
+	std::sort(cluster_offsets.begin(), cluster_offsets.end());
+	cluster_offsets.erase(std::unique(cluster_offsets.begin(), cluster_offsets.end()), cluster_offsets.end());
+
+	run.glyphs.reserve(shaped_glyphs.size());
+
+	for (size_t i = 0; i < shaped_glyphs.size();)
+	{
+		// The glyphs of a cluster are adjacent.
+		const uint32_t cluster = shaped_glyphs[i].cluster;
+		size_t cluster_glyphs_end = i + 1;
+		bool has_missing_glyph = (shaped_glyphs[i].glyph_index == 0);
+		for (; cluster_glyphs_end < shaped_glyphs.size() && shaped_glyphs[cluster_glyphs_end].cluster == cluster; cluster_glyphs_end++)
+			has_missing_glyph |= (shaped_glyphs[cluster_glyphs_end].glyph_index == 0);
+
+		const auto it_cluster_end = std::upper_bound(cluster_offsets.begin(), cluster_offsets.end(), cluster);
+		const size_t cluster_size = (it_cluster_end == cluster_offsets.end() ? string.size() : size_t(*it_cluster_end)) - cluster;
+
+		StringIteratorU8 it_cluster(string, cluster, cluster_size);
+		const Character first_character = *it_cluster;
+
+		if (has_missing_glyph)
+		{
+			// Lay out the characters of the cluster one by one, looking for them in the fallback fonts.
+			Character prior_character = Character::Null;
+			for (; it_cluster; ++it_cluster)
+				ShapeCharacter(*it_cluster, int(it_cluster.offset()), run, prior_character, cacheable);
+		}
+		else if ((char32_t)first_character >= (char32_t)' ')
+		{
+			// Glyphs representing a single character are stored by their character, so that they are shared with the glyphs of the built-in
+			// shaper and fallback fonts. Other glyphs, such as ligatures and contextual forms, are stored by their glyph index.
+			StringIteratorU8 it_next_character = it_cluster;
+			++it_next_character;
+			const bool is_single_character = (cluster_glyphs_end == i + 1 && !it_next_character &&
+				FreeType::GetGlyphIndex(ft_face, first_character) == shaped_glyphs[i].glyph_index);
+
+			for (size_t j = i; j < cluster_glyphs_end; j++)
+			{
+				const HarfBuzz::GlyphPosition& shaped_glyph = shaped_glyphs[j];
+
+				Character character = (is_single_character ? first_character : GetGlyphIndexCharacter(shaped_glyph.glyph_index));
+				const FontGlyph* glyph = GetOrAppendGlyph(character, false);
+				if (glyph)
+				{
+					const Vector2i offset((shaped_glyph.x_offset + 32) >> 6, -((shaped_glyph.y_offset + 32) >> 6));
+					run.glyphs.push_back(
+						ShapedGlyph{character, int(cluster), Vector2i(run.width, 0) + offset, glyph->color_format == ColorFormat::RGBA8});
+				}
+
+				run.width += (shaped_glyph.x_advance + 32) >> 6;
+			}
+		}
+
+		i = cluster_glyphs_end;
+	}
+
+	return true;
+}
+#endif
+
 bool FontFaceHandleDefault::AppendGlyph(Character character)
 {
+	if (distance_field)
+		return FreeType::AppendGlyph(ft_face, metrics.size, character, glyphs, false) && distance_field->AddGlyph(character);
+
 	bool result = FreeType::AppendGlyph(ft_face, metrics.size, character, glyphs);
 	return result;
 }
 
-void FontFaceHandleDefault::FillKerningPairCache()
+void FontFaceHandleDefault::LoadKerningTable()
 {
-	if (!has_kerning)
-		return;
+	if (kerning_pairs)
+		FreeType::ScaleKerningPairs(ft_face, metrics.size, *kerning_pairs, kerning_table);
+	else
+		FillKerningPairCache(ft_face, metrics.size, kerning_table);
+}
 
+void FontFaceHandleDefault::FillKerningPairCache(FontFaceHandleFreetype face, int font_size, FontKerningTable& kerning_table)
+{
 	for (char32_t i = KerningCache_AsciiSubsetBegin; i <= KerningCache_AsciiSubsetLast; i++)
 	{
 		for (char32_t j = KerningCache_AsciiSubsetBegin; j <= KerningCache_AsciiSubsetLast; j++)
@@ -347,15 +767,58 @@ void FontFaceHandleDefault::FillKerningPairCache()
 			const bool first_iteration = (i == KerningCache_AsciiSubsetBegin && j == KerningCache_AsciiSubsetBegin);
 
 			// Fetch the kerning from the font face. Submit zero font size on subsequent iterations for performance reasons.
-			const int kerning = FreeType::GetKerning(ft_face, first_iteration ? metrics.size : 0, Character(i), Character(j));
+			const int kerning = FreeType::GetKerning(face, first_iteration ? font_size : 0, Character(i), Character(j));
 			if (kerning != 0)
 			{
-				kerning_pair_cache.emplace(AsciiPair((i << 8) | j), KerningIntType(kerning));
+				kerning_table.emplace(GetKerningKey(Character(i), Character(j)), int16_t(kerning));
 			}
 		}
 	}
 }
 
+void FontFaceHandleDefault::MergePrerasterizedGlyphs()
+{
+	prerasterize_job->Wait();
+	prerasterize_job.reset();
+
+	PrerasterizedGlyphs& result = *prerasterized_glyphs;
+	if (result.success)
+	{
+		for (auto& pair : result.glyphs)
+			glyphs.emplace(pair.first, std::move(pair.second));
+
+		if (has_kerning && !kerning_pairs)
+			kerning_table = std::move(result.kerning_table);
+	}
+	else
+	{
+		// Glyphs will instead be added on demand, but we still need the kerning pairs.
+		if (has_kerning && !kerning_pairs)
+			FillKerningPairCache(ft_face, metrics.size, kerning_table);
+	}
+
+	prerasterized_glyphs.reset();
+	is_layers_dirty = true;
+}
+
+void FontFaceHandleDefault::UpdatePendingLayers()
+{
+	bool textures_completed = false;
+	has_pending_layers = false;
+
+	for (auto& pair : layers)
+	{
+		if (pair.layer->UpdatePendingTextures())
+			textures_completed = true;
+		if (pair.layer->HasPendingTextures())
+			has_pending_layers = true;
+	}
+
+	// Geometry generated while the textures were pending is missing those layers, thus it must be regenerated.
+	if (textures_completed)
+		++version;
+}
+
 int FontFaceHandleDefault::GetKerning(Character lhs, Character rhs) const
 {
 	static_assert(' ' == 32, "Only ASCII/UTF8 character set supported.");
@@ -364,21 +827,18 @@ int FontFaceHandleDefault::GetKerning(Character lhs, Character rhs) const
 	if (!has_kerning || char32_t(lhs) < ' ' || char32_t(rhs) < ' ')
 		return 0;
 
-	// See if the kerning pair has been cached.
+	const auto it = kerning_table.find(GetKerningKey(lhs, rhs));
+	if (it != kerning_table.end())
+		return it->second;
+
+	// The table holds every non-zero pair of the face when built from its kerning pairs, otherwise only the common characters are cached.
+	if (kerning_pairs)
+		return 0;
+
 	const bool lhs_in_cache = (char32_t(lhs) >= KerningCache_AsciiSubsetBegin && char32_t(lhs) <= KerningCache_AsciiSubsetLast);
 	const bool rhs_in_cache = (char32_t(rhs) >= KerningCache_AsciiSubsetBegin && char32_t(rhs) <= KerningCache_AsciiSubsetLast);
-
 	if (lhs_in_cache && rhs_in_cache)
-	{
-		const auto it = kerning_pair_cache.find(AsciiPair((int(lhs) << 8) | int(rhs)));
-
-		if (it != kerning_pair_cache.end())
-		{
-			return it->second;
-		}
-
 		return 0;
-	}
 
 	// Fetch it from the font face instead.
 	const int result = FreeType::GetKerning(ft_face, metrics.size, lhs, rhs);
@@ -387,6 +847,16 @@ int FontFaceHandleDefault::GetKerning(Character lhs, Character rhs) const
 
 const FontGlyph* FontFaceHandleDefault::GetOrAppendGlyph(Character& character, bool look_in_fallback_fonts)
 {
+	if (prerasterize_job)
+	{
+		MergePrerasterizedGlyphs();
+	}
+	else if (is_kerning_table_released)
+	{
+		is_kerning_table_released = false;
+		LoadKerningTable();
+	}
+
 	// Don't try to render control characters
 	if ((char32_t)character < (char32_t)' ')
 		return nullptr;
@@ -419,8 +889,19 @@ const FontGlyph* FontFaceHandleDefault::GetOrAppendGlyph(Character& character, b
 				const FontGlyph* glyph = fallback_face->GetOrAppendGlyph(character, false);
 				if (glyph)
 				{
-					// Insert the new glyph into our own set of glyphs
-					auto pair = glyphs.emplace(character, glyph->WeakCopy());
+					// Insert the new glyph into our own set of glyphs. Glyphs of distance field handles have no bitmap of their own, in that case
+					// rasterize the glyph from the fallback face at our size instead.
+					if (fallback_face->distance_field)
+					{
+						if (!FreeType::AppendGlyph(fallback_face->ft_face, metrics.size, character, glyphs))
+							continue;
+						it_glyph = glyphs.find(character);
+						is_layers_dirty = true;
+						break;
+					}
+
+					// Copy the bitmap too, the resources of the fallback handle may be released independently of ours.
+					auto pair = glyphs.emplace(character, CopyGlyph(*glyph));
 					it_glyph = pair.first;
 					if(pair.second)
 						is_layers_dirty = true;
@@ -462,12 +943,13 @@ FontFaceLayer* FontFaceHandleDefault::GetOrCreateLayer(const SharedPtr<const Fon
 	auto& layer = layers.back().layer;
 	
 	layer = MakeUnique<FontFaceLayer>(font_effect);
-	GenerateLayer(layer.get());
+	bool geometry_invalidated = false;
+	GenerateLayer(layer.get(), geometry_invalidated);
 
 	return layer.get();
 }
 
-bool FontFaceHandleDefault::GenerateLayer(FontFaceLayer* layer)
+bool FontFaceHandleDefault::GenerateLayer(FontFaceLayer* layer, bool& out_geometry_invalidated)
 {
 	RMLUI_ASSERT(layer);
 	const FontEffect* font_effect = layer->GetFontEffect();
@@ -475,7 +957,7 @@ bool FontFaceHandleDefault::GenerateLayer(FontFaceLayer* layer)
 
 	if (!font_effect)
 	{
-		result = layer->Generate(this);
+		result = layer->Generate(this, out_geometry_invalidated);
 	}
 	else
 	{
@@ -498,13 +980,18 @@ bool FontFaceHandleDefault::GenerateLayer(FontFaceLayer* layer)
 		}
 
 		// Create a new layer.
-		result = layer->Generate(this, clone, clone_glyph_origins);
+		result = layer->Generate(this, out_geometry_invalidated, clone, clone_glyph_origins);
 
 		// Cache the layer in the layer cache if it generated its own textures (ie, didn't clone).
 		if (!clone)
 			layer_cache[fingerprint] = layer;
 	}
 
+	if (layer->HasPendingTextures())
+		has_pending_layers = true;
+
+	FontProvider::DirtyMemoryUsage();
+
 	return result;
 }
 
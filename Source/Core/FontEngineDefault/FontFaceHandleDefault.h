@@ -31,14 +31,19 @@
 
 #include "../../../Include/RmlUi/Core/Traits.h"
 #include "../../../Include/RmlUi/Core/FontEffect.h"
+#include "../../../Include/RmlUi/Core/FontEngineInterface.h"
 #include "../../../Include/RmlUi/Core/FontGlyph.h"
 #include "../../../Include/RmlUi/Core/Geometry.h"
 #include "../../../Include/RmlUi/Core/Texture.h"
+#include "FontGlyphTable.h"
 #include "FontTypes.h"
 
 namespace Rml {
 
+struct FontFaceMemoryUsage;
+class FontFaceDistanceField;
 class FontFaceLayer;
+class FontWorkerJob;
 
 
 /**
@@ -51,7 +56,11 @@ public:
 	FontFaceHandleDefault();
 	~FontFaceHandleDefault();
 
-	bool Initialize(FontFaceHandleFreetype face, int font_size, bool load_default_glyphs);
+	/// Initializes the handle for the given face and size.
+	/// @param[in] distance_field The distance field atlas of the face to render glyphs from, or nullptr to rasterize glyphs at this size.
+	/// @param[in] kerning_pairs The kerning pairs of the face, or nullptr to query the kerning of each pair from the face. Must outlive the handle.
+	bool Initialize(FontFaceHandleFreetype face, int font_size, bool load_default_glyphs, FontFaceDistanceField* distance_field = nullptr,
+		const FontKerningPairList* kerning_pairs = nullptr);
 
 	/// Returns the point size of this font face.
 	int GetSize() const;
@@ -67,7 +76,10 @@ public:
 	float GetUnderline(float& thickness) const;
 
 	/// Returns the font's glyphs.
-	const FontGlyphMap& GetGlyphs() const;
+	const FontGlyphTable& GetGlyphs() const;
+
+	/// Returns the distance field atlas glyphs are rendered from, or nullptr if glyphs are rasterized for this handle.
+	FontFaceDistanceField* GetDistanceField() const;
 
 	/// Returns the width a string will take up if rendered with this handle.
 	/// @param[in] string The string to measure.
@@ -84,8 +96,13 @@ public:
 	/// @param[out] texture_dimensions The dimensions of the texture.
 	/// @param[in] font_effect The font effect used for the layer.
 	/// @param[in] texture_id The index of the texture within the layer to generate.
-	/// @param[in] handle_version The version of the handle data. Function returns false if out of date.
-	bool GenerateLayerTexture(UniquePtr<const byte[]>& texture_data, Vector2i& texture_dimensions, const FontEffect* font_effect, int texture_id, int handle_version) const;
+	bool GenerateLayerTexture(UniquePtr<const byte[]>& texture_data, Vector2i& texture_dimensions, const FontEffect* font_effect, int texture_id) const;
+
+	/// Appends the glyphs of a string and their placement, as shaped for rendering.
+	/// @param[in] string The string to shape.
+	/// @param[out] glyphs The list to append the glyphs to, in visual order.
+	/// @return The width, in pixels, of the shaped string.
+	int ShapeString(const String& string, Vector<ShapedGlyphPosition>& glyphs);
 
 	/// Generates the geometry required to render a single line of text.
 	/// @param[out] geometry An array of geometries to generate the geometry into.
@@ -97,15 +114,52 @@ public:
 	/// @return The width, in pixels, of the string geometry.
 	int GenerateString(GeometryList& geometry, const String& string, Vector2f position, Colourb colour, float opacity, int layer_configuration = 0);
 
-	/// Version is changed whenever the layers are dirtied, requiring regeneration of string geometry.
-	int GetVersion() const;
+	/// Version is changed whenever existing string geometry is invalidated, requiring it to be regenerated.
+	int GetVersion();
+
+	/// Returns the number of shaped runs currently cached.
+	int GetNumShapedRuns() const;
+
+	/// Returns the usage tick at which the handle was last used to measure or render text.
+	uint64_t GetLastUsed() const;
+	/// Fills in the memory used by the glyphs, layers and caches of the handle. The distance field atlas is shared by the face, and not included.
+	void GetMemoryUsage(FontFaceMemoryUsage& usage) const;
+
+	struct LayerUsage {
+		FontFaceLayer* layer;
+		uint64_t last_used;
+		size_t texture_bytes;
+	};
+	/// Returns the font effect layers which generated textures of their own, along with the usage tick at which each was last used to render text.
+	/// Layers rendered by geometry which is still valid are considered used as long as the handle itself is.
+	void GetLayerUsage(Vector<LayerUsage>& out_layers) const;
+
+	/// Releases the textures of a font effect layer, and of the layers sharing them. The layers are generated anew when next used.
+	void ReleaseLayer(FontFaceLayer* layer);
+	/// Releases the glyphs, layers and caches of the handle, keeping only its metrics. They are generated anew when next used.
+	void ReleaseResources();
+	/// Invalidates existing geometry if any of its layers are only considered used because the handle was used since the given tick. Once the
+	/// geometry is regenerated, the layers which are still in use are marked again.
+	void RefreshLayerUsage(uint64_t since_tick);
+
+	/// Returns the current usage tick, which is advanced whenever a handle is used.
+	static uint64_t GetUsageTick();
 
 private:
 	// Build and append glyph to 'glyphs'
 	bool AppendGlyph(Character character);
 
-	// Build a kerning cache for common characters.
-	void FillKerningPairCache();
+	// Build the kerning table for the size of this handle.
+	void LoadKerningTable();
+
+	// Build a kerning cache for common characters, for faces without a list of kerning pairs.
+	static void FillKerningPairCache(FontFaceHandleFreetype face, int font_size, FontKerningTable& kerning_table);
+
+	// Merge the glyphs and kerning pairs built by the worker threads, waiting for them if necessary.
+	void MergePrerasterizedGlyphs();
+
+	// Pick up textures of font effect layers completed by the worker threads.
+	void UpdatePendingLayers();
 
 	// Return the kerning for a character pair.
 	int GetKerning(Character lhs, Character rhs) const;
@@ -122,10 +176,37 @@ private:
 	// Create a new layer from the given font effect if it does not already exist.
 	FontFaceLayer* GetOrCreateLayer(const SharedPtr<const FontEffect>& font_effect);
 
-	// (Re-)generate a layer in this font face handle.
-	bool GenerateLayer(FontFaceLayer* layer);
+	// (Re-)generate a layer in this font face handle. Sets the output to true if existing geometry from this layer was invalidated.
+	bool GenerateLayer(FontFaceLayer* layer, bool& out_geometry_invalidated);
+
+	struct ShapedGlyph {
+		Character character;
+		int string_offset;
+		Vector2i position;
+		bool is_color;
+	};
+	struct ShapedRun {
+		Vector<ShapedGlyph> glyphs;
+		int width = 0;
+	};
 
-	FontGlyphMap glyphs;
+	// Retrieve the glyphs and their positions for the given string, shaping and caching the run if not already cached.
+	const ShapedRun& GetShapedRun(const String& string);
+
+	// The built-in shaper, laying out one glyph per character with kerning between the pairs. Clears 'cacheable' if the run depends on
+	// glyphs which may later change, such as those missing from all the fonts.
+	void ShapeRun(const String& string, ShapedRun& run, bool& cacheable);
+	// Append the glyph of a single character at the given offset in the string to the run, kerned against the prior character.
+	void ShapeCharacter(Character character, int string_offset, ShapedRun& run, Character& prior_character, bool& cacheable);
+
+#ifdef RMLUI_ENABLE_HARFBUZZ
+	// Shape the run with HarfBuzz, for ligatures and complex scripts. Returns false if the built-in shaper should be used instead.
+	bool ShapeRunHarfBuzz(const String& string, ShapedRun& run, bool& cacheable);
+
+	FontFaceHandleHarfBuzz harfbuzz_font = 0;
+#endif
+
+	FontGlyphTable glyphs;
 
 	struct EffectLayerPair {
 		const FontEffect* font_effect;
@@ -142,22 +223,59 @@ private:
 	// Each font layer that generated geometry or textures, indexed by the font-effect's fingerprint key.
 	FontLayerCache layer_cache;
 
-	// Pre-cache kerning pairs for some ascii subset of all characters.
-	using AsciiPair = std::uint16_t;
-	using KerningIntType = std::int16_t;
-	using KerningPairs = UnorderedMap< AsciiPair, KerningIntType >;
-	KerningPairs kerning_pair_cache;
+	// The kerning of the pairs of the face scaled to this size. Without a list of kerning pairs, only pairs of common characters are cached.
+	FontKerningTable kerning_table;
+	const FontKerningPairList* kerning_pairs = nullptr;
+
+	struct PrerasterizedGlyphs {
+		FontGlyphTable glyphs;
+		FontKerningTable kerning_table;
+		bool success = false;
+	};
+
+	// The default glyphs and kerning pairs, being built on a worker thread. Merged into the handle on first use.
+	SharedPtr<FontWorkerJob> prerasterize_job;
+	SharedPtr<PrerasterizedGlyphs> prerasterized_glyphs;
+
+	// Shaped runs shared between string measurement and geometry generation, keyed by the string contents. The cache is split into the
+	// current and the previous generation, runs are only dropped if unused for a whole generation.
+	using ShapedRunCache = UnorderedMap< String, ShapedRun >;
+	ShapedRunCache shaped_run_cache;
+	ShapedRunCache shaped_run_cache_previous;
+	// Runs which can not be cached, such as those using the replacement character, are shaped here.
+	ShapedRun uncached_shaped_run;
 
 	bool has_kerning = false;
 	bool is_layers_dirty = false;
+	// Set when string geometry was generated while glyphs were missing from the layers.
+	bool is_geometry_incomplete = false;
+	// Set while any layer is waiting for its textures to be generated by the worker threads.
+	bool has_pending_layers = false;
+	// Set when the kerning table was released, it is built again on next use.
+	bool is_kerning_table_released = false;
 	int version = 0;
 
 	// All configurations currently in use on this handle. New configurations will be generated as required.
 	LayerConfigurationList layer_configurations;
 
+	struct LayerConfigurationUsage {
+		uint64_t last_used = 0;
+		// The handle version at which the configuration last generated geometry.
+		int version = -1;
+	};
+	// The usage of each layer configuration, by configuration index.
+	Vector<LayerConfigurationUsage> layer_configuration_usage;
+
+	uint64_t last_used = 0;
+
 	FontMetrics metrics;
 
 	FontFaceHandleFreetype ft_face;
+
+	// In distance field mode, glyphs without a bitmap of their own are rendered from this atlas, which is shared with the other sizes of the face.
+	FontFaceDistanceField* distance_field = nullptr;
+	// The version of the atlas the layers were last generated from.
+	int distance_field_version = 0;
 };
 
 } // namespace Rml
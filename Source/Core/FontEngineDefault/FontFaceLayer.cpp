@@ -27,7 +27,10 @@
  */
 
 #include "FontFaceLayer.h"
+#include "FontFaceDistanceField.h"
 #include "FontFaceHandleDefault.h"
+#include "FontWorker.h"
+#include <algorithm>
 #include <string.h>
 
 namespace Rml {
@@ -40,30 +43,33 @@ FontFaceLayer::FontFaceLayer(const SharedPtr<const FontEffect>& _effect) : colou
 }
 
 FontFaceLayer::~FontFaceLayer()
-{}
-
-bool FontFaceLayer::Generate(const FontFaceHandleDefault* handle, const FontFaceLayer* clone, bool clone_glyph_origins)
 {
-	// Clear the old layout if it exists.
+	for (auto& job : texture_jobs)
 	{
-		// @performance: We could be much smarter about this, e.g. such as adding new glyphs to the existing texture layout and textures.
-		// Right now we re-generate the whole thing, including textures.
-		texture_layout = TextureLayout{};
-		character_boxes.clear();
-		textures.clear();
+		if (job)
+			job->Cancel();
 	}
+}
+
+bool FontFaceLayer::Generate(const FontFaceHandleDefault* handle, bool& out_geometry_invalidated, const FontFaceLayer* clone, bool clone_glyph_origins)
+{
+	const FontGlyphTable& glyphs = handle->GetGlyphs();
+
+	is_released = false;
 
-	const FontGlyphMap& glyphs = handle->GetGlyphs();
+	GenerateDistanceField(handle, out_geometry_invalidated, clone);
 
 	// Generate the new layout.
 	if (clone)
 	{
+		// Existing geometry remains valid as long as the cloned layer kept its textures.
+		if (textures != clone->textures)
+			out_geometry_invalidated = true;
+
 		// Clone the geometry and textures from the clone layer.
 		character_boxes = clone->character_boxes;
-
-		// Copy the cloned layer's textures.
-		for (size_t i = 0; i < clone->textures.size(); ++i)
-			textures.push_back(clone->textures[i]);
+		textures = clone->textures;
+		texture_jobs = clone->texture_jobs;
 
 		// Request the effect (if we have one) and adjust the origins as appropriate.
 		if (effect && !clone_glyph_origins)
@@ -95,13 +101,27 @@ bool FontFaceLayer::Generate(const FontFaceHandleDefault* handle, const FontFace
 	}
 	else
 	{
-		// Initialise the texture layout for the glyphs.
+		// Add the glyphs which are new since the last generation to the texture layout. The existing glyphs keep their place
+		// in the layout, thus only the textures receiving new glyphs (or growing in size) need to be regenerated. Glyphs which
+		// could not be placed previously are still pending in the layout, and are attempted again along with the new ones.
+		const int first_new_rectangle = texture_layout.GetNumLaidOutRectangles();
+
 		character_boxes.reserve(glyphs.size());
 		for (auto& pair : glyphs)
 		{
 			Character character = pair.first;
 			const FontGlyph& glyph = pair.second;
 
+			if (character_boxes.find(character) != character_boxes.end())
+				continue;
+
+			// In distance field mode, only glyphs with a bitmap of their own are placed on our textures, such as those of fallback fonts.
+			if (handle->GetDistanceField() && !glyph.bitmap_data)
+				continue;
+
+			// Insert the box first, so that characters without any texture data are not reconsidered on later generations.
+			TextureBox& box = character_boxes[character];
+
 			Vector2i glyph_origin(0, 0);
 			Vector2i glyph_dimensions = glyph.bitmap_dimensions;
 
@@ -112,38 +132,59 @@ bool FontFaceLayer::Generate(const FontFaceHandleDefault* handle, const FontFace
 					continue;
 			}
 
-			TextureBox box;
 			box.origin = Vector2f(float(glyph_origin.x + glyph.bearing.x), float(glyph_origin.y - glyph.bearing.y));
 			box.dimensions = Vector2f(glyph_dimensions);
 			
 			RMLUI_ASSERT(box.dimensions.x >= 0 && box.dimensions.y >= 0);
 
-			character_boxes[character] = box;
-
 			// Add the character's dimensions into the texture layout engine.
 			texture_layout.AddRectangle((int)character, glyph_dimensions);
 		}
 
+		if (first_new_rectangle == texture_layout.GetNumRectangles())
+			return true;
+
+		Vector<Vector2i> previous_texture_dimensions(texture_layout.GetNumTextures());
+		for (int i = 0; i < texture_layout.GetNumTextures(); ++i)
+			previous_texture_dimensions[i] = texture_layout.GetTexture(i).GetDimensions();
+
 		constexpr int max_texture_dimensions = 1024;
 
-		// Generate the texture layout; this will position the glyph rectangles efficiently and
-		// allocate the texture data ready for writing.
-		if (!texture_layout.GenerateLayout(max_texture_dimensions))
-			return false;
+		// Generate the texture layout; this will position the new glyph rectangles efficiently around the existing ones.
+		const bool layout_result = texture_layout.GenerateLayout(max_texture_dimensions);
+
+		// Find the textures which need to be regenerated. New textures, and textures which changed size, must also update the
+		// texture coordinates of the glyphs already placed on them.
+		const int num_textures = texture_layout.GetNumTextures();
+		Vector<bool> dirty_textures(num_textures, false);
+		Vector<bool> resized_textures(num_textures, false);
 
+		for (int i = 0; i < num_textures; ++i)
+		{
+			if (i >= (int)previous_texture_dimensions.size() || previous_texture_dimensions[i] != texture_layout.GetTexture(i).GetDimensions())
+				dirty_textures[i] = resized_textures[i] = true;
+		}
+
+		const bool any_resized_textures = (std::find(resized_textures.begin(), resized_textures.end(), true) != resized_textures.end());
 
-		// Iterate over each rectangle in the layout, copying the glyph data into the rectangle as
-		// appropriate and generating geometry.
-		for (int i = 0; i < texture_layout.GetNumRectangles(); ++i)
+		// Iterate over each new rectangle in the layout, or all of them if a texture was resized, generating texture coordinates as
+		// appropriate. The glyph data is copied into the rectangles when generating the textures.
+		for (int i = (any_resized_textures ? 0 : first_new_rectangle); i < texture_layout.GetNumRectangles(); ++i)
 		{
 			TextureLayoutRectangle& rectangle = texture_layout.GetRectangle(i);
-			const TextureLayoutTexture& texture = texture_layout.GetTexture(rectangle.GetTextureIndex());
+			const int texture_index = rectangle.GetTextureIndex();
+
+			if (texture_index < 0 || (i < first_new_rectangle && !resized_textures[texture_index]))
+				continue;
+
+			const TextureLayoutTexture& texture = texture_layout.GetTexture(texture_index);
 			Character character = (Character)rectangle.GetId();
 			RMLUI_ASSERT(character_boxes.find(character) != character_boxes.end());
 			TextureBox& box = character_boxes[character];
 
 			// Set the character's texture index.
-			box.texture_index = rectangle.GetTextureIndex();
+			box.texture_index = texture_index;
+			dirty_textures[texture_index] = true;
 
 			// Generate the character's texture coordinates.
 			box.texcoords[0].x = float(rectangle.GetPosition().x) / float(texture.GetDimensions().x);
@@ -153,47 +194,275 @@ bool FontFaceLayer::Generate(const FontFaceHandleDefault* handle, const FontFace
 		}
 
 		const FontEffect* effect_ptr = effect.get();
-		const int handle_version = handle->GetVersion();
 
-		// Generate the textures.
-		for (int i = 0; i < texture_layout.GetNumTextures(); ++i)
+		// Adding textures may relocate the existing ones, thus geometry referring to them must be regenerated.
+		if ((int)textures.size() != num_textures)
 		{
+			textures.resize(num_textures);
+			texture_jobs.resize(num_textures);
+			out_geometry_invalidated = true;
+		}
+
+		for (int i = 0; i < num_textures; ++i)
+		{
+			if (!dirty_textures[i])
+				continue;
+
+			// Textures which kept their size only need to upload the new glyphs, leaving their handle and existing geometry intact. Pending
+			// textures are instead generated anew, as their data is not yet available to update.
+			if (!resized_textures[i] && !texture_jobs[i])
+			{
+				if (!UpdateTexture(i, first_new_rectangle, glyphs))
+					out_geometry_invalidated = true;
+				continue;
+			}
+
+			out_geometry_invalidated = true;
+
+			// Font effects can be expensive to generate, leave them to the worker threads when enabled.
+			if (effect && FontWorker::IsEnabled())
+			{
+				GenerateTextureAsync(handle, i, glyphs);
+				continue;
+			}
+
+			// Otherwise, give the texture a new resource so that its data is generated anew on next use.
 			int texture_id = i;
 
-			TextureCallback texture_callback = [handle, effect_ptr, texture_id, handle_version](const String& /*name*/, UniquePtr<const byte[]>& data, Vector2i& dimensions) -> bool {
-				bool result = handle->GenerateLayerTexture(data, dimensions, effect_ptr, texture_id, handle_version);
+			TextureCallback texture_callback = [handle, effect_ptr, texture_id](const String& /*name*/, UniquePtr<const byte[]>& data, Vector2i& dimensions) -> bool {
+				bool result = handle->GenerateLayerTexture(data, dimensions, effect_ptr, texture_id);
 				return result;
 			};
 
-			Texture texture;
-			texture.Set("font-face-layer", texture_callback);
-			textures.push_back(texture);
+			textures[i].Set("font-face-layer", texture_callback);
 		}
+
+		if (!layout_result)
+			return false;
 	}
 
 	return true;
 }
 
+void FontFaceLayer::Release()
+{
+	for (auto& job : texture_jobs)
+	{
+		if (job)
+			job->Cancel();
+	}
+
+	texture_layout = TextureLayout();
+	CharacterMap().swap(character_boxes);
+	TextureList().swap(textures);
+	TextureJobList().swap(texture_jobs);
+
+	CharacterMap().swap(distance_field_boxes);
+	TextureList().swap(distance_field_textures);
+	distance_field_version = -1;
+	distance_field_texture_memory = 0;
+
+	is_released = true;
+}
+
+bool FontFaceLayer::IsReleased() const
+{
+	return is_released;
+}
+
 // Generates the texture data for a layer (for the texture database).
-bool FontFaceLayer::GenerateTexture(UniquePtr<const byte[]>& texture_data, Vector2i& texture_dimensions, int texture_id, const FontGlyphMap& glyphs)
+bool FontFaceLayer::GenerateTexture(UniquePtr<const byte[]>& texture_data, Vector2i& texture_dimensions, int texture_id, const FontGlyphTable& glyphs)
 {
 	if (texture_id < 0 ||
-		texture_id > texture_layout.GetNumTextures())
+		texture_id >= texture_layout.GetNumTextures())
 		return false;
 
 	// Generate the texture data.
-	texture_data = texture_layout.GetTexture(texture_id).AllocateTexture();
+	texture_data = texture_layout.GetTexture(texture_id).AllocateTexture(texture_layout);
 	texture_dimensions = texture_layout.GetTexture(texture_id).GetDimensions();
 
 	for (int i = 0; i < texture_layout.GetNumRectangles(); ++i)
 	{
 		TextureLayoutRectangle& rectangle = texture_layout.GetRectangle(i);
+		if (rectangle.GetTextureIndex() != texture_id)
+			continue;
+
 		Character character = (Character)rectangle.GetId();
 		RMLUI_ASSERT(character_boxes.find(character) != character_boxes.end());
 
 		TextureBox& box = character_boxes[character];
 
-		if (box.texture_index != texture_id)
+		auto it = glyphs.find((Character)rectangle.GetId());
+		if (it == glyphs.end())
+			continue;
+
+		const FontGlyph& glyph = it->second;
+
+		WriteGlyphData(effect.get(), rectangle.GetTextureData(), rectangle.GetTextureStride(), Vector2i(box.dimensions), glyph);
+	}
+
+	return true;
+}
+
+bool FontFaceLayer::UpdateTexture(int texture_id, int first_rectangle, const FontGlyphTable& glyphs)
+{
+	bool result = true;
+
+	for (int i = first_rectangle; i < texture_layout.GetNumRectangles(); ++i)
+	{
+		TextureLayoutRectangle& rectangle = texture_layout.GetRectangle(i);
+		const Vector2i dimensions = rectangle.GetDimensions();
+		if (rectangle.GetTextureIndex() != texture_id || dimensions.x <= 0 || dimensions.y <= 0)
+			continue;
+
+		Character character = (Character)rectangle.GetId();
+		auto it = glyphs.find(character);
+		if (it == glyphs.end())
+			continue;
+
+		RMLUI_ASSERT(character_boxes.find(character) != character_boxes.end());
+		const TextureBox& box = character_boxes[character];
+
+		// Generate the data of the rectangle only, the surrounding texture data is left untouched.
+		const int stride = dimensions.x * 4;
+		UniquePtr<byte[]> data(new byte[stride * dimensions.y]);
+		for (int j = 0; j < dimensions.x * dimensions.y; j++)
+			((unsigned int*)(data.get()))[j] = 0x00ffffff;
+
+		WriteGlyphData(effect.get(), data.get(), stride, Vector2i(box.dimensions), it->second);
+
+		if (!textures[texture_id].Update(rectangle.GetPosition(), dimensions, data.get(), stride))
+			result = false;
+	}
+
+	return result;
+}
+
+void FontFaceLayer::GenerateDistanceField(const FontFaceHandleDefault* handle, bool& out_geometry_invalidated, const FontFaceLayer* clone)
+{
+	FontFaceDistanceField* distance_field = handle->GetDistanceField();
+	if (!distance_field)
+		return;
+
+	const bool distance_field_changed = (distance_field->GetVersion() != distance_field_version);
+	distance_field_version = distance_field->GetVersion();
+
+	const FontEffect* effect_ptr = effect.get();
+	const FontEffect::DistanceFieldOutput effect_output = (effect && !clone ? effect->GetDistanceFieldOutput() : FontEffect::DistanceFieldOutput::None);
+
+	// Effects generating their own textures need to support distance fields, otherwise they are not rendered in this mode.
+	if (effect && !clone && effect_output == FontEffect::DistanceFieldOutput::None)
+	{
+		distance_field_boxes.clear();
+		distance_field_textures.clear();
+		distance_field_texture_memory = 0;
+		return;
+	}
+
+	// Scale the boxes of the atlas to our size, and offset them as requested by the effect.
+	const float scale = float(handle->GetSize()) / float(FontFaceDistanceField::ReferenceSize);
+
+	distance_field_boxes.clear();
+	for (auto& pair : handle->GetGlyphs())
+	{
+		const Character character = pair.first;
+		const FontGlyph& glyph = pair.second;
+		if (glyph.bitmap_data)
+			continue;
+
+		const FontFaceDistanceField::GlyphBox* glyph_box = distance_field->GetGlyphBox(character);
+		if (!glyph_box || glyph_box->texture_index < 0)
+			continue;
+
+		TextureBox box;
+		box.origin = glyph_box->origin * scale;
+		box.dimensions = glyph_box->dimensions * scale;
+		box.texcoords[0] = glyph_box->texcoords[0];
+		box.texcoords[1] = glyph_box->texcoords[1];
+		box.texture_index = glyph_box->texture_index;
+
+		if (effect)
+		{
+			const Vector2i glyph_dimensions = Vector2i(box.dimensions);
+			Vector2i effect_origin(0, 0);
+			Vector2i effect_dimensions = glyph_dimensions;
+
+			if (!effect->GetGlyphMetrics(effect_origin, effect_dimensions, glyph))
+				continue;
+
+			box.origin += Vector2f(effect_origin) + Vector2f(effect_dimensions - glyph_dimensions) * 0.5f;
+		}
+
+		distance_field_boxes[character] = box;
+	}
+
+	TextureList new_textures;
+
+	if (clone)
+	{
+		new_textures = clone->distance_field_textures;
+		distance_field_texture_memory = 0;
+	}
+	else if (!effect)
+	{
+		new_textures = distance_field->GetTextures();
+	}
+	else if (distance_field_changed)
+	{
+		// Generate the effect from the distance fields of each atlas texture, at our font size.
+		new_textures.resize(distance_field->GetTextures().size());
+
+		const int font_size = handle->GetSize();
+		const bool is_distance_field = (effect_output == FontEffect::DistanceFieldOutput::DistanceField);
+
+		for (int i = 0; i < (int)new_textures.size(); ++i)
+		{
+			const int texture_id = i;
+			TextureCallback texture_callback = [distance_field, effect_ptr, texture_id, font_size](const String& /*name*/,
+				UniquePtr<const byte[]>& data, Vector2i& dimensions) -> bool {
+				return distance_field->GenerateTexture(data, dimensions, texture_id, effect_ptr, font_size);
+			};
+
+			new_textures[i].Set("font-face-layer-distance-field", texture_callback, is_distance_field);
+		}
+
+		distance_field_texture_memory = distance_field->GetTextureMemoryUsage();
+	}
+	else
+	{
+		return;
+	}
+
+	if (new_textures != distance_field_textures)
+	{
+		distance_field_textures = std::move(new_textures);
+		out_geometry_invalidated = true;
+	}
+}
+
+void FontFaceLayer::GenerateTextureAsync(const FontFaceHandleDefault* handle, const int texture_id, const FontGlyphTable& glyphs)
+{
+	struct GlyphRegion {
+		Vector2i position;
+		Vector2i dimensions;
+		FontGlyph glyph;
+	};
+
+	struct TextureData {
+		Vector<GlyphRegion> regions;
+		Vector2i dimensions;
+		UniquePtr<byte[]> data;
+	};
+
+	// Take a snapshot of everything needed to generate the texture. The glyph bitmaps are copied, as their owning handles may be released
+	// while the job is running.
+	auto texture_data = MakeShared<TextureData>();
+	texture_data->dimensions = texture_layout.GetTexture(texture_id).GetDimensions();
+
+	for (int i = 0; i < texture_layout.GetNumRectangles(); ++i)
+	{
+		TextureLayoutRectangle& rectangle = texture_layout.GetRectangle(i);
+		if (rectangle.GetTextureIndex() != texture_id)
 			continue;
 
 		auto it = glyphs.find((Character)rectangle.GetId());
@@ -202,44 +471,105 @@ bool FontFaceLayer::GenerateTexture(UniquePtr<const byte[]>& texture_data, Vecto
 
 		const FontGlyph& glyph = it->second;
 
-		if (effect == nullptr)
+		GlyphRegion region;
+		region.position = rectangle.GetPosition();
+		region.dimensions = rectangle.GetDimensions();
+		region.glyph = glyph.WeakCopy();
+
+		if (glyph.bitmap_data)
 		{
-			// Copy the glyph's bitmap data into its allocated texture.
-			if (glyph.bitmap_data)
-			{
-				byte* destination = rectangle.GetTextureData();
-				const byte* source = glyph.bitmap_data;
-				const int num_bytes_per_line = glyph.bitmap_dimensions.x * (glyph.color_format == ColorFormat::RGBA8 ? 4 : 1);
+			const size_t num_bytes = size_t(glyph.bitmap_dimensions.x * glyph.bitmap_dimensions.y * (glyph.color_format == ColorFormat::RGBA8 ? 4 : 1));
+			region.glyph.bitmap_owned_data.reset(new byte[num_bytes]);
+			region.glyph.bitmap_data = region.glyph.bitmap_owned_data.get();
+			memcpy(region.glyph.bitmap_owned_data.get(), glyph.bitmap_data, num_bytes);
+		}
+
+		texture_data->regions.push_back(std::move(region));
+	}
+
+	SharedPtr<const FontEffect> job_effect = effect;
+	SharedPtr<FontWorkerJob>& job = texture_jobs[texture_id];
+
+	if (job)
+		job->Cancel();
 
-				for (int j = 0; j < glyph.bitmap_dimensions.y; ++j)
+	job = FontWorker::Submit([job_effect, texture_data]() {
+		const Vector2i dimensions = texture_data->dimensions;
+		const int stride = dimensions.x * 4;
+
+		UniquePtr<byte[]> data(new byte[stride * dimensions.y]);
+
+		// Set the texture to transparent white.
+		for (int i = 0; i < dimensions.x * dimensions.y; i++)
+			((unsigned int*)(data.get()))[i] = 0x00ffffff;
+
+		for (const GlyphRegion& region : texture_data->regions)
+		{
+			if (region.dimensions.x > 0 && region.dimensions.y > 0)
+				WriteGlyphData(job_effect.get(), data.get() + region.position.y * stride + region.position.x * 4, stride, region.dimensions, region.glyph);
+		}
+
+		texture_data->regions.clear();
+		texture_data->data = std::move(data);
+	});
+
+	SharedPtr<FontWorkerJob> texture_job = job;
+	const FontEffect* effect_ptr = effect.get();
+
+	TextureCallback texture_callback = [handle, effect_ptr, texture_id, texture_job, texture_data](const String& /*name*/,
+		UniquePtr<const byte[]>& data, Vector2i& dimensions) -> bool {
+		// Use the data generated by the worker if available. Otherwise, such as when the texture is reloaded, generate it synchronously.
+		texture_job->Wait();
+		if (texture_data->data)
+		{
+			data = std::move(texture_data->data);
+			dimensions = texture_data->dimensions;
+			return true;
+		}
+
+		bool result = handle->GenerateLayerTexture(data, dimensions, effect_ptr, texture_id);
+		return result;
+	};
+
+	textures[texture_id].Set("font-face-layer", texture_callback);
+}
+
+void FontFaceLayer::WriteGlyphData(const FontEffect* effect, byte* destination, int stride, Vector2i dimensions, const FontGlyph& glyph)
+{
+	if (effect == nullptr)
+	{
+		// Copy the glyph's bitmap data into its allocated texture.
+		if (glyph.bitmap_data)
+		{
+			const byte* source = glyph.bitmap_data;
+			const int num_bytes_per_line = glyph.bitmap_dimensions.x * (glyph.color_format == ColorFormat::RGBA8 ? 4 : 1);
+
+			for (int j = 0; j < glyph.bitmap_dimensions.y; ++j)
+			{
+				switch (glyph.color_format)
+				{
+				case ColorFormat::A8:
 				{
-					switch (glyph.color_format)
-					{
-					case ColorFormat::A8:
-					{
-						for (int k = 0; k < num_bytes_per_line; ++k)
-							destination[k * 4 + 3] = source[k];
-					}
-					break;
-					case ColorFormat::RGBA8:
-					{
-						memcpy(destination, source, num_bytes_per_line);
-					}
-					break;
-					}
-
-					destination += rectangle.GetTextureStride();
-					source += num_bytes_per_line;
+					for (int k = 0; k < num_bytes_per_line; ++k)
+						destination[k * 4 + 3] = source[k];
+				}
+				break;
+				case ColorFormat::RGBA8:
+				{
+					memcpy(destination, source, num_bytes_per_line);
+				}
+				break;
 				}
+
+				destination += stride;
+				source += num_bytes_per_line;
 			}
 		}
-		else
-		{
-			effect->GenerateGlyphTexture(rectangle.GetTextureData(), Vector2i(box.dimensions), rectangle.GetTextureStride(), glyph);
-		}
 	}
-
-	return true;
+	else
+	{
+		effect->GenerateGlyphTexture(destination, dimensions, stride, glyph);
+	}
 }
 
 // Returns the effect used to generate the layer.
@@ -248,19 +578,37 @@ const FontEffect* FontFaceLayer::GetFontEffect() const
 	return effect.get();
 }
 
+size_t FontFaceLayer::GetTextureMemoryUsage() const
+{
+	size_t result = distance_field_texture_memory;
+
+	// Layers cloning their textures leave their own layout empty.
+	for (int i = 0; i < texture_layout.GetNumTextures(); ++i)
+	{
+		const Vector2i dimensions = texture_layout.GetTexture(i).GetDimensions();
+		result += size_t(dimensions.x) * size_t(dimensions.y) * 4;
+	}
+
+	return result;
+}
+
 // Returns on the layer's textures.
 const Texture* FontFaceLayer::GetTexture(int index)
 {
 	RMLUI_ASSERT(index >= 0);
 	RMLUI_ASSERT(index < GetNumTextures());
 
-	return &(textures[index]);
+	const int num_distance_field_textures = (int)distance_field_textures.size();
+	if (index < num_distance_field_textures)
+		return &(distance_field_textures[index]);
+
+	return &(textures[index - num_distance_field_textures]);
 }
 
 // Returns the number of textures employed by this layer.
 int FontFaceLayer::GetNumTextures() const
 {
-	return (int)textures.size();
+	return (int)(distance_field_textures.size() + textures.size());
 }
 
 // Returns the layer's colour.
@@ -269,4 +617,25 @@ Colourb FontFaceLayer::GetColour() const
 	return colour;
 }
 
+bool FontFaceLayer::HasPendingTextures() const
+{
+	return std::any_of(texture_jobs.begin(), texture_jobs.end(), [](const SharedPtr<FontWorkerJob>& job) { return job != nullptr; });
+}
+
+bool FontFaceLayer::UpdatePendingTextures()
+{
+	bool result = false;
+
+	for (auto& job : texture_jobs)
+	{
+		if (job && job->IsDone())
+		{
+			job.reset();
+			result = true;
+		}
+	}
+
+	return result;
+}
+
 } // namespace Rml
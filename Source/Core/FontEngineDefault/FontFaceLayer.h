@@ -34,11 +34,13 @@
 #include "../../../Include/RmlUi/Core/GeometryUtilities.h"
 #include "../../../Include/RmlUi/Core/Texture.h"
 #include "../TextureLayout.h"
+#include "FontGlyphTable.h"
 
 namespace Rml {
 
 class FontEffect;
 class FontFaceHandleDefault;
+class FontWorkerJob;
 
 /**
 	A textured layer stored as part of a font face handle. Each handle will have at least a base
@@ -53,19 +55,24 @@ public:
 	FontFaceLayer(const SharedPtr<const FontEffect>& _effect);
 	~FontFaceLayer();
 
-	/// Generates or re-generates the character and texture data for the layer.
+	/// Generates the character and texture data for the layer, or adds any glyphs new to the handle since the last generation.
 	/// @param[in] handle The handle generating this layer.
-	/// @param[in] effect The effect to initialise the layer with.
+	/// @param[out] out_geometry_invalidated Set to true if geometry previously generated from this layer must be regenerated, such as when its textures are replaced.
 	/// @param[in] clone The layer to optionally clone geometry and texture data from.
 	/// @return True if the layer was generated successfully, false if not.
-	bool Generate(const FontFaceHandleDefault* handle, const FontFaceLayer* clone = nullptr, bool clone_glyph_origins = false);
+	bool Generate(const FontFaceHandleDefault* handle, bool& out_geometry_invalidated, const FontFaceLayer* clone = nullptr, bool clone_glyph_origins = false);
+
+	/// Releases the glyph layout and textures of the layer. The layer must be generated anew before it is used again.
+	void Release();
+	/// Returns true if the layer was released and has not been generated since.
+	bool IsReleased() const;
 
 	/// Generates the texture data for a layer (for the texture database).
 	/// @param[out] texture_data The pointer to be set to the generated texture data.
 	/// @param[out] texture_dimensions The dimensions of the texture.
 	/// @param[in] texture_id The index of the texture within the layer to generate.
 	/// @param[in] glyphs The glyphs required by the font face handle.
-	bool GenerateTexture(UniquePtr<const byte[]>& texture_data, Vector2i& texture_dimensions, int texture_id, const FontGlyphMap& glyphs);
+	bool GenerateTexture(UniquePtr<const byte[]>& texture_data, Vector2i& texture_dimensions, int texture_id, const FontGlyphTable& glyphs);
 
 	/// Generates the geometry required to render a single character.
 	/// @param[out] geometry An array of geometries this layer will write to. It must be at least as big as the number of textures in this layer.
@@ -74,29 +81,48 @@ public:
 	/// @param[in] colour The colour of the string.
 	inline void GenerateGeometry(Geometry* geometry, const Character character_code, const Vector2f position, const Colourb colour) const
 	{
-		auto it = character_boxes.find(character_code);
-		if (it == character_boxes.end())
-			return;
-
-		const TextureBox& box = it->second;
-
-		if (box.texture_index < 0)
+		const TextureBox* box = nullptr;
+		int texture_index = -1;
+
+		// Look for the glyph among the distance fields first, the textures of the distance fields are placed before our own textures.
+		auto it = distance_field_boxes.find(character_code);
+		if (it != distance_field_boxes.end())
+		{
+			box = &it->second;
+			texture_index = box->texture_index;
+		}
+		else
+		{
+			it = character_boxes.find(character_code);
+			if (it == character_boxes.end())
+				return;
+
+			box = &it->second;
+
+			// Skip glyphs without texture data, or whose texture is still being generated.
+			if (box->texture_index < 0 || texture_jobs[box->texture_index])
+				return;
+
+			texture_index = (int)distance_field_textures.size() + box->texture_index;
+		}
+
+		if (texture_index < 0)
 			return;
 
 		// Generate the geometry for the character.
-		Vector< Vertex >& character_vertices = geometry[box.texture_index].GetVertices();
-		Vector< int >& character_indices = geometry[box.texture_index].GetIndices();
+		Vector< Vertex >& character_vertices = geometry[texture_index].GetVertices();
+		Vector< int >& character_indices = geometry[texture_index].GetIndices();
 
 		character_vertices.resize(character_vertices.size() + 4);
 		character_indices.resize(character_indices.size() + 6);
 		GeometryUtilities::GenerateQuad(
 			&character_vertices[0] + (character_vertices.size() - 4),
 			&character_indices[0] + (character_indices.size() - 6),
-			Vector2f(position.x + box.origin.x, position.y + box.origin.y).Round(),
-			box.dimensions,
+			Vector2f(position.x + box->origin.x, position.y + box->origin.y).Round(),
+			box->dimensions,
 			colour,
-			box.texcoords[0],
-			box.texcoords[1],
+			box->texcoords[0],
+			box->texcoords[1],
 			(int)character_vertices.size() - 4
 		);
 	}
@@ -109,9 +135,18 @@ public:
 	/// Returns the number of textures employed by this layer.
 	int GetNumTextures() const;
 
+	/// Returns the size in bytes of the textures generated by this layer, textures shared with other layers are not included.
+	size_t GetTextureMemoryUsage() const;
+
 	/// Returns the layer's colour.
 	Colourb GetColour() const;
 
+	/// Returns true if any of the layer's textures are still being generated by the font worker threads.
+	bool HasPendingTextures() const;
+	/// Makes the textures completed by the font worker threads available for rendering.
+	/// @return True if any textures were completed, in which case geometry generated from this layer should be regenerated.
+	bool UpdatePendingTextures();
+
 private:
 
 
@@ -130,8 +165,22 @@ private:
 		int texture_index;
 	};
 
+	// Uploads the glyphs of the layout's rectangles starting at 'first_rectangle', which are placed on the given texture, into the texture.
+	// Returns false if the texture could not be updated in place, in which case it will be regenerated on next use.
+	bool UpdateTexture(int texture_id, int first_rectangle, const FontGlyphTable& glyphs);
+
+	// Generates the boxes and textures of the glyphs rendered from the distance field atlas of the handle, if any.
+	void GenerateDistanceField(const FontFaceHandleDefault* handle, bool& out_geometry_invalidated, const FontFaceLayer* clone);
+
+	// Generates the data of the given texture on a font worker thread. The texture's glyphs are not rendered until its data is ready.
+	void GenerateTextureAsync(const FontFaceHandleDefault* handle, int texture_id, const FontGlyphTable& glyphs);
+
+	// Writes the texture data of a glyph into the destination, which must have room for the given dimensions.
+	static void WriteGlyphData(const FontEffect* effect, byte* destination, int stride, Vector2i dimensions, const FontGlyph& glyph);
+
 	using CharacterMap = UnorderedMap<Character, TextureBox>;
 	using TextureList = Vector<Texture>;
+	using TextureJobList = Vector<SharedPtr<FontWorkerJob>>;
 
 	SharedPtr<const FontEffect> effect;
 
@@ -139,6 +188,18 @@ private:
 
 	CharacterMap character_boxes;
 	TextureList textures;
+	// The job generating each texture's data, or null when the texture is ready for rendering.
+	TextureJobList texture_jobs;
+
+	// Glyphs rendered from the distance field atlas shared by all sizes of the face, scaled to the size of the handle. For the base layer, the
+	// textures are those of the atlas, while font effects generate their own textures from the distance fields using the atlas layout.
+	CharacterMap distance_field_boxes;
+	TextureList distance_field_textures;
+	int distance_field_version = -1;
+	// The size of the distance field textures generated for our font effect, zero if they are shared with other layers.
+	size_t distance_field_texture_memory = 0;
+
+	bool is_released = false;
 	Colourb colour;
 };
 
@@ -95,4 +95,21 @@ void FontFamily::ReleaseFontResources()
 		entry.face->ReleaseFontResources();
 }
 
+void FontFamily::GetHandles(Vector<FontFaceHandleDefault*>& out_handles) const
+{
+	for (const auto& entry : font_faces)
+		entry.face->GetHandles(out_handles);
+}
+
+void FontFamily::GetMemoryUsage(Vector<FontFaceMemoryUsage>& out_usage) const
+{
+	const size_t first_new_entry = out_usage.size();
+
+	for (const auto& entry : font_faces)
+		entry.face->GetMemoryUsage(out_usage);
+
+	for (size_t i = first_new_entry; i < out_usage.size(); i++)
+		out_usage[i].family = name;
+}
+
 } // namespace Rml
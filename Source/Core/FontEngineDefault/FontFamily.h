@@ -33,6 +33,7 @@
 
 namespace Rml {
 
+struct FontFaceMemoryUsage;
 class FontFace;
 class FontFaceHandleDefault;
 
@@ -64,6 +65,11 @@ public:
 	/// Releases resources owned by sized font faces, including their textures and rendered glyphs.
 	void ReleaseFontResources();
 
+	/// Appends the handles of all sizes generated for the faces of this family.
+	void GetHandles(Vector<FontFaceHandleDefault*>& out_handles) const;
+	/// Appends the memory usage of each handle of the faces of this family.
+	void GetMemoryUsage(Vector<FontFaceMemoryUsage>& out_usage) const;
+
 protected:
 	String name;
 
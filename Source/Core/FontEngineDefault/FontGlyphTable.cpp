@@ -0,0 +1,99 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "FontGlyphTable.h"
+
+namespace Rml {
+
+Pair<FontGlyphTable::iterator, bool> FontGlyphTable::emplace(Character character, FontGlyph&& glyph)
+{
+	uint32_t& index = GetOrCreateIndex((uint32_t)character);
+	if (index)
+		return {glyphs.begin() + (index - 1), false};
+
+	glyphs.emplace_back(character, std::move(glyph));
+	index = (uint32_t)glyphs.size();
+	return {glyphs.end() - 1, true};
+}
+
+FontGlyph& FontGlyphTable::operator[](Character character)
+{
+	return emplace(character, FontGlyph{}).first->second;
+}
+
+void FontGlyphTable::reserve(size_t count)
+{
+	glyphs.reserve(count);
+}
+
+void FontGlyphTable::clear()
+{
+	glyphs.clear();
+	direct_index.clear();
+	sparse_pages.clear();
+}
+
+void FontGlyphTable::swap(FontGlyphTable& other)
+{
+	glyphs.swap(other.glyphs);
+	direct_index.swap(other.direct_index);
+	sparse_pages.swap(other.sparse_pages);
+}
+
+size_t FontGlyphTable::GetMemoryUsage() const
+{
+	return glyphs.capacity() * sizeof(value_type) + direct_index.capacity() * sizeof(uint32_t) + sparse_pages.size() * sizeof(Page);
+}
+
+uint32_t FontGlyphTable::FindSparseIndex(uint32_t code_point) const
+{
+	auto it = sparse_pages.find(code_point >> PageBits);
+	if (it == sparse_pages.end())
+		return 0;
+	return (*it->second)[code_point & PageMask];
+}
+
+uint32_t& FontGlyphTable::GetOrCreateIndex(uint32_t code_point)
+{
+	if (code_point < DirectLimit)
+	{
+		if (code_point >= (uint32_t)direct_index.size())
+			direct_index.resize(((code_point >> PageBits) + 1) << PageBits, 0);
+		return direct_index[code_point];
+	}
+
+	UniquePtr<Page>& page = sparse_pages[code_point >> PageBits];
+	if (!page)
+	{
+		page = MakeUnique<Page>();
+		page->fill(0);
+	}
+	return (*page)[code_point & PageMask];
+}
+
+} // namespace Rml
@@ -0,0 +1,117 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_FONTENGINEDEFAULT_FONTGLYPHTABLE_H
+#define RMLUI_CORE_FONTENGINEDEFAULT_FONTGLYPHTABLE_H
+
+#include "../../../Include/RmlUi/Core/FontGlyph.h"
+#include "../../../Include/RmlUi/Core/Types.h"
+
+namespace Rml {
+
+/**
+	The glyphs of a font face handle, keyed by character.
+
+	Glyphs are stored contiguously in insertion order. Characters are looked up through a directly indexed table for the lower code
+	points, which covers the Latin, Greek, Cyrillic and other common scripts, and through sparse pages of code points for the rest.
+ */
+
+class FontGlyphTable {
+public:
+	using value_type = Pair<Character, FontGlyph>;
+	using iterator = Vector<value_type>::iterator;
+	using const_iterator = Vector<value_type>::const_iterator;
+
+	iterator begin() { return glyphs.begin(); }
+	iterator end() { return glyphs.end(); }
+	const_iterator begin() const { return glyphs.begin(); }
+	const_iterator end() const { return glyphs.end(); }
+
+	size_t size() const { return glyphs.size(); }
+	bool empty() const { return glyphs.empty(); }
+
+	/// Returns the glyph of the given character, or end() if the character has no glyph.
+	iterator find(Character character)
+	{
+		const uint32_t index = FindIndex(character);
+		return index ? glyphs.begin() + (index - 1) : glyphs.end();
+	}
+	const_iterator find(Character character) const
+	{
+		const uint32_t index = FindIndex(character);
+		return index ? glyphs.begin() + (index - 1) : glyphs.end();
+	}
+
+	/// Inserts the glyph of the given character, unless the character already has a glyph.
+	/// @return The glyph of the character, and true if the glyph was inserted.
+	Pair<iterator, bool> emplace(Character character, FontGlyph&& glyph);
+
+	/// Returns the glyph of the given character, inserting an empty glyph if the character has no glyph.
+	FontGlyph& operator[](Character character);
+
+	void reserve(size_t count);
+	void clear();
+	void swap(FontGlyphTable& other);
+
+	/// Returns the memory used by the glyph records and the lookup tables, not including glyph bitmaps.
+	size_t GetMemoryUsage() const;
+
+private:
+	static constexpr uint32_t PageBits = 8;
+	static constexpr uint32_t PageSize = (1u << PageBits);
+	static constexpr uint32_t PageMask = PageSize - 1;
+	// Code points below this limit are looked up in the direct index, U+0000 to U+07FF.
+	static constexpr uint32_t DirectLimit = 0x800;
+
+	// Each entry is the index of the glyph plus one, or zero for characters without a glyph.
+	using Page = Array<uint32_t, PageSize>;
+
+	uint32_t FindIndex(Character character) const
+	{
+		const uint32_t code_point = (uint32_t)character;
+		if (code_point < (uint32_t)direct_index.size())
+			return direct_index[code_point];
+		if (code_point < DirectLimit || sparse_pages.empty())
+			return 0;
+		return FindSparseIndex(code_point);
+	}
+
+	uint32_t FindSparseIndex(uint32_t code_point) const;
+
+	// Returns the index entry of the given code point, allocating it if needed.
+	uint32_t& GetOrCreateIndex(uint32_t code_point);
+
+	Vector<value_type> glyphs;
+
+	// Grown a page at a time up to the highest direct code point inserted.
+	Vector<uint32_t> direct_index;
+	UnorderedMap<uint32_t, UniquePtr<Page>> sparse_pages;
+};
+
+} // namespace Rml
+#endif
@@ -28,6 +28,7 @@
 
 #include "FontProvider.h"
 #include "FontFace.h"
+#include "FontFaceHandleDefault.h"
 #include "FontFamily.h"
 #include "FreeTypeInterface.h"
 #include "../LayoutInlineBoxText.h"
@@ -42,6 +43,12 @@ namespace Rml {
 
 static FontProvider* g_font_provider = nullptr;
 
+// The memory budget is kept separately from the provider, so that it can be set before initialisation.
+static size_t memory_budget = 0;
+static bool memory_usage_dirty = false;
+// Resources used after this usage tick are never released to meet the memory budget.
+static uint64_t memory_budget_usage_tick = 0;
+
 FontProvider::FontProvider()
 {
 	RMLUI_ASSERT(!g_font_provider);
@@ -110,6 +117,103 @@ void FontProvider::ReleaseFontResources()
 		name_family.second->ReleaseFontResources();
 }
 
+void FontProvider::SetMemoryBudget(size_t budget)
+{
+	memory_budget = budget;
+	memory_usage_dirty = true;
+
+	// Resources not used since the budget was set may be released as soon as it is enforced.
+	memory_budget_usage_tick = FontFaceHandleDefault::GetUsageTick();
+}
+
+void FontProvider::DirtyMemoryUsage()
+{
+	memory_usage_dirty = true;
+}
+
+void FontProvider::EnforceMemoryBudget()
+{
+	if (!memory_usage_dirty || memory_budget == 0 || !g_font_provider)
+		return;
+
+	memory_usage_dirty = false;
+
+	Vector<FontFaceHandleDefault*> handles;
+	for (auto& name_family : g_font_provider->font_families)
+		name_family.second->GetHandles(handles);
+
+	struct Resource {
+		uint64_t last_used;
+		FontFaceHandleDefault* handle;
+		// The font effect layer to release, or nullptr to release the whole handle.
+		FontFaceLayer* layer;
+		size_t bytes;
+	};
+
+	Vector<Resource> resources;
+	Vector<FontFaceHandleDefault::LayerUsage> layers;
+	size_t total_bytes = 0;
+
+	for (FontFaceHandleDefault* handle : handles)
+	{
+		FontFaceMemoryUsage usage;
+		handle->GetMemoryUsage(usage);
+		const size_t handle_bytes = usage.glyph_bytes + usage.texture_bytes + usage.cache_bytes;
+		total_bytes += handle_bytes;
+
+		layers.clear();
+		handle->GetLayerUsage(layers);
+
+		size_t layer_bytes = 0;
+		for (const auto& layer : layers)
+		{
+			resources.push_back(Resource{layer.last_used, handle, layer.layer, layer.texture_bytes});
+			layer_bytes += layer.texture_bytes;
+		}
+
+		// Layers are never used more recently than their handle, thus they are released before the remaining resources of their handle.
+		if (handle_bytes > layer_bytes)
+			resources.push_back(Resource{handle->GetLastUsed(), handle, nullptr, handle_bytes - layer_bytes});
+	}
+
+	if (total_bytes > memory_budget)
+	{
+		std::stable_sort(resources.begin(), resources.end(), [](const Resource& a, const Resource& b) { return a.last_used < b.last_used; });
+
+		for (const Resource& resource : resources)
+		{
+			if (total_bytes <= memory_budget || resource.last_used > memory_budget_usage_tick)
+				break;
+
+			if (resource.layer)
+				resource.handle->ReleaseLayer(resource.layer);
+			else
+				resource.handle->ReleaseResources();
+
+			total_bytes -= resource.bytes;
+		}
+
+		// Layers of valid geometry are considered in use for as long as their handle is. If we still exceed the budget, make their text
+		// regenerate its geometry, so that we know which of these layers are actually used the next time the budget is enforced.
+		if (total_bytes > memory_budget)
+		{
+			for (FontFaceHandleDefault* handle : handles)
+				handle->RefreshLayerUsage(memory_budget_usage_tick);
+		}
+	}
+
+	memory_budget_usage_tick = FontFaceHandleDefault::GetUsageTick();
+}
+
+void FontProvider::GetMemoryUsage(Vector<FontFaceMemoryUsage>& out_usage)
+{
+	if (!g_font_provider)
+		return;
+
+	for (auto& name_family : g_font_provider->font_families)
+		name_family.second->GetMemoryUsage(out_usage);
+}
+
 bool FontProvider::LoadFontFace(const String& file_name, bool fallback_face, Style::FontWeight weight)
 {
 	FileInterface* file_interface = GetFileInterface();
@@ -35,6 +35,7 @@
 
 namespace Rml {
 
+struct FontFaceMemoryUsage;
 class FontFace;
 class FontFamily;
 class FontFaceHandleDefault;
@@ -75,6 +76,16 @@ public:
 	/// Releases resources owned by sized font faces, including their textures and rendered glyphs.
 	static void ReleaseFontResources();
 
+	/// Sets the memory budget for the resources of all font face handles, or zero to disable it.
+	static void SetMemoryBudget(size_t budget);
+	/// Marks that font resources were generated, the memory budget is then checked on the next call to EnforceMemoryBudget().
+	static void DirtyMemoryUsage();
+	/// Releases the resources of the least recently used font face handles and layers, if needed to meet the memory budget. Only checked
+	/// after new resources were generated. Resources used since the previous check are kept.
+	static void EnforceMemoryBudget();
+	/// Returns the memory usage of each font face handle.
+	static void GetMemoryUsage(Vector<FontFaceMemoryUsage>& out_usage);
+
 private:
 	FontProvider();
 	~FontProvider();
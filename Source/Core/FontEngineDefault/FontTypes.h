@@ -36,6 +36,24 @@
 namespace Rml {
 
 using FontFaceHandleFreetype = uintptr_t;
+using FontFaceHandleHarfBuzz = uintptr_t;
+
+// Glyphs which do not represent a single character, such as ligatures produced by the text shaper, are identified by their glyph index in
+// the face. They are stored as characters beyond the Unicode range, thereby sharing the glyph tables and texture layouts of the characters.
+static constexpr char32_t GlyphIndexCharacterBegin = 0x200000;
+
+inline Character GetGlyphIndexCharacter(uint32_t glyph_index)
+{
+	return Character(GlyphIndexCharacterBegin + glyph_index);
+}
+inline bool IsGlyphIndexCharacter(Character character)
+{
+	return char32_t(character) >= GlyphIndexCharacterBegin;
+}
+
+// The distance, in texels, from the edge of distance field glyphs to where their values saturate. Thus, each texel changes the value by
+// 128 / DistanceFieldSpread, as specified for distance field textures by the render interface.
+static constexpr int DistanceFieldSpread = 16;
 
 struct FontMetrics {
 	int size;
@@ -60,5 +78,21 @@ inline bool operator<(const FaceVariation& a, const FaceVariation& b)
 	return a.weight < b.weight;
 }
 
+// A kerning pair of a font face, in font units.
+struct FontKerningPair {
+	Character lhs;
+	Character rhs;
+	int value;
+};
+using FontKerningPairList = Vector<FontKerningPair>;
+
+// The kerning of character pairs at a given font size in pixels, keyed by GetKerningKey().
+using FontKerningTable = UnorderedMap<uint64_t, int16_t>;
+
+inline uint64_t GetKerningKey(Character lhs, Character rhs)
+{
+	return (uint64_t(lhs) << 32) | uint64_t(rhs);
+}
+
 } // namespace Rml
 #endif
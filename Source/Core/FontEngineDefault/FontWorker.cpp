@@ -0,0 +1,177 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "FontWorker.h"
+#include "../../../Include/RmlUi/Core/Math.h"
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace Rml {
+
+namespace {
+
+	struct WorkerPool {
+		int num_threads = 0;
+		Vector<std::thread> threads;
+
+		std::mutex mutex;
+		std::condition_variable job_queued;
+		std::condition_variable job_done;
+		Queue<SharedPtr<FontWorkerJob>> queue;
+		bool stop = false;
+	};
+
+	WorkerPool& GetPool()
+	{
+		static WorkerPool pool;
+		return pool;
+	}
+
+} // namespace
+
+FontWorkerJob::FontWorkerJob(Function<void()> work) : work(std::move(work)), state(Queued) {}
+
+bool FontWorkerJob::IsDone() const
+{
+	return state.load(std::memory_order_acquire) == Done;
+}
+
+void FontWorkerJob::Wait()
+{
+	if (TryRun())
+		return;
+
+	WorkerPool& pool = GetPool();
+	std::unique_lock<std::mutex> lock(pool.mutex);
+	pool.job_done.wait(lock, [this] { return IsDone(); });
+}
+
+void FontWorkerJob::Cancel()
+{
+	int expected = Queued;
+	if (state.compare_exchange_strong(expected, Done, std::memory_order_acq_rel))
+		work = nullptr;
+}
+
+bool FontWorkerJob::TryRun()
+{
+	int expected = Queued;
+	if (!state.compare_exchange_strong(expected, Running, std::memory_order_acq_rel))
+		return false;
+
+	work();
+	work = nullptr;
+
+	// Publish the result under the lock, so that waiting threads can not miss the notification.
+	WorkerPool& pool = GetPool();
+	{
+		std::lock_guard<std::mutex> lock(pool.mutex);
+		state.store(Done, std::memory_order_release);
+	}
+	pool.job_done.notify_all();
+
+	return true;
+}
+
+void FontWorker::RunWorker()
+{
+	WorkerPool& pool = GetPool();
+
+	while (true)
+	{
+		SharedPtr<FontWorkerJob> job;
+		{
+			std::unique_lock<std::mutex> lock(pool.mutex);
+			pool.job_queued.wait(lock, [&pool] { return pool.stop || !pool.queue.empty(); });
+
+			// Finish all queued jobs before stopping, their submitters may still be waiting for them.
+			if (pool.queue.empty())
+				return;
+
+			job = std::move(pool.queue.front());
+			pool.queue.pop();
+		}
+
+		job->TryRun();
+	}
+}
+
+void FontWorker::SetNumThreads(int num_threads)
+{
+	Shutdown();
+	GetPool().num_threads = Math::Max(num_threads, 0);
+}
+
+bool FontWorker::IsEnabled()
+{
+	return GetPool().num_threads > 0;
+}
+
+SharedPtr<FontWorkerJob> FontWorker::Submit(Function<void()> work)
+{
+	WorkerPool& pool = GetPool();
+	RMLUI_ASSERT(pool.num_threads > 0);
+
+	auto job = MakeShared<FontWorkerJob>(std::move(work));
+
+	if (pool.threads.empty())
+	{
+		pool.stop = false;
+		for (int i = 0; i < pool.num_threads; i++)
+			pool.threads.emplace_back(&FontWorker::RunWorker);
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(pool.mutex);
+		pool.queue.push(job);
+	}
+	pool.job_queued.notify_one();
+
+	return job;
+}
+
+void FontWorker::Shutdown()
+{
+	WorkerPool& pool = GetPool();
+	if (pool.threads.empty())
+		return;
+
+	{
+		std::lock_guard<std::mutex> lock(pool.mutex);
+		pool.stop = true;
+	}
+	pool.job_queued.notify_all();
+
+	for (std::thread& thread : pool.threads)
+		thread.join();
+
+	pool.threads.clear();
+}
+
+} // namespace Rml
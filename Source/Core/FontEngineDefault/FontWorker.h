@@ -0,0 +1,96 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_FONTENGINEDEFAULT_FONTWORKER_H
+#define RMLUI_CORE_FONTENGINEDEFAULT_FONTWORKER_H
+
+#include "../../../Include/RmlUi/Core/Traits.h"
+#include "../../../Include/RmlUi/Core/Types.h"
+#include <atomic>
+
+namespace Rml {
+
+/**
+	A unit of work submitted to the font worker threads.
+
+	Jobs are owned jointly by the worker and the submitter, results should be written to memory owned by the job function itself.
+ */
+
+class FontWorkerJob final : public NonCopyMoveable
+{
+public:
+	FontWorkerJob(Function<void()> work);
+
+	/// Returns true once the job has finished running, or if it was cancelled.
+	bool IsDone() const;
+
+	/// Blocks until the job is done. If no worker has started the job yet, it is run on the calling thread instead.
+	void Wait();
+
+	/// Prevents the job from running if it has not yet been started.
+	void Cancel();
+
+private:
+	enum State { Queued, Running, Done };
+
+	// Runs the job if it is still queued. Returns false if it was already started or cancelled.
+	bool TryRun();
+
+	Function<void()> work;
+	std::atomic<int> state;
+
+	friend class FontWorker;
+};
+
+/**
+	A pool of background threads used by the default font engine to rasterize glyphs and generate font effect textures.
+
+	Disabled by default, in which case all font work is done synchronously on the calling thread.
+ */
+
+class FontWorker
+{
+public:
+	/// Sets the number of worker threads, or zero to disable the workers. Threads are started on the first submitted job.
+	static void SetNumThreads(int num_threads);
+
+	/// Returns true if jobs should be submitted to the workers.
+	static bool IsEnabled();
+
+	/// Queues the work to be run on a worker thread. Must only be called from the thread updating the font engine.
+	static SharedPtr<FontWorkerJob> Submit(Function<void()> work);
+
+	/// Finishes all queued jobs and stops the worker threads. The threads are started again on the next submitted job.
+	static void Shutdown();
+
+private:
+	static void RunWorker();
+};
+
+} // namespace Rml
+#endif
@@ -35,17 +35,25 @@
 
 #include <ft2build.h>
 #include FT_FREETYPE_H
+#include FT_MODULE_H
 #include FT_MULTIPLE_MASTERS_H
 #include FT_TRUETYPE_TABLES_H
+#include FT_TRUETYPE_TAGS_H
+
+// The signed distance field renderer was introduced in FreeType 2.11.
+#if FREETYPE_MAJOR > 2 || (FREETYPE_MAJOR == 2 && FREETYPE_MINOR >= 11)
+	#define RMLUI_FREETYPE_DISTANCE_FIELD
+#endif
 
 namespace Rml {
 
 static FT_Library ft_library = nullptr;
 
-static bool BuildGlyph(FT_Face ft_face, Character character, FontGlyphMap& glyphs, float bitmap_scaling_factor);
-static void BuildGlyphMap(FT_Face ft_face, int size, FontGlyphMap& glyphs, float bitmap_scaling_factor, bool load_default_glyphs);
+static bool BuildGlyph(FT_Face ft_face, Character character, FontGlyphTable& glyphs, float bitmap_scaling_factor, bool load_bitmap);
+static void BuildGlyphMap(FT_Face ft_face, int size, FontGlyphTable& glyphs, float bitmap_scaling_factor, bool load_default_glyphs, bool load_bitmaps);
 static void GenerateMetrics(FT_Face ft_face, FontMetrics& metrics, float bitmap_scaling_factor);
 static bool SetFontSize(FT_Face ft_face, int font_size, float& out_bitmap_scaling_factor);
+static FT_UInt GetCharIndex(FT_Face ft_face, Character character);
 static void BitmapDownscale(byte* bitmap_new, int new_width, int new_height, const byte* bitmap_source, int width, int height, int pitch,
 	ColorFormat color_format);
 
@@ -66,6 +74,11 @@ bool FreeType::Initialise()
 		return false;
 	}
 
+#ifdef RMLUI_FREETYPE_DISTANCE_FIELD
+	FT_Int spread = DistanceFieldSpread;
+	FT_Property_Set(ft_library, "sdf", "spread", &spread);
+#endif
+
 	return true;
 }
 
@@ -173,6 +186,38 @@ bool FreeType::ReleaseFace(FontFaceHandleFreetype in_face)
 	return (error == 0);
 }
 
+FontFaceHandleFreetype FreeType::LoadFaceInstance(FontFaceHandleFreetype in_face)
+{
+	FT_Face face = (FT_Face)in_face;
+
+	FT_Library library = nullptr;
+	if (FT_Init_FreeType(&library) != 0)
+		return 0;
+
+	// Faces are always loaded from memory, thus we can create the new instance directly from the stream of the original face.
+	FT_Face instance = nullptr;
+	FT_Error error = FT_New_Memory_Face(library, face->stream->base, (FT_Long)face->stream->size, face->face_index, &instance);
+	if (error)
+	{
+		FT_Done_FreeType(library);
+		return 0;
+	}
+
+	if (instance->charmap == nullptr)
+		FT_Select_Charmap(instance, FT_ENCODING_APPLE_ROMAN);
+
+	return (FontFaceHandleFreetype)instance;
+}
+
+void FreeType::ReleaseFaceInstance(FontFaceHandleFreetype in_face_instance)
+{
+	FT_Face instance = (FT_Face)in_face_instance;
+	FT_Library library = instance->glyph->library;
+
+	// Releasing the library also releases its faces.
+	FT_Done_FreeType(library);
+}
+
 void FreeType::GetFaceStyle(FontFaceHandleFreetype in_face, String* font_family, Style::FontStyle* style, Style::FontWeight* weight)
 {
 	FT_Face face = (FT_Face)in_face;
@@ -193,7 +238,8 @@ void FreeType::GetFaceStyle(FontFaceHandleFreetype in_face, String* font_family,
 }
 
 // Initialises the handle so it is able to render text.
-bool FreeType::InitialiseFaceHandle(FontFaceHandleFreetype face, int font_size, FontGlyphMap& glyphs, FontMetrics& metrics, bool load_default_glyphs)
+bool FreeType::InitialiseFaceHandle(FontFaceHandleFreetype face, int font_size, FontGlyphTable& glyphs, FontMetrics& metrics, bool load_default_glyphs,
+	bool load_bitmaps)
 {
 	FT_Face ft_face = (FT_Face)face;
 
@@ -204,7 +250,7 @@ bool FreeType::InitialiseFaceHandle(FontFaceHandleFreetype face, int font_size,
 		return false;
 
 	// Construct the initial list of glyphs.
-	BuildGlyphMap(ft_face, font_size, glyphs, bitmap_scaling_factor, load_default_glyphs);
+	BuildGlyphMap(ft_face, font_size, glyphs, bitmap_scaling_factor, load_default_glyphs, load_bitmaps);
 
 	// Generate the metrics for the handle.
 	GenerateMetrics(ft_face, metrics, bitmap_scaling_factor);
@@ -212,7 +258,7 @@ bool FreeType::InitialiseFaceHandle(FontFaceHandleFreetype face, int font_size,
 	return true;
 }
 
-bool FreeType::AppendGlyph(FontFaceHandleFreetype face, int font_size, Character character, FontGlyphMap& glyphs)
+bool FreeType::AppendGlyph(FontFaceHandleFreetype face, int font_size, Character character, FontGlyphTable& glyphs, bool load_bitmap)
 {
 	FT_Face ft_face = (FT_Face)face;
 
@@ -224,12 +270,108 @@ bool FreeType::AppendGlyph(FontFaceHandleFreetype face, int font_size, Character
 	if (!SetFontSize(ft_face, font_size, bitmap_scaling_factor))
 		return false;
 
-	if (!BuildGlyph(ft_face, character, glyphs, bitmap_scaling_factor))
+	if (!BuildGlyph(ft_face, character, glyphs, bitmap_scaling_factor, load_bitmap))
 		return false;
 
 	return true;
 }
 
+bool FreeType::SupportsDistanceField(FontFaceHandleFreetype face)
+{
+#ifdef RMLUI_FREETYPE_DISTANCE_FIELD
+	FT_Face ft_face = (FT_Face)face;
+
+	// Bitmap and color fonts are rendered from their bitmaps.
+	return FT_IS_SCALABLE(ft_face) && !FT_HAS_COLOR(ft_face);
+#else
+	(void)face;
+	return false;
+#endif
+}
+
+bool FreeType::AppendDistanceFieldGlyph(FontFaceHandleFreetype face, int font_size, Character character, FontGlyphTable& glyphs)
+{
+#ifdef RMLUI_FREETYPE_DISTANCE_FIELD
+	FT_Face ft_face = (FT_Face)face;
+
+	RMLUI_ASSERT(glyphs.find(character) == glyphs.end());
+	RMLUI_ASSERT(ft_face);
+
+	float bitmap_scaling_factor = 1.0f;
+	if (!SetFontSize(ft_face, font_size, bitmap_scaling_factor))
+		return false;
+
+	FT_UInt index = GetCharIndex(ft_face, character);
+	if (index == 0)
+		return false;
+
+	// The distance field is scaled to any font size, thus use the unhinted outline.
+	FT_Error error = FT_Load_Glyph(ft_face, index, FT_LOAD_NO_HINTING);
+
+	// Glyphs without an outline, such as spaces, have no distance field.
+	const bool has_outline = (error == 0 && ft_face->glyph->outline.n_points > 0);
+	if (has_outline)
+		error = FT_Render_Glyph(ft_face->glyph, FT_RENDER_MODE_SDF);
+
+	if (error != 0)
+	{
+		Log::Message(Log::LT_WARNING, "Unable to render distance field of glyph for character '%u' on the font face '%s %s'; error code: %d.",
+			(unsigned int)character, ft_face->family_name, ft_face->style_name, error);
+		return false;
+	}
+
+	FontGlyph& glyph = glyphs[character];
+	FT_GlyphSlot ft_glyph = ft_face->glyph;
+
+	glyph.dimensions.x = ft_glyph->metrics.width >> 6;
+	glyph.dimensions.y = ft_glyph->metrics.height >> 6;
+	glyph.advance = ft_glyph->metrics.horiAdvance >> 6;
+
+	if (!has_outline)
+		return true;
+
+	// The bitmap includes the padding of the distance field, as reflected in its placement.
+	glyph.bearing.x = ft_glyph->bitmap_left;
+	glyph.bearing.y = ft_glyph->bitmap_top;
+	glyph.bitmap_dimensions.x = ft_glyph->bitmap.width;
+	glyph.bitmap_dimensions.y = ft_glyph->bitmap.rows;
+
+	if (glyph.bitmap_dimensions.x * glyph.bitmap_dimensions.y != 0)
+	{
+		glyph.bitmap_owned_data.reset(new byte[glyph.bitmap_dimensions.x * glyph.bitmap_dimensions.y]);
+		glyph.bitmap_data = glyph.bitmap_owned_data.get();
+
+		byte* destination_bitmap = glyph.bitmap_owned_data.get();
+		const byte* source_bitmap = ft_glyph->bitmap.buffer;
+		for (int i = 0; i < glyph.bitmap_dimensions.y; ++i)
+		{
+			memcpy(destination_bitmap, source_bitmap, glyph.bitmap_dimensions.x);
+			destination_bitmap += glyph.bitmap_dimensions.x;
+			source_bitmap += ft_glyph->bitmap.pitch;
+		}
+	}
+
+	return true;
+#else
+	(void)face;
+	(void)font_size;
+	(void)character;
+	(void)glyphs;
+	return false;
+#endif
+}
+
+
+uint32_t FreeType::GetGlyphIndex(FontFaceHandleFreetype face, Character character)
+{
+	return GetCharIndex((FT_Face)face, character);
+}
+
+bool FreeType::SetFaceSize(FontFaceHandleFreetype face, int font_size)
+{
+	float bitmap_scaling_factor = 1.0f;
+	return SetFontSize((FT_Face)face, font_size, bitmap_scaling_factor) && bitmap_scaling_factor == 1.0f;
+}
 
 int FreeType::GetKerning(FontFaceHandleFreetype face, int font_size, Character lhs, Character rhs)
 {
@@ -250,8 +392,8 @@ int FreeType::GetKerning(FontFaceHandleFreetype face, int font_size, Character l
 
 	FT_Error ft_error = FT_Get_Kerning(
 		ft_face,
-		FT_Get_Char_Index(ft_face, (FT_ULong)lhs),
-		FT_Get_Char_Index(ft_face, (FT_ULong)rhs),
+		GetCharIndex(ft_face, lhs),
+		GetCharIndex(ft_face, rhs),
 		FT_KERNING_DEFAULT,
 		&ft_kerning
 	);
@@ -270,9 +412,126 @@ bool FreeType::HasKerning(FontFaceHandleFreetype face)
 	return FT_HAS_KERNING(ft_face);
 }
 
+bool FreeType::GetKerningPairs(FontFaceHandleFreetype face, FontKerningPairList& out_kerning_pairs)
+{
+	FT_Face ft_face = (FT_Face)face;
+
+	FT_ULong table_length = 0;
+	if (!FT_IS_SFNT(ft_face) || FT_Load_Sfnt_Table(ft_face, TTAG_kern, 0, nullptr, &table_length) != 0 || table_length < 4)
+		return false;
+
+	Vector<FT_Byte> table(table_length);
+	if (FT_Load_Sfnt_Table(ft_face, TTAG_kern, 0, table.data(), &table_length) != 0)
+		return false;
+
+	const FT_Byte* const table_end = table.data() + table.size();
+	auto read_u16 = [](const FT_Byte* p) { return uint16_t((p[0] << 8) | p[1]); };
+
+	// Only the Microsoft version of the table is supported, as with FreeType itself.
+	const FT_Byte* p = table.data();
+	if (read_u16(p) != 0)
+		return false;
+	const int num_subtables = read_u16(p + 2);
+	p += 4;
+
+	// The kerning of each glyph pair, combined over all subtables.
+	UnorderedMap<uint32_t, int> glyph_kerning;
+
+	for (int i = 0; i < num_subtables && p + 6 <= table_end; i++)
+	{
+		const uint16_t length = read_u16(p + 2);
+		const uint16_t coverage = read_u16(p + 4);
+		const FT_Byte* subtable_end = std::min(p + length, table_end);
+		if (length < 6)
+			break;
+
+		// Read the horizontal format 0 subtables, skipping cross-stream and minimum values, as FreeType does.
+		constexpr uint16_t coverage_override = 0x8;
+		if ((coverage & ~coverage_override) == 0x0001 && p + 14 <= subtable_end)
+		{
+			const FT_Byte* pair = p + 14;
+			const int num_pairs = std::min(int(read_u16(p + 6)), int(subtable_end - pair) / 6);
+
+			for (int j = 0; j < num_pairs; j++, pair += 6)
+			{
+				const uint32_t key = (uint32_t(read_u16(pair)) << 16) | read_u16(pair + 2);
+				const int value = int16_t(read_u16(pair + 4));
+
+				if (coverage & coverage_override)
+					glyph_kerning[key] = value;
+				else
+					glyph_kerning[key] += value;
+			}
+		}
+
+		p = subtable_end;
+	}
+
+	// Map the glyph pairs back to character pairs, for every character using a given glyph.
+	Vector<Pair<FT_UInt, Character>> glyph_characters;
+	FT_UInt glyph_index = 0;
+	for (FT_ULong code = FT_Get_First_Char(ft_face, &glyph_index); glyph_index != 0; code = FT_Get_Next_Char(ft_face, code, &glyph_index))
+	{
+		if (code >= ' ')
+			glyph_characters.emplace_back(glyph_index, Character(code));
+	}
+	std::sort(glyph_characters.begin(), glyph_characters.end(),
+		[](const Pair<FT_UInt, Character>& a, const Pair<FT_UInt, Character>& b) { return a.first < b.first; });
+
+	auto find_characters = [&glyph_characters](FT_UInt glyph) {
+		return std::equal_range(glyph_characters.begin(), glyph_characters.end(), Pair<FT_UInt, Character>(glyph, Character::Null),
+			[](const Pair<FT_UInt, Character>& a, const Pair<FT_UInt, Character>& b) { return a.first < b.first; });
+	};
+
+	for (const auto& pair : glyph_kerning)
+	{
+		if (pair.second == 0)
+			continue;
+
+		const auto lhs_range = find_characters(FT_UInt(pair.first >> 16));
+		const auto rhs_range = find_characters(FT_UInt(pair.first & 0xffff));
+
+		for (auto lhs = lhs_range.first; lhs != lhs_range.second; ++lhs)
+		{
+			for (auto rhs = rhs_range.first; rhs != rhs_range.second; ++rhs)
+				out_kerning_pairs.push_back(FontKerningPair{lhs->second, rhs->second, pair.second});
+		}
+	}
+
+	return true;
+}
+
+void FreeType::ScaleKerningPairs(FontFaceHandleFreetype face, int font_size, const FontKerningPairList& kerning_pairs,
+	FontKerningTable& out_kerning_table)
+{
+	FT_Face ft_face = (FT_Face)face;
+
+	float bitmap_scaling_factor = 1.0f;
+	if (!SetFontSize(ft_face, font_size, bitmap_scaling_factor) || bitmap_scaling_factor != 1.0f)
+		return;
+
+	const FT_Size_Metrics& size_metrics = ft_face->size->metrics;
+
+	out_kerning_table.reserve(kerning_pairs.size());
+
+	for (const FontKerningPair& pair : kerning_pairs)
+	{
+		// Scale and round the kerning as FT_Get_Kerning() does in its default mode, where kerning is scaled down for small sizes.
+		FT_Pos kerning = FT_MulFix(pair.value, size_metrics.x_scale);
+		if (size_metrics.x_ppem < 25)
+			kerning = FT_MulDiv(kerning, size_metrics.x_ppem, 25);
+		kerning = (kerning + 32) & -64;
+
+		const int value = int(kerning >> 6);
+		if (value != 0)
+			out_kerning_table.emplace(GetKerningKey(pair.lhs, pair.rhs), int16_t(value));
+	}
+}
+
 
 
-static void BuildGlyphMap(FT_Face ft_face, int size, FontGlyphMap& glyphs, const float bitmap_scaling_factor, const bool load_default_glyphs)
+static void BuildGlyphMap(FT_Face ft_face, int size, FontGlyphTable& glyphs, const float bitmap_scaling_factor, const bool load_default_glyphs,
+	const bool load_bitmaps)
 {
 	if (load_default_glyphs)
 	{
@@ -283,7 +542,7 @@ static void BuildGlyphMap(FT_Face ft_face, int size, FontGlyphMap& glyphs, const
 		FT_ULong code_max = 126;
 
 		for (FT_ULong character_code = code_min; character_code <= code_max; ++character_code)
-			BuildGlyph(ft_face, (Character)character_code, glyphs, bitmap_scaling_factor);
+			BuildGlyph(ft_face, (Character)character_code, glyphs, bitmap_scaling_factor, load_bitmaps);
 	}
 
 	// Add a replacement character for rendering unknown characters.
@@ -315,9 +574,9 @@ static void BuildGlyphMap(FT_Face ft_face, int size, FontGlyphMap& glyphs, const
 	}
 }
 
-static bool BuildGlyph(FT_Face ft_face, const Character character, FontGlyphMap& glyphs, const float bitmap_scaling_factor)
+static bool BuildGlyph(FT_Face ft_face, const Character character, FontGlyphTable& glyphs, const float bitmap_scaling_factor, const bool load_bitmap)
 {
-	FT_UInt index = FT_Get_Char_Index(ft_face, (FT_ULong)character);
+	FT_UInt index = GetCharIndex(ft_face, character);
 	if (index == 0)
 		return false;
 
@@ -328,7 +587,8 @@ static bool BuildGlyph(FT_Face ft_face, const Character character, FontGlyphMap&
 		return false;
 	}
 
-	error = FT_Render_Glyph(ft_face->glyph, FT_RENDER_MODE_NORMAL);
+	if (load_bitmap)
+		error = FT_Render_Glyph(ft_face->glyph, FT_RENDER_MODE_NORMAL);
 	if (error != 0)
 	{
 		Log::Message(Log::LT_WARNING, "Unable to render glyph for character '%u' on the font face '%s %s'; error code: %d.", (unsigned int)character, ft_face->family_name, ft_face->style_name, error);
@@ -357,9 +617,12 @@ static bool BuildGlyph(FT_Face ft_face, const Character character, FontGlyphMap&
 	// Set the glyph's advance.
 	glyph.advance = ft_glyph->metrics.horiAdvance >> 6;
 
-	// Set the glyph's bitmap dimensions.
-	glyph.bitmap_dimensions.x = ft_glyph->bitmap.width;
-	glyph.bitmap_dimensions.y = ft_glyph->bitmap.rows;
+	// Set the glyph's bitmap dimensions, leave them empty when only the metrics are requested.
+	if (load_bitmap)
+	{
+		glyph.bitmap_dimensions.x = ft_glyph->bitmap.width;
+		glyph.bitmap_dimensions.y = ft_glyph->bitmap.rows;
+	}
 
 	// Determine new metrics if we need to scale the bitmap received from FreeType. Only allow bitmap downscaling.
 	const bool scale_bitmap = (bitmap_scaling_factor < 1.f);
@@ -507,6 +770,18 @@ static void GenerateMetrics(FT_Face ft_face, FontMetrics& metrics, float bitmap_
 	}
 }
 
+// Returns the glyph index of the character, resolving glyph index characters directly.
+static FT_UInt GetCharIndex(FT_Face ft_face, Character character)
+{
+	if (IsGlyphIndexCharacter(character))
+	{
+		const FT_ULong glyph_index = FT_ULong(char32_t(character) - GlyphIndexCharacterBegin);
+		return glyph_index < FT_ULong(ft_face->num_glyphs) ? FT_UInt(glyph_index) : 0;
+	}
+
+	return FT_Get_Char_Index(ft_face, (FT_ULong)character);
+}
+
 static bool SetFontSize(FT_Face ft_face, int font_size, float& out_bitmap_scaling_factor)
 {
 	RMLUI_ASSERT(out_bitmap_scaling_factor == 1.f);
@@ -29,6 +29,7 @@
 #ifndef RMLUI_CORE_FONTENGINEDEFAULT_FREETYPEINTERFACE_H
 #define RMLUI_CORE_FONTENGINEDEFAULT_FREETYPEINTERFACE_H
 
+#include "FontGlyphTable.h"
 #include "FontTypes.h"
 
 namespace Rml {
@@ -49,14 +50,37 @@ FontFaceHandleFreetype LoadFace(const byte* data, int data_length, const String&
 // Releases the FreeType face.
 bool ReleaseFace(FontFaceHandleFreetype face);
 
+// Loads a separate instance of the face from its font data, which can be used on a different thread than the original face. The instance
+// uses its own FreeType library, the original face is not modified and must outlive the instance.
+FontFaceHandleFreetype LoadFaceInstance(FontFaceHandleFreetype face);
+
+// Releases a face instance and its library, from the thread using the instance.
+void ReleaseFaceInstance(FontFaceHandleFreetype face_instance);
+
 // Retrieves the font family, style and weight of the given font face. Use nullptr to ignore a property.
 void GetFaceStyle(FontFaceHandleFreetype face, String* font_family, Style::FontStyle* style, Style::FontWeight* weight);
 
 // Initializes a face for a given font size. Glyphs are filled with the ASCII subset, and the font face metrics are set.
-bool InitialiseFaceHandle(FontFaceHandleFreetype face, int font_size, FontGlyphMap& glyphs, FontMetrics& metrics, bool load_default_glyphs);
+// Without 'load_bitmaps', only the metrics of the glyphs are loaded, leaving their bitmaps empty.
+bool InitialiseFaceHandle(FontFaceHandleFreetype face, int font_size, FontGlyphTable& glyphs, FontMetrics& metrics, bool load_default_glyphs,
+	bool load_bitmaps = true);
 
 // Build a new glyph representing the given code point and append to 'glyphs'.
-bool AppendGlyph(FontFaceHandleFreetype face, int font_size, Character character, FontGlyphMap& glyphs);
+bool AppendGlyph(FontFaceHandleFreetype face, int font_size, Character character, FontGlyphTable& glyphs, bool load_bitmap = true);
+
+// Returns true if the glyphs of the face can be rendered as signed distance fields.
+bool SupportsDistanceField(FontFaceHandleFreetype face);
+
+// Build a new glyph with its signed distance field as bitmap, representing the given code point, and append to 'glyphs'. The bitmap is padded by
+// DistanceFieldSpread texels on each side, which is included in the glyph's bearing.
+bool AppendDistanceFieldGlyph(FontFaceHandleFreetype face, int font_size, Character character, FontGlyphTable& glyphs);
+
+// Returns the index of the glyph representing the character in the face, or zero if the face has no such glyph. Glyph index characters
+// resolve directly to their glyph.
+uint32_t GetGlyphIndex(FontFaceHandleFreetype face, Character character);
+
+// Sets the face to the given font size, for use by the text shaper. Returns false if the size can only be reached by scaling the glyph bitmaps.
+bool SetFaceSize(FontFaceHandleFreetype face, int font_size);
 
 // Returns the kerning between two characters.
 // 'font_size' value of zero assumes the font size is already set on the face, and skips this step for performance reasons.
@@ -65,6 +89,14 @@ int GetKerning(FontFaceHandleFreetype face, int font_size, Character lhs, Charac
 // Returns true if the font face has kerning.
 bool HasKerning(FontFaceHandleFreetype face);
 
+// Retrieves every non-zero kerning pair of the face from its 'kern' table, in font units. Returns false if the kerning is not available
+// this way, such as for faces which are not in the SFNT format, in that case the kerning must be retrieved for each pair using GetKerning().
+bool GetKerningPairs(FontFaceHandleFreetype face, FontKerningPairList& out_kerning_pairs);
+
+// Scales the kerning pairs of the face to the given font size in pixels, rounded the same way as GetKerning(), and adds the non-zero
+// results to the kerning table.
+void ScaleKerningPairs(FontFaceHandleFreetype face, int font_size, const FontKerningPairList& kerning_pairs, FontKerningTable& out_kerning_table);
+
 }
 } // namespace Rml
 #endif
@@ -0,0 +1,89 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "HarfBuzzInterface.h"
+
+#ifdef RMLUI_ENABLE_HARFBUZZ
+
+#include <ft2build.h>
+#include FT_FREETYPE_H
+#include <hb-ft.h>
+#include <hb.h>
+
+namespace Rml {
+
+FontFaceHandleHarfBuzz HarfBuzz::CreateShapingFont(FontFaceHandleFreetype face)
+{
+	hb_font_t* font = hb_ft_font_create_referenced((FT_Face)face);
+
+	// Use the hinted advances, matching the glyphs rasterized by FreeType.
+	hb_ft_font_set_load_flags(font, FT_LOAD_DEFAULT);
+
+	return (FontFaceHandleHarfBuzz)font;
+}
+
+void HarfBuzz::ReleaseShapingFont(FontFaceHandleHarfBuzz font)
+{
+	hb_font_destroy((hb_font_t*)font);
+}
+
+bool HarfBuzz::Shape(FontFaceHandleHarfBuzz font_handle, const String& string, Vector<GlyphPosition>& out_glyphs)
+{
+	hb_font_t* font = (hb_font_t*)font_handle;
+
+	// The face is shared by all sizes of the font, update the font for the size currently set on the face.
+	hb_ft_font_changed(font);
+
+	hb_buffer_t* buffer = hb_buffer_create();
+	hb_buffer_add_utf8(buffer, string.data(), (int)string.size(), 0, (int)string.size());
+	hb_buffer_guess_segment_properties(buffer);
+
+	hb_shape(font, buffer, nullptr, 0);
+
+	unsigned int num_glyphs = 0;
+	const hb_glyph_info_t* glyph_infos = hb_buffer_get_glyph_infos(buffer, &num_glyphs);
+	const hb_glyph_position_t* glyph_positions = hb_buffer_get_glyph_positions(buffer, &num_glyphs);
+
+	out_glyphs.clear();
+	out_glyphs.reserve(num_glyphs);
+
+	for (unsigned int i = 0; i < num_glyphs; i++)
+	{
+		out_glyphs.push_back(GlyphPosition{glyph_infos[i].codepoint, glyph_infos[i].cluster, glyph_positions[i].x_advance,
+			glyph_positions[i].x_offset, glyph_positions[i].y_offset});
+	}
+
+	const bool result = hb_buffer_allocation_successful(buffer);
+	hb_buffer_destroy(buffer);
+
+	return result;
+}
+
+} // namespace Rml
+
+#endif
@@ -0,0 +1,64 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_FONTENGINEDEFAULT_HARFBUZZINTERFACE_H
+#define RMLUI_CORE_FONTENGINEDEFAULT_HARFBUZZINTERFACE_H
+
+#include "FontTypes.h"
+
+#ifdef RMLUI_ENABLE_HARFBUZZ
+
+namespace Rml {
+
+namespace HarfBuzz {
+
+struct GlyphPosition {
+	// The index of the glyph in the face, or zero if the face has no glyph for its cluster.
+	uint32_t glyph_index;
+	// The byte offset into the string of the first character of the cluster the glyph was shaped from.
+	uint32_t cluster;
+	// The advance and offset of the glyph in 1/64th pixels, with vertical offsets pointing upwards.
+	int x_advance;
+	int x_offset;
+	int y_offset;
+};
+
+// Creates a HarfBuzz font for shaping text with the given face. The font holds a reference to the face.
+FontFaceHandleHarfBuzz CreateShapingFont(FontFaceHandleFreetype face);
+
+// Releases the HarfBuzz font.
+void ReleaseShapingFont(FontFaceHandleHarfBuzz font);
+
+// Shapes the UTF-8 string into glyphs in visual order. The face of the font must already be set to the size to shape at.
+bool Shape(FontFaceHandleHarfBuzz font, const String& string, Vector<GlyphPosition>& out_glyphs);
+
+}
+} // namespace Rml
+
+#endif
+#endif
@@ -27,6 +27,7 @@
  */
 
 #include "../../Include/RmlUi/Core/FontEngineInterface.h"
+#include "../../Include/RmlUi/Core/StringUtilities.h"
 
 namespace Rml {
 
@@ -86,6 +87,24 @@ int FontEngineInterface::GetStringWidth(FontFaceHandle /*handle*/, const String&
 	return 0;
 }
 
+int FontEngineInterface::ShapeString(FontFaceHandle handle, const String& string, Vector<ShapedGlyphPosition>& glyphs)
+{
+	int width = 0;
+	Character prior_character = Character::Null;
+
+	for (auto it_string = StringIteratorU8(string); it_string; ++it_string)
+	{
+		const Character character = *it_string;
+		glyphs.push_back(ShapedGlyphPosition{int(it_string.offset()), Vector2i(width, 0)});
+
+		// Any kerning with the prior character is included in the width of this character.
+		width += GetStringWidth(handle, StringUtilities::ToUTF8(character), prior_character);
+		prior_character = character;
+	}
+
+	return width;
+}
+
 int FontEngineInterface::GenerateString(FontFaceHandle /*face_handle*/, FontEffectsHandle /*font_effects_handle*/, const String& /*string*/,
 	const Vector2f& /*position*/, const Colourb& /*colour*/, float /*opacity*/, GeometryList& /*geometry*/)
 {
@@ -33,6 +33,7 @@
 #include "../../Include/RmlUi/Core/Profiling.h"
 #include "../../Include/RmlUi/Core/RenderInterface.h"
 #include "GeometryDatabase.h"
+#include "RenderBatcher.h"
 #include <utility>
 
 
@@ -73,6 +74,9 @@ void Geometry::MoveFrom(Geometry& other) noexcept
 
 	compiled_geometry = std::exchange(other.compiled_geometry, 0);
 	compile_attempted = std::exchange(other.compile_attempted, false);
+
+	content_hash = std::exchange(other.content_hash, 0);
+	content_hash_valid = std::exchange(other.content_hash_valid, false);
 }
 
 Geometry::~Geometry()
@@ -105,6 +109,23 @@ void Geometry::Render(Vector2f translation)
 
 	translation = translation.Round();
 
+	// When the context is recording a batched frame, our geometry is merged into the current batch instead of compiled or rendered.
+	if (RenderBatcher* render_batcher = (host_context ? host_context->GetActiveRenderBatcher() : nullptr))
+	{
+		if (!vertices.empty() && !indices.empty())
+		{
+			if (!content_hash_valid)
+			{
+				content_hash = RenderBatcher::HashGeometry(&vertices[0], (int)vertices.size(), &indices[0], (int)indices.size());
+				content_hash_valid = true;
+			}
+
+			render_batcher->RenderGeometry(&vertices[0], (int)vertices.size(), &indices[0], (int)indices.size(),
+				texture ? texture->GetHandle(render_interface) : 0, texture ? texture->GetVersion() : 0, translation, content_hash);
+		}
+		return;
+	}
+
 	// Render our compiled geometry if possible.
 	if (compiled_geometry)
 	{
@@ -144,12 +165,14 @@ void Geometry::Render(Vector2f translation)
 // Returns the geometry's vertices. If these are written to, Release() should be called to force a recompile.
 Vector< Vertex >& Geometry::GetVertices()
 {
+	content_hash_valid = false;
 	return vertices;
 }
 
 // Returns the geometry's indices. If these are written to, Release() should be called to force a recompile.
 Vector< int >& Geometry::GetIndices()
 {
+	content_hash_valid = false;
 	return indices;
 }
 
@@ -175,6 +198,7 @@ void Geometry::Release(bool clear_buffers)
 	}
 
 	compile_attempted = false;
+	content_hash_valid = false;
 
 	if (clear_buffers)
 	{
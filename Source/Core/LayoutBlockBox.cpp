@@ -535,6 +535,11 @@ void LayoutBlockBox::CloseAbsoluteElements()
 			// Lay out the element.
 			LayoutEngine::FormatElement(absolute_element, containing_block);
 
+			// Absolutely positioned elements don't affect the layout of anything else, thus they can later be formatted independently of their
+			// ancestors.
+			absolute_element->layout_boundary = true;
+			absolute_element->layout_boundary_containing_block = containing_block;
+
 			// Now that the element's box has been built, we can offset the position we determined was appropriate for
 			// it by the element's margin. This is necessary because the coordinate system for the box begins at the
 			// border, not the margin.
@@ -674,6 +679,11 @@ Vector2f LayoutBlockBox::GetVisibleOverflowSize() const
 	return visible_overflow_size;
 }
 
+bool LayoutBlockBox::HasFloats() const
+{
+	return !space->IsEmpty();
+}
+
 void LayoutBlockBox::ExtendInnerContentSize(Vector2f _inner_content_size)
 {
 	inner_content_size.x = Math::Max(inner_content_size.x, _inner_content_size.x);
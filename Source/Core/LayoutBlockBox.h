@@ -138,6 +138,8 @@ public:
 	Vector2f GetVisibleOverflowSize() const;
 	/// Set the inner content size if it is larger than the current value on each axis individually.
 	void ExtendInnerContentSize(Vector2f inner_content_size);
+	/// Returns true if any floating boxes occupy the space of this box, including floats from our ancestors.
+	bool HasFloats() const;
 
 	/// Returns the block box's element.
 	/// @return The block box's element.
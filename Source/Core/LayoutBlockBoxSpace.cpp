@@ -270,6 +270,11 @@ Vector2f LayoutBlockBoxSpace::GetDimensions() const
 	return dimensions - offset;
 }
 
+bool LayoutBlockBoxSpace::IsEmpty() const
+{
+	return boxes[LEFT].empty() && boxes[RIGHT].empty();
+}
+
 void* LayoutBlockBoxSpace::operator new(size_t size)
 {
 	return LayoutEngine::AllocateLayoutChunk(size);
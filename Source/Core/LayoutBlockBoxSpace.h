@@ -82,6 +82,9 @@ public:
 	/// @return The space's dimensions.
 	Vector2f GetDimensions() const;
 
+	/// Returns true if there are no floating boxes within the space, including any imported boxes.
+	bool IsEmpty() const;
+
 	void* operator new(size_t size);
 	void operator delete(void* chunk, size_t size);
 
@@ -0,0 +1,65 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2014 Markus Schöngart
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+#ifndef RMLUI_CORE_LAYOUTCACHE_H
+#define RMLUI_CORE_LAYOUTCACHE_H
+
+#include "../../Include/RmlUi/Core/Box.h"
+#include "../../Include/RmlUi/Core/Types.h"
+
+namespace Rml {
+
+/**
+	Caches the results of formatting an element in its own block formatting context, and of measuring its shrink-to-fit width.
+
+	Flex and table layout may format the same element several times, and unchanged subtrees are formatted again on each document layout. As long
+	as the inputs are the same, and nothing has dirtied the layout of the element or its descendants since, the cached results can be used
+	instead. The cache is invalidated along with the layout, see Element::DirtyLayout().
+ */
+
+struct LayoutCache {
+	// Whether the element's current layout is the result of LayoutEngine::FormatElement() with the inputs below.
+	bool format_valid = false;
+	Vector2f format_containing_block;
+	Box format_box;
+	Vector2f format_visible_overflow_size;
+
+	// Whether the content size below is the result of LayoutEngine::MeasureElement() with the given inputs. Independent of the element's current
+	// layout.
+	bool measure_valid = false;
+	Vector2f measure_containing_block;
+	Box measure_box;
+	Vector2f measure_content_size;
+
+	// Whether the shrink-to-fit width below is valid for the given containing block.
+	bool shrink_to_fit_valid = false;
+	Vector2f shrink_to_fit_containing_block;
+	float shrink_to_fit_width = 0.f;
+};
+
+} // namespace Rml
+#endif
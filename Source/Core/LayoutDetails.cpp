@@ -32,6 +32,7 @@
 #include "../../Include/RmlUi/Core/ElementScroll.h"
 #include "../../Include/RmlUi/Core/Math.h"
 #include "../../Include/RmlUi/Core/Profiling.h"
+#include "LayoutCache.h"
 #include "LayoutEngine.h"
 #include <float.h>
 
@@ -244,6 +245,19 @@ float LayoutDetails::GetShrinkToFitWidth(Element* element, Vector2f containing_b
 {
 	RMLUI_ASSERT(element);
 
+	LayoutCache* cache = element->layout_cache.get();
+	if (cache && cache->shrink_to_fit_valid && cache->shrink_to_fit_containing_block == containing_block)
+		return cache->shrink_to_fit_width;
+
+	if (!cache)
+	{
+		element->layout_cache = MakeUnique<LayoutCache>();
+		cache = element->layout_cache.get();
+	}
+
+	// The element's layout is modified below, thus it no longer corresponds to any previous formatting.
+	cache->format_valid = false;
+
 	Box box;
 	float min_height, max_height;
 	LayoutDetails::BuildBox(box, containing_block, element, BoxContext::Block, containing_block.x);
@@ -269,7 +283,11 @@ float LayoutDetails::GetShrinkToFitWidth(Element* element, Vector2f containing_b
 	// away with not closing the boxes. This is avoided for performance reasons.
 	//block_context_box->Close();
 
-	return Math::Min(containing_block.x, block_context_box->GetShrinkToFitWidth());
+	cache->shrink_to_fit_valid = true;
+	cache->shrink_to_fit_containing_block = containing_block;
+	cache->shrink_to_fit_width = Math::Min(containing_block.x, block_context_box->GetShrinkToFitWidth());
+
+	return cache->shrink_to_fit_width;
 }
 
 ComputedAxisSize LayoutDetails::BuildComputedHorizontalSize(const ComputedValues& computed)
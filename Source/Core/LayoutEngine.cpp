@@ -32,6 +32,7 @@
 #include "../../Include/RmlUi/Core/Profiling.h"
 #include "../../Include/RmlUi/Core/Types.h"
 #include "LayoutBlockBoxSpace.h"
+#include "LayoutCache.h"
 #include "LayoutDetails.h"
 #include "LayoutFlex.h"
 #include "LayoutInlineBoxText.h"
@@ -96,8 +97,6 @@ void LayoutEngine::FormatElement(Element* element, Vector2f containing_block, co
 
 	if (!ValidateTopLevelElement(element))
 		return;
-	
-	auto containing_block_box = MakeUnique<LayoutBlockBox>(nullptr, nullptr, Box(containing_block), 0.0f, FLT_MAX);
 
 	Box box;
 	if (override_initial_box)
@@ -105,6 +104,20 @@ void LayoutEngine::FormatElement(Element* element, Vector2f containing_block, co
 	else
 		LayoutDetails::BuildBox(box, containing_block, element);
 
+	// Skip formatting if the element is already formatted using the same inputs, and nothing has dirtied its layout since.
+	LayoutCache* cache = element->layout_cache.get();
+	if (cache && cache->format_valid && cache->format_containing_block == containing_block && cache->format_box == box)
+	{
+		if (out_visible_overflow_size)
+			*out_visible_overflow_size = cache->format_visible_overflow_size;
+		return;
+	}
+
+	// The caller is responsible for flagging any layout boundaries formatted here, the element's previous state may no longer apply.
+	element->layout_boundary = false;
+
+	auto containing_block_box = MakeUnique<LayoutBlockBox>(nullptr, nullptr, Box(containing_block), 0.0f, FLT_MAX);
+
 	float min_height, max_height;
 	LayoutDetails::GetDefiniteMinMaxHeight(min_height, max_height, element->GetComputedValues(), box, containing_block.y);
 
@@ -124,12 +137,96 @@ void LayoutEngine::FormatElement(Element* element, Vector2f containing_block, co
 
 	block_context_box->CloseAbsoluteElements();
 
+	if (!cache)
+	{
+		element->layout_cache = MakeUnique<LayoutCache>();
+		cache = element->layout_cache.get();
+	}
+	cache->format_valid = true;
+	cache->format_containing_block = containing_block;
+	cache->format_box = box;
+	cache->format_visible_overflow_size = block_context_box->GetVisibleOverflowSize();
+
 	if (out_visible_overflow_size)
-		*out_visible_overflow_size = block_context_box->GetVisibleOverflowSize();
+		*out_visible_overflow_size = cache->format_visible_overflow_size;
 
 	element->OnLayout();
 }
 
+Vector2f LayoutEngine::MeasureElement(Element* element, Vector2f containing_block, const Box& initial_box)
+{
+	LayoutCache* cache = element->layout_cache.get();
+	if (cache && cache->measure_valid && cache->measure_containing_block == containing_block && cache->measure_box == initial_box)
+		return cache->measure_content_size;
+
+	FormatElement(element, containing_block, &initial_box);
+
+	if (!element->layout_cache)
+		element->layout_cache = MakeUnique<LayoutCache>();
+
+	cache = element->layout_cache.get();
+	cache->measure_valid = true;
+	cache->measure_containing_block = containing_block;
+	cache->measure_box = initial_box;
+	cache->measure_content_size = element->GetBox().GetSize();
+
+	return cache->measure_content_size;
+}
+
+bool LayoutEngine::IsLayoutBoundary(Element* element)
+{
+	if (!element->layout_boundary)
+		return false;
+
+	// The flag is set during layout, but the element's properties may have changed since then.
+	const ComputedValues& computed = element->GetComputedValues();
+	if (computed.display() != Style::Display::Block || computed.float_() != Style::Float::None)
+		return false;
+
+	switch (computed.position())
+	{
+	case Style::Position::Absolute:
+	case Style::Position::Fixed: return true;
+	case Style::Position::Relative:
+		return computed.height().type != Style::Height::Auto && computed.overflow_x() != Style::Overflow::Visible &&
+			computed.overflow_y() != Style::Overflow::Visible;
+	case Style::Position::Static: break;
+	}
+
+	return false;
+}
+
+bool LayoutEngine::FormatLayoutBoundary(Element* element)
+{
+	if (!IsLayoutBoundary(element))
+		return false;
+
+	const Vector2f containing_block = element->layout_boundary_containing_block;
+
+	if (element->GetPosition() == Style::Position::Relative)
+	{
+		// The box of the element is independent of its contents, thus it can be reused as is.
+		const Box box = element->GetBox();
+		FormatElement(element, containing_block, &box);
+	}
+	else
+	{
+		// The position of the element's margin edge is retained, but its margins may change with its size.
+		auto get_margin_offset = [](const Box& box) { return Vector2f(box.GetEdge(Box::MARGIN, Box::LEFT), box.GetEdge(Box::MARGIN, Box::TOP)); };
+		const Vector2f old_margin_offset = get_margin_offset(element->GetBox());
+
+		FormatElement(element, containing_block);
+
+		// The offset must always be resolved again, as the position of elements anchored to the right or bottom depends on their size.
+		const Vector2f new_margin_offset = get_margin_offset(element->GetBox());
+		element->SetOffset(element->relative_offset_base + (new_margin_offset - old_margin_offset), element->offset_parent);
+	}
+
+	element->layout_boundary = true;
+
+	return true;
+}
+
 void* LayoutEngine::AllocateLayoutChunk(size_t size)
 {
 	static_assert(ChunkSizeBig > ChunkSizeMedium && ChunkSizeMedium > ChunkSizeSmall, "The following assumes a strict ordering of the chunk sizes.");
@@ -172,6 +269,10 @@ bool LayoutEngine::FormatElement(LayoutBlockBox* block_context_box, Element* ele
 
 	auto& computed = element->GetComputedValues();
 
+	// The element's layout may change from any previous formatting in its own block formatting context.
+	if (element->layout_cache)
+		element->layout_cache->format_valid = false;
+
 	// Check if we have to do any special formatting for any elements that don't fit into the standard layout scheme.
 	if (FormatElementSpecial(block_context_box, element))
 		return true;
@@ -261,6 +362,13 @@ bool LayoutEngine::FormatElementBlock(LayoutBlockBox* block_context_box, Element
 	if (new_block_context_box == nullptr)
 		return false;
 
+	// Positioned elements with a definite height, which catch their own overflow and are not affected by any floats, can later be formatted
+	// independently of their ancestors.
+	const ComputedValues& computed = element->GetComputedValues();
+	element->layout_boundary = (computed.position() == Style::Position::Relative && box.GetSize().y >= 0.f &&
+		computed.overflow_x() != Style::Overflow::Visible && computed.overflow_y() != Style::Overflow::Visible && !new_block_context_box->HasFloats());
+	element->layout_boundary_containing_block = LayoutDetails::GetContainingBlock(block_context_box);
+
 	// Format the element's children.
 	for (int i = 0; i < element->GetNumChildren(); i++)
 	{
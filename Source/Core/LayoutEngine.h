@@ -51,11 +51,28 @@ public:
 	/// @param[out] visible_overflow_size Optionally output the overflow size of the element.
 	static void FormatElement(Element* element, Vector2f containing_block, const Box* override_initial_box = nullptr, Vector2f* out_visible_overflow_size = nullptr);
 
+	/// Determines the content size of an element when formatted in a new block formatting context, such as when measuring flex items or table
+	/// cells. The element may or may not be formatted as a result, thus it must be formatted again using FormatElement() before being used.
+	/// @param[in] element The element to measure.
+	/// @param[in] containing_block The size of the containing block.
+	/// @param[in] initial_box The initial box of the element.
+	/// @return The resulting content size of the element.
+	static Vector2f MeasureElement(Element* element, Vector2f containing_block, const Box& initial_box);
+
 	/// Positions a single element and its children within a block formatting context.
 	/// @param[in] block_context_box The open block box to layout the element in.
 	/// @param[in] element The element to lay out.
 	static bool FormatElement(LayoutBlockBox* block_context_box, Element* element);
 
+	/// Returns true if the element is a layout boundary. The layout of a boundary's contents does not affect anything outside it, and its own
+	/// layout does not depend on its contents. Thus, changes within a boundary can be formatted without formatting its ancestors.
+	/// @param[in] element The element to check, must have been formatted previously.
+	static bool IsLayoutBoundary(Element* element);
+	/// Formats the contents of a layout boundary, using the containing block from its last layout.
+	/// @param[in] element The layout boundary to format.
+	/// @return False if the element is no longer a layout boundary, in which case nothing is formatted.
+	static bool FormatLayoutBoundary(Element* element);
+
 	static void* AllocateLayoutChunk(size_t size);
 	static void DeallocateLayoutChunk(void* chunk, size_t size);
 
@@ -278,8 +278,7 @@ void LayoutFlex::Format()
 			if (initial_box_size.x < 0.f)
 				format_box.SetContent(Vector2f(flex_available_content_size.x - item.cross.sum_edges, initial_box_size.y));
 
-			LayoutEngine::FormatElement(element, flex_content_containing_block, &format_box);
-			item.inner_flex_base_size = element->GetBox().GetSize().y;
+			item.inner_flex_base_size = LayoutEngine::MeasureElement(element, flex_content_containing_block, format_box).y;
 		}
 
 		// Calculate the hypothetical main size (clamped flex base size).
@@ -564,8 +563,8 @@ void LayoutFlex::Format()
 				if (content_size.y < 0.0f)
 				{
 					item.box.SetContent(Vector2f(used_main_size_inner, content_size.y));
-					LayoutEngine::FormatElement(item.element, flex_content_containing_block, &item.box);
-					item.hypothetical_cross_size = item.element->GetBox().GetSize().y + item.cross.sum_edges;
+					item.hypothetical_cross_size =
+						LayoutEngine::MeasureElement(item.element, flex_content_containing_block, item.box).y + item.cross.sum_edges;
 				}
 				else
 				{
@@ -209,7 +209,7 @@ void LayoutInlineBoxText::BuildWordBox()
 	}
 
 	Vector2f content_area;
-	line_segmented = !text_element->GenerateToken(content_area.x, line_begin);
+	line_segmented = !text_element->GenerateToken(content_area.x, line_begin, true);
 	content_area.y = text_element->GetLineHeight();
 	box.SetContent(content_area);
 }
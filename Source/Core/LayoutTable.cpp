@@ -277,10 +277,7 @@ void LayoutTable::DetermineRowHeights()
 
 				// If both the row and the cell heights are 'auto', we need to format the cell to get its height.
 				if (box.GetSize().y < 0)
-				{
-					LayoutEngine::FormatElement(element_cell, table_initial_content_size, &box);
-					box.SetContent(element_cell->GetBox().GetSize());
-				}
+					box.SetContent(LayoutEngine::MeasureElement(element_cell, table_initial_content_size, box));
 
 				// Find the height of the cell which applies only to this row. 
 				// In case it spans multiple rows, we must first subtract the height of any previous rows it spans. It is
@@ -403,8 +400,7 @@ void LayoutTable::FormatCells()
 			if (is_aligned)
 			{
 				// We need to format the cell to know how much padding to add.
-				LayoutEngine::FormatElement(element_cell, table_initial_content_size, &box);
-				box.SetContent(element_cell->GetBox().GetSize());
+				box.SetContent(LayoutEngine::MeasureElement(element_cell, table_initial_content_size, box));
 			}
 			else
 			{
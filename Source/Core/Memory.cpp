@@ -88,7 +88,8 @@ void BasicStackAllocator::deallocate(void* obj) noexcept
 
 BasicStackAllocator& GetGlobalBasicStackAllocator()
 {
-	static BasicStackAllocator stack_allocator(10 * 1024);
+	// One allocator per thread, as the font engine may use it from its worker threads.
+	static thread_local BasicStackAllocator stack_allocator(10 * 1024);
 	return stack_allocator;
 }
 
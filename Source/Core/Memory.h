@@ -77,7 +77,7 @@ namespace Detail {
 	Falls back to malloc if there is not enough space left.
 
 	Warning: Using this is dangerous as deallocation must happen in exact reverse order of allocation.
-	  Memory is shared between different global stack allocators. Should only be used for highly localized code,
+	  Memory is shared between different global stack allocators on the same thread. Should only be used for highly localized code,
 	  where memory is allocated and then quickly thrown away.
 */
 
@@ -74,23 +74,13 @@ const PropertyMap& PropertyDictionary::GetProperties() const
 // Imports potentially un-specified properties into the dictionary.
 void PropertyDictionary::Import(const PropertyDictionary& other, int property_specificity)
 {
-	for (const auto& pair : other.properties)
-	{
-		const PropertyId id = pair.first;
-		const Property& property = pair.second;
-		SetProperty(id, property, property_specificity > 0 ? property_specificity : property.specificity);
-	}
+	MergeProperties(other.properties, property_specificity, 0);
 }
 
 // Merges the contents of another fully-specified property dictionary with this one.
 void PropertyDictionary::Merge(const PropertyDictionary& other, int specificity_offset)
 {
-	for (const auto& pair : other.properties)
-	{
-		const PropertyId id = pair.first;
-		const Property& property = pair.second;
-		SetProperty(id, property, property.specificity + specificity_offset);
-	}
+	MergeProperties(other.properties, -1, specificity_offset);
 }
 
 void PropertyDictionary::SetSourceOfAllProperties(const SharedPtr<const PropertySource>& property_source)
@@ -99,16 +89,56 @@ void PropertyDictionary::SetSourceOfAllProperties(const SharedPtr<const Property
 		p.second.source = property_source;
 }
 
-// Sets a property on the dictionary and its specificity.
-void PropertyDictionary::SetProperty(PropertyId id, const Property& property, int specificity)
+// Merges the incoming properties with ours in a single pass over both maps, which are ordered by property id.
+void PropertyDictionary::MergeProperties(const PropertyMap& other, int forced_specificity, int specificity_offset)
 {
-	PropertyMap::iterator iterator = properties.find(id);
-	if (iterator != properties.end() &&
-		iterator->second.specificity > specificity)
+	auto GetSpecificity = [&](const Property& property) {
+		return forced_specificity > 0 ? forced_specificity : property.specificity + specificity_offset;
+	};
+
+	if (other.empty())
 		return;
 
-	Property& new_property = (properties[id] = property);
-	new_property.specificity = specificity;
+	if (properties.empty())
+	{
+		properties = other;
+		for (auto& pair : properties)
+			pair.second.specificity = GetSpecificity(pair.second);
+		return;
+	}
+
+	PropertyMap merged_properties;
+
+	auto it = properties.begin();
+	const auto it_end = properties.end();
+
+	for (const auto& pair : other)
+	{
+		const PropertyId id = pair.first;
+		const int specificity = GetSpecificity(pair.second);
+
+		for (; it != it_end && it->first < id; ++it)
+			merged_properties.emplace(it->first, std::move(it->second));
+
+		// Keep our own property in case of a conflict where it has a higher specificity.
+		if (it != it_end && it->first == id)
+		{
+			Property& existing_property = (it++)->second;
+			if (existing_property.specificity > specificity)
+			{
+				merged_properties.emplace(id, std::move(existing_property));
+				continue;
+			}
+		}
+
+		Property& new_property = merged_properties.emplace(id, pair.second).first->second;
+		new_property.specificity = specificity;
+	}
+
+	for (; it != it_end; ++it)
+		merged_properties.emplace(it->first, std::move(it->second));
+
+	properties = std::move(merged_properties);
 }
 
 } // namespace Rml
@@ -0,0 +1,431 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+#include "RenderBatcher.h"
+#include "../../Include/RmlUi/Core/Math.h"
+#include "../../Include/RmlUi/Core/Profiling.h"
+#include "../../Include/RmlUi/Core/Utilities.h"
+#include <algorithm>
+
+namespace Rml {
+
+// Above this number of damaged regions, they are combined into a single region covering all of them.
+static constexpr size_t MaxDamagedRegions = 16;
+
+// FNV-1a hash of the given bytes, combined with the seed.
+static size_t HashBytes(const void* data, size_t num_bytes, size_t seed)
+{
+	uint64_t hash = 14695981039346656037ull;
+	const byte* bytes = static_cast<const byte*>(data);
+	for (size_t i = 0; i < num_bytes; i++)
+		hash = (hash ^ bytes[i]) * 1099511628211ull;
+
+	Utilities::HashCombine(seed, hash);
+	return seed;
+}
+
+static Vector2i MinComponents(Vector2i a, Vector2i b)
+{
+	return Vector2i(Math::Min(a.x, b.x), Math::Min(a.y, b.y));
+}
+
+static Vector2i MaxComponents(Vector2i a, Vector2i b)
+{
+	return Vector2i(Math::Max(a.x, b.x), Math::Max(a.y, b.y));
+}
+
+void RenderBatcher::BeginFrame(Vector2i new_dimensions)
+{
+	RMLUI_ASSERT(!recording);
+	command_list.Clear();
+	command_list.damage_tracking = damage_tracking;
+	recording = true;
+
+	if (new_dimensions != dimensions)
+	{
+		dimensions = new_dimensions;
+		previous_frame_valid = false;
+	}
+
+	// The scissor state is always submitted at the start of the frame, as in immediate mode. The transform is only submitted when it changes,
+	// and is thus assumed to remain from the end of the previous frame.
+	recorded_scissor_enabled_valid = false;
+	recorded_scissor_region_valid = false;
+}
+
+const RenderCommandList& RenderBatcher::EndFrame()
+{
+	RMLUI_ASSERT(recording);
+
+	// Leave the render interface in the requested state, just like in immediate mode.
+	FlushState();
+	recording = false;
+
+	if (damage_tracking)
+		GenerateDamagedRegions();
+
+	return command_list;
+}
+
+void RenderBatcher::EnableDamageTracking(bool enable)
+{
+	RMLUI_ASSERT(!recording);
+	damage_tracking = enable;
+	previous_frame_valid = false;
+	damage_items.clear();
+	previous_damage_items.clear();
+}
+
+void RenderBatcher::RenderGeometry(const Vertex* vertices, int num_vertices, const int* indices, int num_indices, TextureHandle texture,
+	int texture_version, Vector2f translation, size_t content_hash)
+{
+	RMLUI_ASSERT(recording);
+	if (num_vertices <= 0 || num_indices <= 0)
+		return;
+
+	const bool state_changed = FlushState();
+
+	Vector<RenderCommand>& commands = command_list.commands;
+	if (state_changed || commands.empty() || commands.back().type != RenderCommandType::RenderGeometry || commands.back().texture != texture)
+	{
+		RenderCommand& command = AddCommand(RenderCommandType::RenderGeometry);
+		command.vertex_offset = (int)command_list.vertices.size();
+		command.index_offset = (int)command_list.indices.size();
+		command.texture = texture;
+	}
+
+	RenderCommand& batch = commands.back();
+	const int index_base = batch.num_vertices;
+
+	// The vertices and indices of the batch are always located at the end of the buffers, thus we can simply append the new geometry.
+	Vector<Vertex>& batch_vertices = command_list.vertices;
+	const size_t vertex_begin = batch_vertices.size();
+	batch_vertices.insert(batch_vertices.end(), vertices, vertices + num_vertices);
+
+	Vector2f top_left = batch_vertices[vertex_begin].position + translation;
+	Vector2f bottom_right = top_left;
+	for (size_t i = vertex_begin; i < batch_vertices.size(); i++)
+	{
+		Vector2f& position = batch_vertices[i].position;
+		position += translation;
+		top_left = Math::Min(top_left, position);
+		bottom_right = Math::Max(bottom_right, position);
+	}
+
+	if (damage_tracking)
+		AddDamageItem(content_hash, texture, texture_version, translation, top_left, bottom_right);
+
+	Vector<int>& batch_indices = command_list.indices;
+	batch_indices.reserve(batch_indices.size() + num_indices);
+	for (int i = 0; i < num_indices; i++)
+		batch_indices.push_back(indices[i] + index_base);
+
+	batch.num_vertices += num_vertices;
+	batch.num_indices += num_indices;
+}
+
+void RenderBatcher::EnableScissorRegion(bool enable)
+{
+	requested.scissor_enabled = enable;
+}
+
+void RenderBatcher::SetScissorRegion(Vector2i origin, Vector2i dimensions)
+{
+	requested.scissor_origin = origin;
+	requested.scissor_dimensions = dimensions;
+}
+
+void RenderBatcher::SetTransform(const Matrix4f* transform)
+{
+	requested.transform_enabled = (transform != nullptr);
+	if (transform)
+		requested.transform = *transform;
+}
+
+bool RenderBatcher::FlushState()
+{
+	const size_t num_commands_before = command_list.commands.size();
+
+	if (!recorded_scissor_enabled_valid || requested.scissor_enabled != recorded.scissor_enabled)
+	{
+		AddCommand(RenderCommandType::EnableScissorRegion).scissor_enabled = requested.scissor_enabled;
+		recorded.scissor_enabled = requested.scissor_enabled;
+		recorded_scissor_enabled_valid = true;
+	}
+
+	if (requested.scissor_enabled &&
+		(!recorded_scissor_region_valid || requested.scissor_origin != recorded.scissor_origin ||
+			requested.scissor_dimensions != recorded.scissor_dimensions))
+	{
+		RenderCommand& command = AddCommand(RenderCommandType::SetScissorRegion);
+		command.scissor_origin = requested.scissor_origin;
+		command.scissor_dimensions = requested.scissor_dimensions;
+		recorded.scissor_origin = requested.scissor_origin;
+		recorded.scissor_dimensions = requested.scissor_dimensions;
+		recorded_scissor_region_valid = true;
+	}
+
+	if (!recorded_transform_valid || requested.transform_enabled != recorded.transform_enabled ||
+		(requested.transform_enabled && requested.transform != recorded.transform))
+	{
+		RenderCommand& command = AddCommand(RenderCommandType::SetTransform);
+		if (requested.transform_enabled)
+		{
+			command.transform_index = (int)command_list.transforms.size();
+			command_list.transforms.push_back(requested.transform);
+		}
+		recorded.transform_enabled = requested.transform_enabled;
+		recorded.transform = requested.transform;
+		recorded_transform_valid = true;
+	}
+
+	const bool state_changed = (command_list.commands.size() != num_commands_before);
+
+	if (damage_tracking && state_changed)
+	{
+		size_t fingerprint = 0;
+		Utilities::HashCombine(fingerprint, recorded.scissor_enabled);
+		if (recorded.scissor_enabled)
+		{
+			Utilities::HashCombine(fingerprint, recorded.scissor_origin.x);
+			Utilities::HashCombine(fingerprint, recorded.scissor_origin.y);
+			Utilities::HashCombine(fingerprint, recorded.scissor_dimensions.x);
+			Utilities::HashCombine(fingerprint, recorded.scissor_dimensions.y);
+		}
+		if (recorded.transform_enabled)
+			fingerprint = HashBytes(recorded.transform.data(), sizeof(float) * 16, fingerprint);
+
+		recorded_state_fingerprint = fingerprint;
+	}
+
+	return state_changed;
+}
+
+RenderCommand& RenderBatcher::AddCommand(RenderCommandType type)
+{
+	command_list.commands.emplace_back();
+	RenderCommand& command = command_list.commands.back();
+	command.type = type;
+	return command;
+}
+
+size_t RenderBatcher::HashGeometry(const Vertex* vertices, int num_vertices, const int* indices, int num_indices)
+{
+	size_t hash = HashBytes(vertices, sizeof(Vertex) * num_vertices, 0);
+	return HashBytes(indices, sizeof(int) * num_indices, hash);
+}
+
+void RenderBatcher::AddDamageItem(size_t content_hash, TextureHandle texture, int texture_version, Vector2f translation, Vector2f top_left,
+	Vector2f bottom_right)
+{
+	const Vector2f context_bottom_right = Vector2f(dimensions);
+
+	// Find the screen-space bounds of the geometry, the transform is applied before the scissor region.
+	if (recorded.transform_enabled)
+	{
+		const Vector2f corners[4] = {top_left, {bottom_right.x, top_left.y}, {top_left.x, bottom_right.y}, bottom_right};
+		top_left = context_bottom_right;
+		bottom_right = Vector2f(0.f);
+
+		for (const Vector2f& corner : corners)
+		{
+			const Vector4f projected = recorded.transform * Vector4f(corner.x, corner.y, 0.f, 1.f);
+			if (projected.w < 0.0001f)
+			{
+				// The geometry passes behind the viewer, we can't determine its bounds so just cover the whole context.
+				top_left = Vector2f(0.f);
+				bottom_right = context_bottom_right;
+				break;
+			}
+
+			const Vector2f position = Vector2f(projected.x, projected.y) / projected.w;
+			top_left = Math::Min(top_left, position);
+			bottom_right = Math::Max(bottom_right, position);
+		}
+	}
+
+	if (recorded.scissor_enabled)
+	{
+		top_left = Math::Max(top_left, Vector2f(recorded.scissor_origin));
+		bottom_right = Math::Min(bottom_right, Vector2f(recorded.scissor_origin + recorded.scissor_dimensions));
+	}
+
+	top_left = Math::Max(top_left, Vector2f(0.f));
+	bottom_right = Math::Min(bottom_right, context_bottom_right);
+
+	// Geometry which is not visible can not cause any damage.
+	if (bottom_right.x <= top_left.x || bottom_right.y <= top_left.y)
+		return;
+
+	size_t fingerprint = recorded_state_fingerprint;
+	Utilities::HashCombine(fingerprint, texture);
+	Utilities::HashCombine(fingerprint, texture_version);
+	Utilities::HashCombine(fingerprint, translation.x);
+	Utilities::HashCombine(fingerprint, translation.y);
+	Utilities::HashCombine(fingerprint, content_hash);
+
+	damage_items.push_back(DamageItem{fingerprint, top_left, bottom_right});
+}
+
+void RenderBatcher::GenerateDamagedRegions()
+{
+	RMLUI_ZoneScoped;
+
+	if (!previous_frame_valid)
+	{
+		AddDamagedRegion(Vector2f(0.f), Vector2f(dimensions));
+	}
+	else
+	{
+		// Match each item to an identical item from the previous frame. Unmatched items from either frame have been added or removed.
+		first_unmatched_index.clear();
+		next_index.assign(previous_damage_items.size(), -1);
+		for (int i = (int)previous_damage_items.size() - 1; i >= 0; i--)
+		{
+			auto it = first_unmatched_index.find(previous_damage_items[i].fingerprint);
+			if (it != first_unmatched_index.end())
+			{
+				next_index[i] = it->second;
+				it->second = i;
+			}
+			else
+				first_unmatched_index.emplace(previous_damage_items[i].fingerprint, i);
+		}
+
+		matched_previous_index.clear();
+		matched_index.clear();
+		for (int i = 0; i < (int)damage_items.size(); i++)
+		{
+			const DamageItem& item = damage_items[i];
+			auto it = first_unmatched_index.find(item.fingerprint);
+			if (it != first_unmatched_index.end() && it->second >= 0)
+			{
+				matched_previous_index.push_back(it->second);
+				matched_index.push_back(i);
+				it->second = next_index[it->second];
+			}
+			else
+				AddDamagedRegion(item.top_left, item.bottom_right);
+		}
+
+		// Next-index is re-used to mark the matched items from the previous frame.
+		for (int previous_index : matched_previous_index)
+			next_index[previous_index] = -2;
+		for (size_t i = 0; i < previous_damage_items.size(); i++)
+		{
+			if (next_index[i] != -2)
+				AddDamagedRegion(previous_damage_items[i].top_left, previous_damage_items[i].bottom_right);
+		}
+
+		// Items which are unchanged but painted in a different order relative to each other have also been damaged. We keep the longest
+		// subsequence of matches still in their previous order, the remaining ones are damaged.
+		const bool all_in_order = std::is_sorted(matched_previous_index.begin(), matched_previous_index.end());
+		if (!all_in_order)
+		{
+			const int num_matches = (int)matched_previous_index.size();
+			sequence_tails.clear();
+			sequence_predecessors.assign(num_matches, -1);
+			in_order.assign(num_matches, false);
+
+			for (int i = 0; i < num_matches; i++)
+			{
+				const int value = matched_previous_index[i];
+				auto it = std::lower_bound(sequence_tails.begin(), sequence_tails.end(), value,
+					[this](int tail, int value) { return matched_previous_index[tail] < value; });
+
+				if (it != sequence_tails.begin())
+					sequence_predecessors[i] = *(it - 1);
+
+				if (it == sequence_tails.end())
+					sequence_tails.push_back(i);
+				else
+					*it = i;
+			}
+
+			for (int i = (sequence_tails.empty() ? -1 : sequence_tails.back()); i >= 0; i = sequence_predecessors[i])
+				in_order[i] = true;
+
+			for (int i = 0; i < num_matches; i++)
+			{
+				if (!in_order[i])
+				{
+					const DamageItem& item = damage_items[matched_index[i]];
+					AddDamagedRegion(item.top_left, item.bottom_right);
+				}
+			}
+		}
+	}
+
+	std::swap(damage_items, previous_damage_items);
+	damage_items.clear();
+	previous_frame_valid = true;
+}
+
+void RenderBatcher::AddDamagedRegion(Vector2f top_left, Vector2f bottom_right)
+{
+	Vector2i region_top_left = {Math::RoundDownToInteger(top_left.x), Math::RoundDownToInteger(top_left.y)};
+	Vector2i region_bottom_right = {Math::RoundUpToInteger(bottom_right.x), Math::RoundUpToInteger(bottom_right.y)};
+
+	Vector<RenderRegion>& regions = command_list.damaged_regions;
+
+	// Combine the new region with all existing regions that it touches.
+	bool combined = true;
+	while (combined)
+	{
+		combined = false;
+		for (size_t i = 0; i < regions.size(); i++)
+		{
+			const Vector2i other_top_left = regions[i].origin;
+			const Vector2i other_bottom_right = regions[i].origin + regions[i].dimensions;
+			if (region_top_left.x <= other_bottom_right.x && other_top_left.x <= region_bottom_right.x && region_top_left.y <= other_bottom_right.y &&
+				other_top_left.y <= region_bottom_right.y)
+			{
+				region_top_left = MinComponents(region_top_left, other_top_left);
+				region_bottom_right = MaxComponents(region_bottom_right, other_bottom_right);
+				regions[i] = regions.back();
+				regions.pop_back();
+				combined = true;
+				break;
+			}
+		}
+	}
+
+	regions.push_back(RenderRegion{region_top_left, region_bottom_right - region_top_left});
+
+	if (regions.size() > MaxDamagedRegions)
+	{
+		for (const RenderRegion& region : regions)
+		{
+			region_top_left = MinComponents(region_top_left, region.origin);
+			region_bottom_right = MaxComponents(region_bottom_right, region.origin + region.dimensions);
+		}
+		regions.clear();
+		regions.push_back(RenderRegion{region_top_left, region_bottom_right - region_top_left});
+	}
+}
+
+} // namespace Rml
@@ -0,0 +1,135 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+#ifndef RMLUI_CORE_RENDERBATCHER_H
+#define RMLUI_CORE_RENDERBATCHER_H
+
+#include "../../Include/RmlUi/Core/RenderCommandList.h"
+#include "../../Include/RmlUi/Core/Types.h"
+
+namespace Rml {
+
+/**
+	Records the render calls of a context into a command list, for submitting the whole frame at once.
+
+	Geometry is appended to the current batch as long as the texture and render state is unchanged. State changes are
+	deferred until the next geometry is recorded, so that state which is changed and then restored without any geometry
+	being rendered in-between does not break the batch.
+
+	With damage tracking enabled, a fingerprint and the screen bounds of each rendered geometry are recorded as well. At the
+	end of the frame these are compared against the previous frame to find the regions whose rendered output changed.
+ */
+
+class RenderBatcher {
+public:
+	/// Clears the previously recorded frame and starts recording a new one.
+	/// @param[in] dimensions The dimensions of the context being rendered.
+	void BeginFrame(Vector2i dimensions);
+	/// Stops recording.
+	/// @return The commands recorded since the call to BeginFrame().
+	const RenderCommandList& EndFrame();
+
+	/// Returns true between calls to BeginFrame() and EndFrame().
+	bool IsRecording() const { return recording; }
+
+	/// Enables or disables comparison of each frame against the previous one.
+	void EnableDamageTracking(bool enable);
+
+	/// Appends the geometry to the current batch.
+	/// @param[in] texture_version The version of the texture's data, so that damage is detected when the texture is updated in place.
+	/// @param[in] content_hash A hash of the untranslated vertices and indices as given by HashGeometry(), used for damage tracking.
+	void RenderGeometry(const Vertex* vertices, int num_vertices, const int* indices, int num_indices, TextureHandle texture, int texture_version,
+		Vector2f translation, size_t content_hash);
+
+	void EnableScissorRegion(bool enable);
+	void SetScissorRegion(Vector2i origin, Vector2i dimensions);
+
+	void SetTransform(const Matrix4f* transform);
+
+	/// Returns a hash of the given vertices and indices. Callers are expected to cache the hash along with their geometry, so that
+	/// unchanged geometry is not hashed again every frame.
+	static size_t HashGeometry(const Vertex* vertices, int num_vertices, const int* indices, int num_indices);
+
+private:
+	struct State {
+		bool scissor_enabled = false;
+		Vector2i scissor_origin;
+		Vector2i scissor_dimensions;
+		bool transform_enabled = false;
+		Matrix4f transform = Matrix4f::Identity();
+	};
+
+	struct DamageItem {
+		size_t fingerprint;
+		Vector2f top_left;
+		Vector2f bottom_right;
+	};
+
+	// Submits commands for any differences between the requested state and the state of the recorded commands.
+	// @return True if any commands were added.
+	bool FlushState();
+
+	RenderCommand& AddCommand(RenderCommandType type);
+
+	// Records the fingerprint and screen-space bounds of the given geometry.
+	void AddDamageItem(size_t content_hash, TextureHandle texture, int texture_version, Vector2f translation, Vector2f top_left,
+		Vector2f bottom_right);
+	// Compares the damage items of this frame against the previous frame, and generates the damaged regions.
+	void GenerateDamagedRegions();
+	void AddDamagedRegion(Vector2f top_left, Vector2f bottom_right);
+
+	RenderCommandList command_list;
+	bool recording = false;
+
+	// The state requested by the most recent calls. Persists between frames, like the state of the render interface.
+	State requested;
+	// The state as of the last recorded command.
+	State recorded;
+	bool recorded_scissor_enabled_valid = false;
+	bool recorded_scissor_region_valid = false;
+	bool recorded_transform_valid = false;
+
+	bool damage_tracking = false;
+	// True if the previous frame was recorded with damage tracking enabled, and at the same dimensions as the current frame.
+	bool previous_frame_valid = false;
+	Vector2i dimensions;
+	size_t recorded_state_fingerprint = 0;
+	Vector<DamageItem> damage_items;
+	Vector<DamageItem> previous_damage_items;
+
+	// Scratch buffers used when comparing frames.
+	UnorderedMap<size_t, int> first_unmatched_index;
+	Vector<int> next_index;
+	Vector<int> matched_previous_index;
+	Vector<int> matched_index;
+	Vector<int> sequence_tails;
+	Vector<int> sequence_predecessors;
+	Vector<bool> in_order;
+};
+
+} // namespace Rml
+#endif
@@ -27,6 +27,7 @@
  */
 
 #include "../../Include/RmlUi/Core/RenderInterface.h"
+#include "../../Include/RmlUi/Core/Math.h"
 #include "TextureDatabase.h"
 
 namespace Rml {
@@ -34,6 +35,7 @@ namespace Rml {
 RenderInterface::RenderInterface()
 {
 	context = nullptr;
+	texture_update_failed = false;
 }
 
 RenderInterface::~RenderInterface()
@@ -74,6 +76,34 @@ bool RenderInterface::GenerateTexture(TextureHandle& /*texture_handle*/, const b
 	return false;
 }
 
+// Called by RmlUi when a texture containing signed distance fields is required.
+bool RenderInterface::GenerateDistanceFieldTexture(TextureHandle& texture_handle, const byte* source, const Vector2i& source_dimensions)
+{
+	// Convert the distances to coverage, antialiased over a single texel around the edge. This is the CPU reference for how the distance
+	// fields should be rendered, although the edges are only sharp when the texture is rendered at its native resolution.
+	const int num_bytes = source_dimensions.x * source_dimensions.y * 4;
+	UniquePtr<byte[]> data(new byte[num_bytes]);
+
+	for (int i = 0; i < num_bytes; i += 4)
+	{
+		const int coverage = ((int(source[i + 3]) - 128) * 255) / 8 + 128;
+
+		data[i + 0] = source[i + 0];
+		data[i + 1] = source[i + 1];
+		data[i + 2] = source[i + 2];
+		data[i + 3] = byte(Math::Clamp(coverage, 0, 255));
+	}
+
+	return GenerateTexture(texture_handle, data.get(), source_dimensions);
+}
+
+// Called by RmlUi when a region of a previously generated texture should be replaced with new data.
+bool RenderInterface::UpdateTexture(TextureHandle /*texture_handle*/, const Vector2i& /*region_origin*/, const Vector2i& /*region_dimensions*/,
+	const byte* /*source*/, int /*source_stride*/)
+{
+	return false;
+}
+
 // Called by RmlUi when a loaded texture is no longer required.
 void RenderInterface::ReleaseTexture(TextureHandle /*texture*/)
 {
@@ -84,6 +114,33 @@ void RenderInterface::SetTransform(const Matrix4f* /*transform*/)
 {
 }
 
+// Called by RmlUi when a context with render batching enabled has finished recording a frame.
+void RenderInterface::RenderCommands(const RenderCommandList& command_list)
+{
+	for (const RenderCommand& command : command_list.commands)
+	{
+		switch (command.type)
+		{
+		case RenderCommandType::RenderGeometry:
+		{
+			Vertex* vertices = const_cast<Vertex*>(command_list.vertices.data()) + command.vertex_offset;
+			int* indices = const_cast<int*>(command_list.indices.data()) + command.index_offset;
+			RenderGeometry(vertices, command.num_vertices, indices, command.num_indices, command.texture, Vector2f(0.f));
+		}
+		break;
+		case RenderCommandType::EnableScissorRegion:
+			EnableScissorRegion(command.scissor_enabled);
+			break;
+		case RenderCommandType::SetScissorRegion:
+			SetScissorRegion(command.scissor_origin.x, command.scissor_origin.y, command.scissor_dimensions.x, command.scissor_dimensions.y);
+			break;
+		case RenderCommandType::SetTransform:
+			SetTransform(command.transform_index < 0 ? nullptr : &command_list.transforms[command.transform_index]);
+			break;
+		}
+	}
+}
+
 // Get the context currently being rendered.
 Context* RenderInterface::GetContext() const
 {
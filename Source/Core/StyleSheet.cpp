@@ -163,6 +163,57 @@ const Sprite* StyleSheet::GetSprite(const String& name) const
 	return spritesheet_list.GetSprite(name);
 }
 
+bool StyleSheet::IsMatchingEquivalent(const Element* a, const Element* b) const
+{
+	if (styled_node_index.any_sibling_dependent)
+		return false;
+
+	const ElementStyle* style_a = a->GetStyle();
+	const ElementStyle* style_b = b->GetStyle();
+
+	if (style_a->GetTagAtom() != style_b->GetTagAtom() || style_a->GetIdAtom() != style_b->GetIdAtom() ||
+		style_a->GetClassAtoms() != style_b->GetClassAtoms() || style_a->GetPseudoClassAtoms() != style_b->GetPseudoClassAtoms())
+		return false;
+
+	// The elements may be matched differently if either of them is positioned differently among its siblings.
+	if (!styled_node_index.sibling_dependent.empty())
+	{
+		auto IsSiblingDependent = [this](Atom atom) { return styled_node_index.sibling_dependent.count(static_cast<std::size_t>(atom)) > 0; };
+
+		if (IsSiblingDependent(style_a->GetTagAtom()) || IsSiblingDependent(style_a->GetIdAtom()) ||
+			std::any_of(style_a->GetClassAtoms().begin(), style_a->GetClassAtoms().end(), IsSiblingDependent))
+			return false;
+	}
+
+	for (const String& name : styled_node_index.attribute_names)
+	{
+		const Variant* value_a = a->GetAttribute(name);
+		const Variant* value_b = b->GetAttribute(name);
+		if (value_a != value_b && (!value_a || !value_b || !(*value_a == *value_b)))
+			return false;
+	}
+
+	return true;
+}
+
+int StyleSheet::GetClassInvalidation(const String& class_name) const
+{
+	auto it = styled_node_index.class_invalidation.find(static_cast<std::size_t>(AtomTable::Find(class_name)));
+	return it != styled_node_index.class_invalidation.end() ? it->second : 0;
+}
+
+int StyleSheet::GetPseudoClassInvalidation(const String& pseudo_class) const
+{
+	auto it = styled_node_index.pseudo_class_invalidation.find(static_cast<std::size_t>(AtomTable::Find(pseudo_class)));
+	return it != styled_node_index.pseudo_class_invalidation.end() ? it->second : 0;
+}
+
+int StyleSheet::GetAttributeInvalidation(const String& attribute_name) const
+{
+	auto it = styled_node_index.attribute_invalidation.find(attribute_name);
+	return it != styled_node_index.attribute_invalidation.end() ? it->second : 0;
+}
+
 // Returns the compiled element definition for a given element hierarchy.
 SharedPtr<const ElementDefinition> StyleSheet::GetElementDefinition(const Element* element) const
 {
@@ -172,8 +223,11 @@ SharedPtr<const ElementDefinition> StyleSheet::GetElementDefinition(const Elemen
 	static Vector< const StyleSheetNode* > applicable_nodes;
 	applicable_nodes.clear();
 
-	auto AddApplicableNodes = [element](const StyleSheetIndex::NodeIndex& node_index, const String& key) {
-		auto it_nodes = node_index.find(Hash<String>()(key));
+	const ElementStyle* style = element->GetStyle();
+	const AncestorFilter& ancestor_filter = style->GetAncestorFilter();
+
+	auto AddApplicableNodes = [element, &ancestor_filter](const StyleSheetIndex::NodeIndex& node_index, Atom key) {
+		auto it_nodes = node_index.find(static_cast<std::size_t>(key));
 		if (it_nodes != node_index.end())
 		{
 			const StyleSheetIndex::NodeList& nodes = it_nodes->second;
@@ -182,35 +236,33 @@ SharedPtr<const ElementDefinition> StyleSheet::GetElementDefinition(const Elemen
 			{
 				// We found a node that has at least one requirement matching the element. Now see if we satisfy the remaining requirements of the
 				// node, including all ancestor nodes. What this involves is traversing the style nodes backwards, trying to match nodes in the
-				// element's hierarchy to nodes in the style hierarchy.
-				if (node->IsApplicable(element))
+				// element's hierarchy to nodes in the style hierarchy. Before any of this, rule out nodes that require ancestors we don't have.
+				if (ancestor_filter.MayContainAll(node->GetAncestorRequirements()) && node->IsApplicable(element))
 					applicable_nodes.push_back(node);
 			}
 		}
 	};
 
-	// See if there are any styles defined for this element.
-	const String& tag = element->GetTagName();
-	const String& id = element->GetId();
-	const StringList& class_names = element->GetStyle()->GetClassNameList();
-
 	// Text elements are never matched.
-	if (tag == "#text")
+	if (element->GetTagName() == "#text")
 		return nullptr;
 
-	// First, look up the indexed requirements. 
-	if (!id.empty())
+	// See if there are any styles defined for this element.
+	const Atom id = style->GetIdAtom();
+
+	// First, look up the indexed requirements.
+	if (id != Atom::None)
 		AddApplicableNodes(styled_node_index.ids, id);
 
-	for (const String& name : class_names)
+	for (Atom name : style->GetClassAtoms())
 		AddApplicableNodes(styled_node_index.classes, name);
 
-	AddApplicableNodes(styled_node_index.tags, tag);
+	AddApplicableNodes(styled_node_index.tags, style->GetTagAtom());
 
 	// Also check all remaining nodes that don't contain any indexed requirements.
 	for (const StyleSheetNode* node : styled_node_index.other)
 	{
-		if (node->IsApplicable(element))
+		if (ancestor_filter.MayContainAll(node->GetAncestorRequirements()) && node->IsApplicable(element))
 			applicable_nodes.push_back(node);
 	}
 
@@ -30,6 +30,7 @@
 #include "../../Include/RmlUi/Core/Element.h"
 #include "../../Include/RmlUi/Core/Profiling.h"
 #include "../../Include/RmlUi/Core/StyleSheet.h"
+#include "ElementStyle.h"
 #include "StyleSheetFactory.h"
 #include "StyleSheetSelector.h"
 #include <algorithm>
@@ -50,11 +51,13 @@ StyleSheetNode::StyleSheetNode()
 StyleSheetNode::StyleSheetNode(StyleSheetNode* parent, const CompoundSelector& selector) : parent(parent), selector(selector)
 {
 	CalculateAndSetSpecificity();
+	CalculateAndSetAncestorRequirements();
 }
 
 StyleSheetNode::StyleSheetNode(StyleSheetNode* parent, CompoundSelector&& selector) : parent(parent), selector(std::move(selector))
 {
 	CalculateAndSetSpecificity();
+	CalculateAndSetAncestorRequirements();
 }
 
 StyleSheetNode* StyleSheetNode::GetOrCreateChildNode(const CompoundSelector& other)
@@ -131,8 +134,8 @@ void StyleSheetNode::BuildIndex(StyleSheetIndex& styled_node_index) const
 	// If this has properties defined, then we insert it into the styled node index.
 	if (properties.GetNumProperties() > 0)
 	{
-		auto IndexInsertNode = [](StyleSheetIndex::NodeIndex& node_index, const String& key, const StyleSheetNode* node) {
-			StyleSheetIndex::NodeList& nodes = node_index[Hash<String>()(key)];
+		auto IndexInsertNode = [](StyleSheetIndex::NodeIndex& node_index, Atom key, const StyleSheetNode* node) {
+			StyleSheetIndex::NodeList& nodes = node_index[static_cast<std::size_t>(key)];
 			auto it = std::find(nodes.begin(), nodes.end(), node);
 			if (it == nodes.end())
 				nodes.push_back(node);
@@ -140,30 +143,136 @@ void StyleSheetNode::BuildIndex(StyleSheetIndex& styled_node_index) const
 
 		// Add this node to the appropriate index for looking up applicable nodes later. Prioritize the most unique requirement first and the most
 		// general requirement last. This way we are able to rule out as many nodes as possible as quickly as possible.
-		if (!selector.id.empty())
+		if (selector.id_atom != Atom::None)
 		{
-			IndexInsertNode(styled_node_index.ids, selector.id, this);
+			IndexInsertNode(styled_node_index.ids, selector.id_atom, this);
 		}
-		else if (!selector.class_names.empty())
+		else if (!selector.class_atoms.empty())
 		{
 			// @performance Right now we just use the first class for simplicity. Later we may want to devise a better strategy to try to add the
 			// class with the most unique name. For example by adding the class from this node's list that has the fewest existing matches.
-			IndexInsertNode(styled_node_index.classes, selector.class_names.front(), this);
+			IndexInsertNode(styled_node_index.classes, selector.class_atoms.front(), this);
 		}
-		else if (!selector.tag.empty())
+		else if (selector.tag_atom != Atom::None)
 		{
-			IndexInsertNode(styled_node_index.tags, selector.tag, this);
+			IndexInsertNode(styled_node_index.tags, selector.tag_atom, this);
 		}
 		else
 		{
 			styled_node_index.other.push_back(this);
 		}
+
+		AddSharingRequirements(styled_node_index, true);
+		AddInvalidationSets(styled_node_index, StyleSheetIndex::InvalidateSelf);
 	}
 
 	for (auto& child : children)
 		child->BuildIndex(styled_node_index);
 }
 
+bool StyleSheetNode::AddSharingRequirements(StyleSheetIndex& styled_node_index, bool index_sibling_dependent_nodes) const
+{
+	bool result = false;
+
+	for (const StyleSheetNode* node = this; node && node->parent; node = node->parent)
+	{
+		const CompoundSelector& node_selector = node->selector;
+
+		// The element matched by the right-hand side of a sibling combinator depends on its previous siblings.
+		bool sibling_dependent =
+			(node_selector.combinator == SelectorCombinator::NextSibling || node_selector.combinator == SelectorCombinator::SubsequentSibling);
+
+		for (const AttributeSelector& attribute : node_selector.attributes)
+		{
+			StringList& names = styled_node_index.attribute_names;
+			if (std::find(names.begin(), names.end(), attribute.name) == names.end())
+				names.push_back(attribute.name);
+		}
+
+		for (const StructuralSelector& structural_selector : node_selector.structural_selectors)
+		{
+			// The negation selector itself does not depend on siblings, but its arguments may. They are matched against the same element, so then we
+			// consider this node sibling dependent.
+			if (structural_selector.type == StructuralSelectorType::Not && structural_selector.selector_tree)
+			{
+				for (const StyleSheetNode* leaf : structural_selector.selector_tree->leafs)
+				{
+					if (leaf->AddSharingRequirements(styled_node_index, false))
+						sibling_dependent = true;
+				}
+			}
+			else
+				sibling_dependent = true;
+		}
+
+		if (sibling_dependent)
+		{
+			result = true;
+
+			if (index_sibling_dependent_nodes)
+			{
+				if (node_selector.id_atom != Atom::None)
+					styled_node_index.sibling_dependent.insert(static_cast<std::size_t>(node_selector.id_atom));
+				else if (!node_selector.class_atoms.empty())
+					styled_node_index.sibling_dependent.insert(static_cast<std::size_t>(node_selector.class_atoms.front()));
+				else if (node_selector.tag_atom != Atom::None)
+					styled_node_index.sibling_dependent.insert(static_cast<std::size_t>(node_selector.tag_atom));
+				else
+					styled_node_index.any_sibling_dependent = true;
+			}
+		}
+	}
+
+	return result;
+}
+
+void StyleSheetNode::AddInvalidationSets(StyleSheetIndex& styled_node_index, int subject_invalidation) const
+{
+	// Any element affected by a change to the element matched by an inner selector is affected by the change, as are the elements affected through
+	// it by the enclosing selector. For simplicity, we only distinguish between the element itself and its descendants or siblings here.
+	auto Combine = [](int inner, int outer) {
+		if (outer == StyleSheetIndex::InvalidateSelf)
+			return inner;
+		if (inner == StyleSheetIndex::InvalidateSelf)
+			return outer;
+		return inner | outer;
+	};
+
+	// The element matched by this node is the subject of the selector.
+	int node_invalidation = StyleSheetIndex::InvalidateSelf;
+
+	for (const StyleSheetNode* node = this; node && node->parent; node = node->parent)
+	{
+		const CompoundSelector& node_selector = node->selector;
+		const int invalidation = Combine(node_invalidation, subject_invalidation);
+
+		for (Atom name : node_selector.class_atoms)
+			styled_node_index.class_invalidation[static_cast<std::size_t>(name)] |= invalidation;
+
+		for (Atom name : node_selector.pseudo_class_atoms)
+			styled_node_index.pseudo_class_invalidation[static_cast<std::size_t>(name)] |= invalidation;
+
+		for (const AttributeSelector& attribute : node_selector.attributes)
+			styled_node_index.attribute_invalidation[attribute.name] |= invalidation;
+
+		// The arguments of the negation selector are matched against the same element as this node.
+		for (const StructuralSelector& structural_selector : node_selector.structural_selectors)
+		{
+			if (structural_selector.type == StructuralSelectorType::Not && structural_selector.selector_tree)
+			{
+				for (const StyleSheetNode* leaf : structural_selector.selector_tree->leafs)
+					leaf->AddInvalidationSets(styled_node_index, invalidation);
+			}
+		}
+
+		// The element matched by our parent node is an ancestor of the subject, or a preceding sibling of the subject or one of its ancestors. The
+		// subject is thus a descendant of the element, or a subsequent sibling or a descendant thereof, as determined by our combinator.
+		const bool sibling_combinator =
+			(node_selector.combinator == SelectorCombinator::NextSibling || node_selector.combinator == SelectorCombinator::SubsequentSibling);
+		node_invalidation = (sibling_combinator ? StyleSheetIndex::InvalidateSiblings : StyleSheetIndex::InvalidateDescendants);
+	}
+}
+
 // Returns the specificity of this node.
 int StyleSheetNode::GetSpecificity() const
 {
@@ -185,21 +294,23 @@ const PropertyDictionary& StyleSheetNode::GetProperties() const
 
 bool StyleSheetNode::Match(const Element* element) const
 {
-	if (!selector.tag.empty() && selector.tag != element->GetTagName())
+	const ElementStyle* style = element->GetStyle();
+
+	if (selector.tag_atom != Atom::None && selector.tag_atom != style->GetTagAtom())
 		return false;
 
-	if (!selector.id.empty() && selector.id != element->GetId())
+	if (selector.id_atom != Atom::None && selector.id_atom != style->GetIdAtom())
 		return false;
 
-	for (auto& name : selector.class_names)
+	for (Atom name : selector.class_atoms)
 	{
-		if (!element->IsClassSet(name))
+		if (!style->IsClassSet(name))
 			return false;
 	}
 
-	for (auto& name : selector.pseudo_class_names)
+	for (Atom name : selector.pseudo_class_atoms)
 	{
-		if (!element->IsPseudoClassSet(name))
+		if (!style->IsPseudoClassSet(name))
 			return false;
 	}
 
@@ -352,22 +463,24 @@ bool StyleSheetNode::IsApplicable(const Element* element) const
 
 	// We could in principle just call Match() here and then go on with the ancestor style nodes. Instead, we test the requirements of this node in a
 	// particular order for performance reasons.
-	for (const String& name : selector.pseudo_class_names)
+	const ElementStyle* style = element->GetStyle();
+
+	for (Atom name : selector.pseudo_class_atoms)
 	{
-		if (!element->IsPseudoClassSet(name))
+		if (!style->IsPseudoClassSet(name))
 			return false;
 	}
 
-	if (!selector.tag.empty() && selector.tag != element->GetTagName())
+	if (selector.tag_atom != Atom::None && selector.tag_atom != style->GetTagAtom())
 		return false;
 
-	for (const String& name : selector.class_names)
+	for (Atom name : selector.class_atoms)
 	{
-		if (!element->IsClassSet(name))
+		if (!style->IsClassSet(name))
 			return false;
 	}
 
-	if (!selector.id.empty() && selector.id != element->GetId())
+	if (selector.id_atom != Atom::None && selector.id_atom != style->GetIdAtom())
 		return false;
 
 	if (!selector.attributes.empty() && !MatchAttributes(element))
@@ -407,4 +520,24 @@ void StyleSheetNode::CalculateAndSetSpecificity()
 		specificity += parent->specificity;
 }
 
+void StyleSheetNode::CalculateAndSetAncestorRequirements()
+{
+	if (!parent)
+		return;
+
+	// Any ancestor of the element matched by our parent node is also an ancestor of our element, regardless of the combinator. An element matched
+	// through a sibling combinator shares all of our ancestors.
+	ancestor_requirements = parent->ancestor_requirements;
+
+	// With the descendant or child combinators, the parent node itself must match one of our ancestors.
+	if (selector.combinator == SelectorCombinator::Descendant || selector.combinator == SelectorCombinator::Child)
+	{
+		const CompoundSelector& parent_selector = parent->selector;
+		ancestor_requirements.Add(parent_selector.tag_atom);
+		ancestor_requirements.Add(parent_selector.id_atom);
+		for (Atom name : parent_selector.class_atoms)
+			ancestor_requirements.Add(name);
+	}
+}
+
 } // namespace Rml
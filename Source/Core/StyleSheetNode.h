@@ -31,6 +31,7 @@
 
 #include "../../Include/RmlUi/Core/PropertyDictionary.h"
 #include "../../Include/RmlUi/Core/Types.h"
+#include "AncestorFilter.h"
 #include "StyleSheetSelector.h"
 
 namespace Rml {
@@ -79,8 +80,20 @@ public:
 	/// Returns the specificity of this node.
 	int GetSpecificity() const;
 
+	/// Returns the atoms required to be present on the ancestors of any element this node applies to.
+	/// @note Test this against the element's ancestor filter before calling IsApplicable() to cheaply rule out nodes.
+	const AncestorFilter& GetAncestorRequirements() const { return ancestor_requirements; }
+
 private:
 	void CalculateAndSetSpecificity();
+	void CalculateAndSetAncestorRequirements();
+
+	// Adds the requirements of this node and its ancestor nodes that may be matched differently by elements that are otherwise equivalent, see
+	// StyleSheet::IsMatchingEquivalent(). Returns true if any of the nodes depend on the position of elements among their siblings.
+	bool AddSharingRequirements(StyleSheetIndex& styled_node_index, bool index_sibling_dependent_nodes) const;
+	// Adds the classes, pseudo-classes, and attributes of this node and its ancestor nodes to the invalidation sets, together with the elements
+	// whose match they may affect. The subject invalidation are the elements affected through the subject of any enclosing selector, see :not().
+	void AddInvalidationSets(StyleSheetIndex& styled_node_index, int subject_invalidation) const;
 
 	// Match an element to the local node requirements.
 	inline bool Match(const Element* element) const;
@@ -99,6 +112,9 @@ private:
 	// A measure of specificity of this node; the attribute in a node with a higher value will override those of a node with a lower value.
 	int specificity = 0;
 
+	// The tags, ids, and classes of the nodes matched against ancestors of the element by descendant or child combinators.
+	AncestorFilter ancestor_requirements;
+
 	PropertyDictionary properties;
 
 	StyleSheetNodeList children;
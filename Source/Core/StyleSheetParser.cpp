@@ -1011,6 +1011,14 @@ StyleSheetNode* StyleSheetParser::ImportProperties(StyleSheetNode* node, const S
 		std::sort(selector.pseudo_class_names.begin(), selector.pseudo_class_names.end());
 		std::sort(selector.structural_selectors.begin(), selector.structural_selectors.end());
 
+		// Intern the names so that the selector can be matched against elements by comparing atoms.
+		selector.tag_atom = AtomTable::GetOrInsert(selector.tag);
+		selector.id_atom = AtomTable::GetOrInsert(selector.id);
+		for (const String& name : selector.class_names)
+			selector.class_atoms.push_back(AtomTable::GetOrInsert(name));
+		for (const String& name : selector.pseudo_class_names)
+			selector.pseudo_class_atoms.push_back(AtomTable::GetOrInsert(name));
+
 		// Add the new child node, or retrieve the existing child if we have an exact match.
 		leaf_node = leaf_node->GetOrCreateChildNode(std::move(selector));
 	}
@@ -30,6 +30,7 @@
 #define RMLUI_CORE_STYLESHEETSELECTOR_H
 
 #include "../../Include/RmlUi/Core/Types.h"
+#include "Atom.h"
 
 namespace Rml {
 
@@ -145,6 +146,12 @@ struct CompoundSelector {
 	AttributeSelectorList attributes;
 	StructuralSelectorList structural_selectors;
 	SelectorCombinator combinator = SelectorCombinator::Descendant; // Determines how to match with our parent node.
+
+	// Interned versions of the above names, used for matching. Derived from the names, thus not considered for equality.
+	Atom tag_atom = Atom::None;
+	Atom id_atom = Atom::None;
+	Vector<Atom> class_atoms;
+	Vector<Atom> pseudo_class_atoms;
 };
 bool operator==(const CompoundSelector& a, const CompoundSelector& b);
 
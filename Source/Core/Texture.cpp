@@ -38,10 +38,10 @@ void Texture::Set(const String& source, const String& source_path)
 	resource = TextureDatabase::Fetch(source, source_path);
 }
 
-void Texture::Set(const String& name, const TextureCallback& callback)
+void Texture::Set(const String& name, const TextureCallback& callback, bool distance_field)
 {
 	resource = MakeShared<TextureResource>();
-	resource->Set(name, callback);
+	resource->Set(name, callback, distance_field);
 }
 
 // Returns the texture's source name. This is usually the name of the file the texture was loaded from.
@@ -72,6 +72,30 @@ Vector2i Texture::GetDimensions(RenderInterface* render_interface) const
 	return resource->GetDimensions(render_interface);
 }
 
+bool Texture::Update(const Vector2i& region_origin, const Vector2i& region_dimensions, const byte* source, int source_stride)
+{
+	if (!resource)
+		return false;
+
+	return resource->Update(region_origin, region_dimensions, source, source_stride);
+}
+
+bool Texture::IsUpdateSupported(RenderInterface* render_interface) const
+{
+	if (!resource || !render_interface)
+		return false;
+
+	return resource->IsUpdateSupported(render_interface);
+}
+
+int Texture::GetVersion() const
+{
+	if (!resource)
+		return 0;
+
+	return resource->GetVersion();
+}
+
 bool Texture::operator==(const Texture& other) const
 {
 	return resource == other.resource;
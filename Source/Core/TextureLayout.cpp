@@ -30,6 +30,7 @@
 #include "TextureLayoutRectangle.h"
 #include "TextureLayoutTexture.h"
 #include <algorithm>
+#include <numeric>
 
 namespace Rml {
 
@@ -79,31 +80,107 @@ TextureLayoutTexture& TextureLayout::GetTexture(int index)
 	return textures[index];
 }
 
+const TextureLayoutTexture& TextureLayout::GetTexture(int index) const
+{
+	RMLUI_ASSERT(index >= 0);
+	RMLUI_ASSERT(index < GetNumTextures());
+
+	return textures[index];
+}
+
 // Returns the number of textures in the layout.
 int TextureLayout::GetNumTextures() const
 {
 	return (int) textures.size();
 }
 
-// Attempts to generate an efficient texture layout for the rectangles.
+// Attempts to generate an efficient texture layout for the rectangles added since the previous call.
 bool TextureLayout::GenerateLayout(int max_texture_dimensions)
 {
-	// Sort the rectangles by height.
-	std::sort(rectangles.begin(), rectangles.end(), RectangleSort());
+	// Sort the new rectangles by height. Rows refer to laid out rectangles by index, so these must not be moved.
+	std::sort(rectangles.begin() + num_laid_out_rectangles, rectangles.end(), RectangleSort());
 
-	int num_placed_rectangles = 0;
+	int num_placed_rectangles = num_laid_out_rectangles;
+
+	// Place the new rectangles into the free space of existing textures, growing the last texture as needed.
+	if (!textures.empty())
+	{
+		for (int i = num_laid_out_rectangles; i < GetNumRectangles(); i++)
+		{
+			// Don't grow the texture for rectangles which will never fit, including the padding around them.
+			const Vector2i dimensions = rectangles[i].GetDimensions();
+			if (Math::Max(dimensions.x, dimensions.y) + 2 > max_texture_dimensions)
+				continue;
+
+			bool placed = false;
+			for (int texture_index = 0; texture_index < GetNumTextures() && !placed; texture_index++)
+				placed = textures[texture_index].Place(*this, i, texture_index);
+
+			const int last_texture_index = GetNumTextures() - 1;
+			while (!placed && textures[last_texture_index].Grow(max_texture_dimensions))
+				placed = textures[last_texture_index].Place(*this, i, last_texture_index);
+
+			if (placed)
+				num_placed_rectangles += 1;
+		}
+	}
+
+	// Any remaining rectangles are placed on new textures.
 	while (num_placed_rectangles != GetNumRectangles())
 	{
 		TextureLayoutTexture texture;
 		int texture_size = texture.Generate(*this, max_texture_dimensions);
 		if (texture_size == 0)
+		{
+			// Keep the remaining rectangles pending, so that they are attempted again on the next call.
+			num_laid_out_rectangles = MoveUnplacedRectanglesLast();
 			return false;
+		}
 
 		textures.push_back(texture);
 		num_placed_rectangles += texture_size;
 	}
 
+	num_laid_out_rectangles = GetNumRectangles();
+
 	return true;
 }
 
+int TextureLayout::MoveUnplacedRectanglesLast()
+{
+	const int num_rectangles = GetNumRectangles();
+
+	// The new index of each rectangle, indexed by its current index.
+	Vector<int> new_indices(num_rectangles);
+	std::iota(new_indices.begin(), new_indices.end(), 0);
+
+	RectangleList unplaced_rectangles;
+	int num_placed = num_laid_out_rectangles;
+
+	for (int i = num_laid_out_rectangles; i < num_rectangles; i++)
+	{
+		if (rectangles[i].IsPlaced())
+		{
+			new_indices[i] = num_placed;
+			rectangles[num_placed++] = rectangles[i];
+		}
+		else
+			unplaced_rectangles.push_back(rectangles[i]);
+	}
+
+	std::copy(unplaced_rectangles.begin(), unplaced_rectangles.end(), rectangles.begin() + num_placed);
+
+	// Unplaced rectangles are not referenced by any rows, thus their new index is not needed.
+	for (TextureLayoutTexture& texture : textures)
+		texture.RemapRectangles(new_indices);
+
+	return num_placed;
+}
+
+// Returns the number of rectangles that have been laid out by a previous call to GenerateLayout().
+int TextureLayout::GetNumLaidOutRectangles() const
+{
+	return num_laid_out_rectangles;
+}
+
 } // namespace Rml
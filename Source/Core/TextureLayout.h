@@ -47,8 +47,8 @@ public:
 	TextureLayout();
 	~TextureLayout();
 
-	/// Adds a rectangle to the list of rectangles to be laid out. All rectangles must be added to
-	/// the layout before the layout is generated.
+	/// Adds a rectangle to the list of rectangles to be laid out. The rectangle is positioned on the
+	/// next call to GenerateLayout().
 	/// @param[in] id The id of the rectangle; used to identify the rectangle after it has been positioned.
 	/// @param[in] dimensions The dimensions of the rectangle.
 	void AddRectangle(int id, Vector2i dimensions);
@@ -65,21 +65,35 @@ public:
 	/// @param[in] index The index of the desired texture.
 	/// @return The desired texture.
 	TextureLayoutTexture& GetTexture(int index);
+	const TextureLayoutTexture& GetTexture(int index) const;
 	/// Returns the number of textures in the layout.
 	/// @return The layout's texture count.
 	int GetNumTextures() const;
 
-	/// Attempts to generate an efficient texture layout for the rectangles.
+	/// Attempts to generate an efficient texture layout for the rectangles added since the previous call.
+	/// Previously laid out rectangles keep their position. New rectangles are placed in the free space of
+	/// existing textures if possible, otherwise the last texture is grown, and finally new textures are added.
 	/// @param[in] max_texture_dimensions The maximum dimensions allowed for any single texture.
-	/// @return True if the layout was generated successfully, false if not.
+	/// @return True if the layout was generated successfully, false if any rectangles could not be placed.
+	/// @note Rectangles which could not be placed are moved behind the laid out rectangles, and are retried on the next call.
 	bool GenerateLayout(int max_texture_dimensions);
 
+	/// Returns the number of rectangles that have been laid out by a previous call to GenerateLayout().
+	/// These are located first in the layout, any following rectangles are still waiting to be placed.
+	int GetNumLaidOutRectangles() const;
+
 private:
+	// Moves the rectangles which could not be placed behind the newly placed ones, keeping the order otherwise.
+	// @return The number of placed rectangles.
+	int MoveUnplacedRectanglesLast();
+
 	using RectangleList = Vector< TextureLayoutRectangle >;
 	using TextureList = Vector< TextureLayoutTexture >;
 
 	TextureList textures;
 	RectangleList rectangles;
+
+	int num_laid_out_rectangles = 0;
 };
 
 } // namespace Rml
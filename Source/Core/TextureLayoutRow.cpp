@@ -31,9 +31,8 @@
 
 namespace Rml {
 
-TextureLayoutRow::TextureLayoutRow()
+TextureLayoutRow::TextureLayoutRow(int y, int height) : y(y), width(1), height(height)
 {
-	height = 0;
 }
 
 TextureLayoutRow::~TextureLayoutRow()
@@ -41,9 +40,10 @@ TextureLayoutRow::~TextureLayoutRow()
 }
 
 // Attempts to position unplaced rectangles from the layout into this row.
-int TextureLayoutRow::Generate(TextureLayout& layout, int max_width, int y)
+int TextureLayoutRow::Generate(TextureLayout& layout, int max_width, int _y)
 {
-	int width = 1;
+	y = _y;
+	width = 1;
 	int first_unplaced_index = 0;
 	int placed_rectangles = 0;
 
@@ -70,7 +70,7 @@ int TextureLayoutRow::Generate(TextureLayout& layout, int max_width, int y)
 		height = Math::Max(height, rectangle.GetDimensions().y);
 
 		// Add this glyph onto our list and mark it as placed.
-		rectangles.push_back(&rectangle);
+		rectangles.push_back(index);
 		rectangle.Place(layout.GetNumTextures(), Vector2i(width, y));
 		++placed_rectangles;
 
@@ -85,11 +85,29 @@ int TextureLayoutRow::Generate(TextureLayout& layout, int max_width, int y)
 	return placed_rectangles;
 }
 
+// Attempts to position a single rectangle at the end of this row.
+bool TextureLayoutRow::Place(TextureLayout& layout, int rectangle_index, int texture_index, int max_width)
+{
+	TextureLayoutRectangle& rectangle = layout.GetRectangle(rectangle_index);
+	const Vector2i dimensions = rectangle.GetDimensions();
+
+	if (dimensions.y > height || width + dimensions.x + 1 > max_width)
+		return false;
+
+	rectangles.push_back(rectangle_index);
+	rectangle.Place(texture_index, Vector2i(width, y));
+
+	if (dimensions.x > 0)
+		width += dimensions.x + 1;
+
+	return true;
+}
+
 // Assigns allocated texture data to all rectangles in this row.
-void TextureLayoutRow::Allocate(byte* texture_data, int stride)
+void TextureLayoutRow::Allocate(TextureLayout& layout, byte* texture_data, int stride)
 {
-	for (size_t i = 0; i < rectangles.size(); ++i)
-		rectangles[i]->Allocate(texture_data, stride);
+	for (int rectangle_index : rectangles)
+		layout.GetRectangle(rectangle_index).Allocate(texture_data, stride);
 }
 
 // Returns the height of the row.
@@ -99,10 +117,17 @@ int TextureLayoutRow::GetHeight() const
 }
 
 // Resets the placed status for all of the rectangles within this row.
-void TextureLayoutRow::Unplace()
+void TextureLayoutRow::Unplace(TextureLayout& layout)
+{
+	for (int rectangle_index : rectangles)
+		layout.GetRectangle(rectangle_index).Unplace();
+}
+
+// Updates the row's references to rectangles that have been moved within the layout.
+void TextureLayoutRow::RemapRectangles(const Vector<int>& new_indices)
 {
-	for (size_t i = 0; i < rectangles.size(); ++i)
-		rectangles[i]->Unplace();
+	for (int& rectangle_index : rectangles)
+		rectangle_index = new_indices[rectangle_index];
 }
 
 } // namespace Rml
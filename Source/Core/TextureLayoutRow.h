@@ -44,7 +44,7 @@ class TextureLayout;
 class TextureLayoutRow
 {
 public:
-	TextureLayoutRow();
+	TextureLayoutRow(int y = 0, int height = 0);
 	~TextureLayoutRow();
 
 	/// Attempts to position unplaced rectangles from the layout into this row.
@@ -54,23 +54,40 @@ public:
 	/// @return The number of placed rectangles.
 	int Generate(TextureLayout& layout, int width, int y);
 
+	/// Attempts to position a single rectangle at the end of this row, without increasing the row's height.
+	/// @param[in] layout The layout containing the rectangle.
+	/// @param[in] rectangle_index The index of the rectangle within the layout.
+	/// @param[in] texture_index The index of the texture this row is placed on.
+	/// @param[in] max_width The maximum width of this row.
+	/// @return True if the rectangle was placed, false if it did not fit.
+	bool Place(TextureLayout& layout, int rectangle_index, int texture_index, int max_width);
+
 	/// Assigns allocated texture data to all rectangles in this row.
+	/// @param[in] layout The layout containing the row's rectangles.
 	/// @param[in] texture_data The pointer to the beginning of the texture's data.
 	/// @param[in] stride The stride of the texture's surface, in bytes;
-	void Allocate(byte* texture_data, int stride);
+	void Allocate(TextureLayout& layout, byte* texture_data, int stride);
 
 	/// Returns the height of the row.
 	/// @return The row's height.
 	int GetHeight() const;
 
 	/// Resets the placed status for all of the rectangles within this row.
-	void Unplace();
+	/// @param[in] layout The layout containing the row's rectangles.
+	void Unplace(TextureLayout& layout);
+
+	/// Updates the row's references to rectangles that have been moved within the layout.
+	/// @param[in] new_indices The new index of each rectangle, indexed by its old index.
+	void RemapRectangles(const Vector<int>& new_indices);
 
 private:
-	using RectangleList = Vector< TextureLayoutRectangle* >;
+	// Rectangles are referred to by their index in the layout, as new rectangles may be added to the layout at any time.
+	using RectangleIndexList = Vector< int >;
 
+	int y;
+	int width;
 	int height;
-	RectangleList rectangles;
+	RectangleIndexList rectangles;
 };
 
 } // namespace Rml
@@ -32,7 +32,7 @@
 
 namespace Rml {
 
-TextureLayoutTexture::TextureLayoutTexture() : dimensions(0, 0)
+TextureLayoutTexture::TextureLayoutTexture() : dimensions(0, 0), rows_height(1)
 {}
 
 TextureLayoutTexture::~TextureLayoutTexture()
@@ -96,19 +96,21 @@ int TextureLayoutTexture::Generate(TextureLayout& layout, int maximum_dimensions
 				break;
 			}
 
-			height += row.GetHeight() + 1;
-			if (height > dimensions.y)
+			if (height + row.GetHeight() + 1 > dimensions.y)
 			{
 				// D'oh! We've exceeded our height boundaries. This row should be unplaced.
-				row.Unplace();
+				row.Unplace(layout);
 				success = false;
 				break;
 			}
 
+			height += row.GetHeight() + 1;
 			rows.push_back(row);
 			num_placed_rectangles += row_size;
 		}
 
+		rows_height = height;
+
 		// If the rectangles were successfully laid out within the texture limits, we're done.
 		if (success)
 			return num_placed_rectangles;
@@ -128,15 +130,69 @@ int TextureLayoutTexture::Generate(TextureLayout& layout, int maximum_dimensions
 
 		// Unplace all of the glyphs we tried to place and have an other crack.
 		for (size_t i = 0; i < rows.size(); i++)
-			rows[i].Unplace();
+			rows[i].Unplace(layout);
 
 		rows.clear();
+		rows_height = 1;
 		num_placed_rectangles = 0;
 	}
 }
 
+// Attempts to position a single rectangle in the remaining free space of this texture.
+bool TextureLayoutTexture::Place(TextureLayout& layout, int rectangle_index, int texture_index)
+{
+	// First try to fit the rectangle at the end of one of the existing rows.
+	for (TextureLayoutRow& row : rows)
+	{
+		if (row.Place(layout, rectangle_index, texture_index, dimensions.x))
+			return true;
+	}
+
+	// Otherwise, start a new row below the existing ones. Make the new row at least as tall as the tallest row so far, so that
+	// later rectangles (such as glyphs of the same font) are likely to fit in it as well.
+	const int rectangle_height = layout.GetRectangle(rectangle_index).GetDimensions().y;
+	int row_height = rectangle_height;
+	for (const TextureLayoutRow& row : rows)
+		row_height = Math::Max(row_height, row.GetHeight());
+
+	if (rows_height + row_height + 1 > dimensions.y)
+		row_height = rectangle_height;
+	if (rows_height + row_height + 1 > dimensions.y)
+		return false;
+
+	TextureLayoutRow row(rows_height, row_height);
+	if (!row.Place(layout, rectangle_index, texture_index, dimensions.x))
+		return false;
+
+	rows.push_back(std::move(row));
+	rows_height += row_height + 1;
+
+	return true;
+}
+
+// Increases the size of this texture to make room for more rectangles.
+bool TextureLayoutTexture::Grow(int maximum_dimensions)
+{
+	// Grow in the same manner as during generation, alternating between the horizontal and vertical dimension.
+	if (dimensions.y > dimensions.x)
+		dimensions.x = dimensions.y;
+	else if (dimensions.y << 1 <= maximum_dimensions)
+		dimensions.y <<= 1;
+	else
+		return false;
+
+	return true;
+}
+
+// Updates the references to rectangles that have been moved within the layout.
+void TextureLayoutTexture::RemapRectangles(const Vector<int>& new_indices)
+{
+	for (TextureLayoutRow& row : rows)
+		row.RemapRectangles(new_indices);
+}
+
 // Allocates the texture.
-UniquePtr<byte[]> TextureLayoutTexture::AllocateTexture()
+UniquePtr<byte[]> TextureLayoutTexture::AllocateTexture(TextureLayout& layout)
 {
 	// Note: this object does not free this texture data. It is freed in the font texture loader.
 	UniquePtr<byte[]> texture_data;
@@ -151,7 +207,7 @@ UniquePtr<byte[]> TextureLayoutTexture::AllocateTexture()
 			((unsigned int*)(texture_data.get()))[i] = 0x00ffffff;
 
 		for (size_t i = 0; i < rows.size(); ++i)
-			rows[i].Allocate(texture_data.get(), dimensions.x * 4);
+			rows[i].Allocate(layout, texture_data.get(), dimensions.x * 4);
 	}
 
 	return texture_data;
@@ -61,14 +61,33 @@ public:
 	/// @return The number of placed rectangles.
 	int Generate(TextureLayout& layout, int maximum_dimensions);
 
+	/// Attempts to position a single rectangle in the remaining free space of this texture, leaving the existing rectangles in place.
+	/// @param[in] layout The layout containing the rectangle.
+	/// @param[in] rectangle_index The index of the rectangle within the layout.
+	/// @param[in] texture_index The index of this texture within the layout.
+	/// @return True if the rectangle was placed, false if there is not enough free space.
+	bool Place(TextureLayout& layout, int rectangle_index, int texture_index);
+
+	/// Increases the size of this texture to make room for more rectangles. Placed rectangles keep their pixel position.
+	/// @param[in] maximum_dimensions The maximum dimensions of this texture.
+	/// @return True if the texture was resized, false if it is already at its maximum size.
+	bool Grow(int maximum_dimensions);
+
+	/// Updates the references to rectangles that have been moved within the layout.
+	/// @param[in] new_indices The new index of each rectangle, indexed by its old index.
+	void RemapRectangles(const Vector<int>& new_indices);
+
 	/// Allocates the texture.
+	/// @param[in] layout The layout containing this texture's rectangles.
 	/// @return The allocated texture data.
-	UniquePtr<byte[]> AllocateTexture();
+	UniquePtr<byte[]> AllocateTexture(TextureLayout& layout);
 
 private:
 	using RowList = Vector< TextureLayoutRow >;
 
 	Vector2i dimensions;
+	// The height occupied by the rows, new rows are added below this offset.
+	int rows_height;
 	RowList rows;
 };
 
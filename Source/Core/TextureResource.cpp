@@ -49,11 +49,12 @@ void TextureResource::Set(const String& _source)
 	source = _source;
 }
 
-void TextureResource::Set(const String& name, const TextureCallback& callback)
+void TextureResource::Set(const String& name, const TextureCallback& callback, bool _distance_field)
 {
 	Reset();
 	source = name;
 	texture_callback = MakeUnique<TextureCallback>(callback);
+	distance_field = _distance_field;
 	TextureDatabase::AddCallbackTexture(this);
 }
 
@@ -68,6 +69,7 @@ void TextureResource::Reset()
 	}
 
 	source.clear();
+	distance_field = false;
 }
 
 // Returns the resource's underlying texture.
@@ -130,6 +132,45 @@ void TextureResource::Release(RenderInterface* render_interface)
 	}
 }
 
+bool TextureResource::Update(const Vector2i& region_origin, const Vector2i& region_dimensions, const byte* source, int source_stride)
+{
+	bool result = true;
+	version += 1;
+
+	for (auto it = texture_data.begin(); it != texture_data.end();)
+	{
+		RenderInterface* render_interface = it->first;
+		const TextureHandle handle = it->second.first;
+
+		if (handle && IsUpdateSupported(render_interface))
+		{
+			if (render_interface->UpdateTexture(handle, region_origin, region_dimensions, source, source_stride))
+			{
+				++it;
+				continue;
+			}
+
+			// Remember the failure, so that users can generate the texture anew directly instead of preparing data for an update.
+			render_interface->texture_update_failed = true;
+		}
+
+		// Partial updates are not supported, release the texture so that it is loaded anew on next use.
+		if (handle)
+			render_interface->ReleaseTexture(handle);
+
+		it = texture_data.erase(it);
+		result = false;
+	}
+
+	return result;
+}
+
+bool TextureResource::IsUpdateSupported(RenderInterface* render_interface) const
+{
+	// Distance fields may have been converted when generated, thus new data can not be uploaded as is.
+	return !distance_field && !render_interface->texture_update_failed;
+}
+
 bool TextureResource::Load(RenderInterface* render_interface)
 {
 	RMLUI_ZoneScoped;
@@ -151,7 +192,8 @@ bool TextureResource::Load(RenderInterface* render_interface)
 		}
 
 		TextureHandle handle;
-		bool success = render_interface->GenerateTexture(handle, data.get(), dimensions);
+		bool success = (distance_field ? render_interface->GenerateDistanceFieldTexture(handle, data.get(), dimensions)
+									   : render_interface->GenerateTexture(handle, data.get(), dimensions));
 
 		if (success)
 		{
@@ -52,7 +52,8 @@ public:
 
 	/// Clear any existing data and set a callback function for loading the data.
 	/// Texture loading is delayed until the texture is accessed by a specific render interface.
-	void Set(const String& name, const TextureCallback& callback);
+	/// @param[in] distance_field True to generate the texture as a distance field texture.
+	void Set(const String& name, const TextureCallback& callback, bool distance_field);
 
 	/// Returns the resource's underlying texture handle.
 	TextureHandle GetHandle(RenderInterface* render_interface);
@@ -65,6 +66,13 @@ public:
 	/// Releases the texture's handle.
 	void Release(RenderInterface* render_interface = nullptr);
 
+	/// Replaces a region of the texture for each render interface it has been generated for, see Texture::Update().
+	bool Update(const Vector2i& region_origin, const Vector2i& region_dimensions, const byte* source, int source_stride);
+	/// Returns false if the texture can not be updated in place for the given render interface, see Texture::IsUpdateSupported().
+	bool IsUpdateSupported(RenderInterface* render_interface) const;
+	/// Returns the number of times the texture has been updated, see Texture::GetVersion().
+	int GetVersion() const { return version; }
+
 	/// For debugging. Returns true if the texture holds a reference to the given render interface, otherwise false.
 	inline bool HoldsRenderInterface(RenderInterface* render_interface) const { return texture_data.count(render_interface); }
 
@@ -81,6 +89,9 @@ private:
 	TextureDataMap texture_data;
 
 	UniquePtr<TextureCallback> texture_callback;
+	bool distance_field = false;
+
+	int version = 0;
 };
 
 } // namespace Rml
@@ -28,6 +28,7 @@
 
 #include "Geometry.h"
 #include "../../Include/RmlUi/Core/Context.h"
+#include "../../Include/RmlUi/Core/Geometry.h"
 #include "../../Include/RmlUi/Core/GeometryUtilities.h"
 #include "../../Include/RmlUi/Core/RenderInterface.h"
 
@@ -36,6 +37,21 @@ namespace Debugger {
 
 static Context* context;
 
+static void RenderGeometry(RenderInterface* render_interface, Vertex* vertices, int num_vertices, int* indices, int num_indices, Vector2f origin)
+{
+	// With render batching, the geometry must be submitted through the context to be drawn in order with the rest of the frame.
+	if (context->IsRenderBatchingEnabled())
+	{
+		Rml::Geometry geometry(context);
+		geometry.GetVertices().assign(vertices, vertices + num_vertices);
+		geometry.GetIndices().assign(indices, indices + num_indices);
+		geometry.Render(origin);
+		return;
+	}
+
+	render_interface->RenderGeometry(vertices, num_vertices, indices, num_indices, 0, origin);
+}
+
 Geometry::Geometry()
 {
 }
@@ -61,7 +77,7 @@ void Geometry::RenderOutline(const Vector2f origin, const Vector2f dimensions, c
 	GeometryUtilities::GenerateQuad(vertices + 8, indices + 12, Vector2f(0, 0), Vector2f(width, dimensions.y), colour, 8);
 	GeometryUtilities::GenerateQuad(vertices + 12, indices + 18, Vector2f(dimensions.x - width, 0), Vector2f(width, dimensions.y), colour, 12);
 
-	render_interface->RenderGeometry(vertices, 4 * 4, indices, 6 * 4, 0, origin);
+	RenderGeometry(render_interface, vertices, 4 * 4, indices, 6 * 4, origin);
 }
 
 // Renders a box.
@@ -77,7 +93,7 @@ void Geometry::RenderBox(const Vector2f origin, const Vector2f dimensions, const
 
 	GeometryUtilities::GenerateQuad(vertices, indices, Vector2f(0, 0), Vector2f(dimensions.x, dimensions.y), colour, 0);
 
-	render_interface->RenderGeometry(vertices, 4, indices, 6, 0, origin);
+	RenderGeometry(render_interface, vertices, 4, indices, 6, origin);
 }
 
 // Renders a box with a hole in the middle.
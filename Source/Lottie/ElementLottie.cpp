@@ -199,45 +199,63 @@ void ElementLottie::UpdateTexture()
 		return;
 	}
 
-	// Callback for generating texture.
-	auto p_callback = [this, next_frame](const String& /*name*/, UniquePtr<const byte[]>& data, Vector2i& dimensions) -> bool {
-		RMLUI_ASSERT(animation);
+	prev_animation_frame = next_frame;
 
-		const size_t bytes_per_line = 4 * render_dimensions.x;
-		const size_t total_bytes = bytes_per_line * render_dimensions.y;
+	if (texture && !texture_size_dirty && texture.IsUpdateSupported(GetRenderInterface()))
+	{
+		// Upload the new frame into the existing texture. Render interfaces which do not support this release the texture instead, in
+		// which case it is regenerated from its callback, which always renders the latest frame. Afterwards, the texture is set anew
+		// directly so that each frame is only rendered once.
+		UniquePtr<byte[]> data = GenerateTextureData();
+		if (texture.Update(Vector2i(0, 0), render_dimensions, data.get(), 4 * render_dimensions.x) && geometry.GetTexture() == &texture)
+			return;
+	}
+	else
+	{
+		// Callback for generating texture.
+		auto p_callback = [this](const String& /*name*/, UniquePtr<const byte[]>& data, Vector2i& dimensions) -> bool {
+			data = GenerateTextureData();
+			dimensions = render_dimensions;
+			return true;
+		};
+
+		texture.Set("lottie", p_callback);
+	}
 
-		byte* p_data = new byte[total_bytes];
+	geometry.SetTexture(&texture);
+	texture_size_dirty = false;
+}
 
-		rlottie::Surface surface(reinterpret_cast<std::uint32_t*>(p_data), render_dimensions.x, render_dimensions.y, bytes_per_line);
-		animation->renderSync(next_frame, surface);
+UniquePtr<byte[]> ElementLottie::GenerateTextureData()
+{
+	RMLUI_ASSERT(animation);
 
-		// Swizzle the channel order from rlottie's BGRA to RmlUi's RGBA, and change pre-multiplied to post-multiplied alpha.
-		for (size_t i = 0; i < total_bytes; i += 4)
-		{
-			// Swap the RB order for correct color channels.
-			std::swap(p_data[i], p_data[i + 2]);
-
-			const byte a = p_data[i + 3];
-
-			// The RmlUi samples shell uses post-multiplied alpha, while rlottie serves pre-multiplied alpha.
-			// Here, we un-premultiply the colors.
-			if (a > 0 && a < 255)
-			{
-				for (size_t j = 0; j < 3; j++)
-					p_data[i + j] = (p_data[i + j] * 255) / a;
-			}
-		}
+	const size_t bytes_per_line = 4 * render_dimensions.x;
+	const size_t total_bytes = bytes_per_line * render_dimensions.y;
 
-		data.reset(p_data);
-		dimensions = render_dimensions;
+	byte* p_data = new byte[total_bytes];
 
-		return true;
-	};
+	rlottie::Surface surface(reinterpret_cast<std::uint32_t*>(p_data), render_dimensions.x, render_dimensions.y, bytes_per_line);
+	animation->renderSync(prev_animation_frame, surface);
 
-	texture.Set("lottie", p_callback);
-	geometry.SetTexture(&texture);
-	prev_animation_frame = next_frame;
-	texture_size_dirty = false;
+	// Swizzle the channel order from rlottie's BGRA to RmlUi's RGBA, and change pre-multiplied to post-multiplied alpha.
+	for (size_t i = 0; i < total_bytes; i += 4)
+	{
+		// Swap the RB order for correct color channels.
+		std::swap(p_data[i], p_data[i + 2]);
+
+		const byte a = p_data[i + 3];
+
+		// The RmlUi samples shell uses post-multiplied alpha, while rlottie serves pre-multiplied alpha.
+		// Here, we un-premultiply the colors.
+		if (a > 0 && a < 255)
+		{
+			for (size_t j = 0; j < 3; j++)
+				p_data[i + j] = (p_data[i + j] * 255) / a;
+		}
+	}
+
+	return UniquePtr<byte[]>(p_data);
 }
 
 } // namespace Rml
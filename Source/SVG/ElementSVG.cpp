@@ -196,24 +196,43 @@ void ElementSVG::UpdateTexture()
 	if (!svg_document || !texture_dirty)
 		return;
 
-	// Callback for generating texture.
-	auto p_callback = [this](const String& /*name*/, UniquePtr<const byte[]>& data, Vector2i& dimensions) -> bool {
-		RMLUI_ASSERT(svg_document);
+	if (texture && render_dimensions == texture_dimensions && texture.IsUpdateSupported(GetRenderInterface()))
+	{
+		// Upload the new image into the existing texture. Render interfaces which do not support this release the texture instead, in
+		// which case it is regenerated from the callback, which always renders the current document. Afterwards, the texture is set
+		// anew directly so that the document is only rendered once.
+		UniquePtr<byte[]> data = GenerateTextureData();
+		texture.Update(Vector2i(0, 0), render_dimensions, data.get(), 4 * render_dimensions.x);
+	}
+	else
+	{
+		// Callback for generating texture.
+		auto p_callback = [this](const String& /*name*/, UniquePtr<const byte[]>& data, Vector2i& dimensions) -> bool {
+			data = GenerateTextureData();
+			dimensions = render_dimensions;
+			return true;
+		};
+
+		texture.Set("svg", p_callback);
+		texture_dimensions = render_dimensions;
+	}
+
+	geometry.SetTexture(&texture);
+	texture_dirty = false;
+}
 
-		const size_t total_bytes = 4 * render_dimensions.x * render_dimensions.y;
+UniquePtr<byte[]> ElementSVG::GenerateTextureData()
+{
+	RMLUI_ASSERT(svg_document);
 
-		lunasvg::Bitmap bitmap = svg_document->renderToBitmap(render_dimensions.x, render_dimensions.y);
+	const size_t total_bytes = 4 * render_dimensions.x * render_dimensions.y;
 
-		data.reset(new byte[total_bytes]);
-		memcpy((void*)data.get(), bitmap.data(), total_bytes);
-		dimensions = render_dimensions;
+	lunasvg::Bitmap bitmap = svg_document->renderToBitmap(render_dimensions.x, render_dimensions.y);
 
-		return true;
-	};
+	UniquePtr<byte[]> data(new byte[total_bytes]);
+	memcpy((void*)data.get(), bitmap.data(), total_bytes);
 
-	texture.Set("svg", p_callback);
-	geometry.SetTexture(&texture);
-	texture_dirty = false;
+	return data;
 }
 
 } // namespace Rml
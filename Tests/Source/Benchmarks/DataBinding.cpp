@@ -83,6 +83,18 @@ static const String document_rml = R"(
 <p><span data-for="arrays.b">{{ it }} </span></p>
 <p><span data-for="arrays.c">{{ it.val }} </span></p>
 <p><span data-for="arrays.d">{{ 'a: ' + it.a + ', b: ' + it.b + ', c: ' + it.c.val + ' :: ' }}</span></p>
+
+<h1>Leaderboard</h1>
+<div class="entry" data-for="entry : leaderboard">
+	<span class="name">{{ entry.name }}</span>
+	<span class="score" data-class-high="entry.score > 500">{{ entry.score }}</span>
+</div>
+
+<h1>Lobby</h1>
+<div class="entry" data-for="entry : lobby" data-key="entry.id">
+	<span class="name">{{ entry.name }}</span>
+	<span class="score" data-class-high="entry.score > 500">{{ entry.score }}</span>
+</div>
 </div>
 </body>
 </rml>
@@ -113,8 +125,16 @@ struct Arrays {
 	Vector<Basic> d = {Basic{10}, Basic{20}, Basic{30}};
 };
 
+struct LeaderboardEntry {
+	int id;
+	String name;
+	int score;
+};
+
 static UniquePtr<Basic> basic;
 static UniquePtr<Arrays> arrays;
+static Vector<LeaderboardEntry> leaderboard;
+static Vector<LeaderboardEntry> lobby;
 
 static DataModelHandle InitializeDataBindings(Context* context)
 {
@@ -154,6 +174,16 @@ static DataModelHandle InitializeDataBindings(Context* context)
 	arrays = MakeUnique<Arrays>();
 	constructor.Bind("arrays", arrays.get());
 
+	if (auto handle = constructor.RegisterStruct<LeaderboardEntry>())
+	{
+		handle.RegisterMember("id", &LeaderboardEntry::id);
+		handle.RegisterMember("name", &LeaderboardEntry::name);
+		handle.RegisterMember("score", &LeaderboardEntry::score);
+	}
+	constructor.RegisterArray<decltype(leaderboard)>();
+	constructor.Bind("leaderboard", &leaderboard);
+	constructor.Bind("lobby", &lobby);
+
 	DataModelHandle model_handle = constructor.GetModelHandle();
 
 	return model_handle;
@@ -239,6 +269,65 @@ TEST_CASE("data_binding")
 		});
 	}
 
+	SUBCASE("for")
+	{
+		nanobench::Rng rng;
+		nanobench::Bench bench;
+		bench.title("Data bindings: For");
+		bench.relative(true);
+
+		for (int num_entries : {100, 2000})
+		{
+			bench.run(CreateString(64, "Populate leaderboard (%d)", num_entries), [&] {
+				leaderboard.resize(num_entries);
+				for (LeaderboardEntry& entry : leaderboard)
+					entry = LeaderboardEntry{0, "Player", (int)rng.bounded(1000)};
+				model_handle.DirtyVariable("leaderboard");
+				context->Update();
+
+				leaderboard.clear();
+				model_handle.DirtyVariable("leaderboard");
+				context->Update();
+			});
+		}
+	}
+
+	SUBCASE("for_key")
+	{
+		for (int i = 0; i < 1000; i++)
+		{
+			leaderboard.push_back(LeaderboardEntry{i, CreateString(32, "Player %d", i), i});
+			lobby.push_back(LeaderboardEntry{i, CreateString(32, "Player %d", i), i});
+		}
+		model_handle.DirtyVariable("leaderboard");
+		model_handle.DirtyVariable("lobby");
+		context->Update();
+
+		nanobench::Bench bench;
+		bench.title("Data bindings: For key");
+		bench.relative(true);
+
+		bench.run("Move last to front (index)", [&] {
+			std::rotate(leaderboard.begin(), leaderboard.end() - 1, leaderboard.end());
+			model_handle.DirtyVariable("leaderboard");
+			context->Update();
+			context->Render();
+		});
+
+		bench.run("Move last to front (key)", [&] {
+			std::rotate(lobby.begin(), lobby.end() - 1, lobby.end());
+			model_handle.DirtyVariable("lobby");
+			context->Update();
+			context->Render();
+		});
+
+		leaderboard.clear();
+		lobby.clear();
+		model_handle.DirtyVariable("leaderboard");
+		model_handle.DirtyVariable("lobby");
+		context->Update();
+	}
+
 	TestsShell::RenderLoop();
 
 	document->Close();
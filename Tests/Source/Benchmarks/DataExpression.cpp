@@ -56,71 +56,50 @@ TEST_CASE("data_expressions")
 
 	nanobench::Bench bench;
 	bench.title("Data expression");
+	bench.unit("evaluation");
 	bench.relative(true);
 
-	auto bench_expression = [&](const String& expression, const char* parse_name, const char* execute_name) {
+	// Benchmarks parsing, and execution of the program both as parsed and after optimization, reporting evaluations per second.
+	auto bench_program = [&](const String& expression, const String& name, bool is_assignment_expression) {
 		DataParser parser(expression, interface);
 
 		bool result = true;
-		bench.run(parse_name, [&] {
-			result &= parser.Parse(false);
-			});
+		bench.run(name + " (parse)", [&] {
+			result &= parser.Parse(is_assignment_expression);
+		});
 
 		REQUIRE(result);
 
 		Program program = parser.ReleaseProgram();
 		AddressList addresses = parser.ReleaseAddresses();
-		DataInterpreter interpreter(program, addresses, interface);
+		VariableList no_variables;
+		DataInterpreter interpreter(program, addresses, no_variables, interface);
 
-		bench.run(execute_name, [&] {
+		bench.run(name + " (execute, unoptimized)", [&] {
 			result &= interpreter.Run();
 		});
 
 		REQUIRE(result);
-	};
 
-	bench_expression(
-		"2 * 2",
-		"Simple (parse)",
-		"Simple (execute)"
-	);
-
-	bench_expression(
-		"true || false ? true && radius==1+2 ? 'Absolutely!' : color_value : 'no'",
-		"Complex (parse)",
-		"Complex (execute)"
-	);
-
-	auto bench_assignment = [&](const String& expression, const char* parse_name, const char* execute_name) {
-		DataParser parser(expression, interface); 
-		
-		bool result = true;
-		bench.run(parse_name, [&] {
-			result &= parser.Parse(true);
-			});
+		Program optimized_program = program;
+		OptimizeProgram(optimized_program);
+		VariableList variables = ResolveVariables(addresses, interface);
+		DataInterpreter optimized_interpreter(optimized_program, addresses, variables, interface);
 
-		REQUIRE(result);
-
-		Program program = parser.ReleaseProgram();
-		AddressList addresses = parser.ReleaseAddresses();
-		DataInterpreter interpreter(program, addresses, interface);
-
-		bench.run(execute_name, [&] {
-			result &= interpreter.Run();
+		bench.run(name + " (execute)", [&] {
+			result &= optimized_interpreter.Run();
 		});
 
 		REQUIRE(result);
 	};
 
-	bench_assignment(
-		"radius = 15",
-		"Simple assign (parse)",
-		"Simple assign (execute)"
-	);
-
-	bench_assignment(
-		"radius = radius*radius*3.14; color_name = 'image-color'",
-		"Complex assign (parse)",
-		"Complex assign (execute)"
-	);
+	bench_program("2 * 2", "Simple", false);
+
+	bench_program("true || false ? true && radius==1+2 ? 'Absolutely!' : color_value : 'no'", "Complex", false);
+
+	bench_program("radius * 2 + 3 > 10 && radius < 100 ? radius * 3.14 : 0", "Numeric", false);
+
+	bench_program("radius = 15", "Simple assign", true);
+
+	bench_program("radius = radius*radius*3.14; color_name = 'image-color'", "Complex assign", true);
 }
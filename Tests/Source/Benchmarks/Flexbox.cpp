@@ -338,6 +338,43 @@ overflow: visible
 </div>
 )";
 
+static const String rml_flexbox_nested_document = R"(
+<rml>
+<head>
+    <title>Flex 04 - Nested flexboxes</title>
+    <link type="text/rcss" href="/../Tests/Data/style.rcss"/>
+	<style>
+		.row, .column {
+			display: flex;
+			padding: 2dp;
+			border: 1dp #333;
+		}
+		.row { flex-direction: row; }
+		.column { flex-direction: column; }
+		.item {
+			flex: 1 1 auto;
+			padding: 2dp;
+			background-color: #eee;
+		}
+		#sibling { height: 10px; }
+	</style>
+</head>
+<body>
+</body>
+</rml>
+)";
+
+// Generates flexboxes nested to the given depth, with their directions alternating. Each flexbox contains a content-sized item and an item
+// wrapping the next flexbox, so that the number of elements only grows linearly with the depth.
+static String GenerateNestedFlexbox(int depth)
+{
+	if (depth <= 0)
+		return "Leaf";
+
+	return CreateString(96, "<div class=\"%s\"><div class=\"item\">Item %d</div><div class=\"item\">", depth % 2 == 0 ? "row" : "column", depth) +
+		GenerateNestedFlexbox(depth - 1) + "</div></div>";
+}
+
 TEST_CASE("flexbox")
 {
 	Context* context = TestsShell::GetContext();
@@ -490,4 +527,38 @@ TEST_CASE("flexbox")
 
 		document->Close();
 	}
+
+	{
+		nanobench::Bench bench;
+		bench.title("Flexbox nested");
+		bench.relative(true);
+
+		ElementDocument* document = context->LoadDocumentFromMemory(rml_flexbox_nested_document);
+		REQUIRE(document);
+		document->Show();
+
+		for (int depth : {2, 4, 6, 8})
+		{
+			const String rml = "<div id=\"sibling\"/>" + GenerateNestedFlexbox(depth);
+			document->SetInnerRML(rml);
+			TestsShell::RenderLoop();
+
+			bench.run(CreateString(64, "SetInnerRML + Update (depth %d)", depth), [&] {
+				document->SetInnerRML(rml);
+				context->Update();
+			});
+
+			// Changing the sibling forces the document to be formatted, while the nested flexboxes stay unchanged.
+			Element* sibling = document->GetElementById("sibling");
+			REQUIRE(sibling);
+			bool tall = false;
+			bench.run(CreateString(64, "Resize sibling + Update (depth %d)", depth), [&] {
+				tall = !tall;
+				sibling->SetProperty(PropertyId::Height, Property(tall ? 20.f : 10.f, Property::PX));
+				context->Update();
+			});
+		}
+
+		document->Close();
+	}
 }
@@ -44,7 +44,7 @@ static const String rml_font_effect_document = R"(
     <link type="text/rcss" href="/../Tests/Data/style.rcss"/>
 	<style>
 		body {
-			font-size: 25px;
+			font-size: %dpx;
 			font-effect: %s(%dpx #ff6);
 		}
 	</style>
@@ -68,7 +68,8 @@ TEST_CASE("font_effect")
 	{
 		constexpr int effect_size = 8;
 
-		const String rml_document = CreateString(rml_font_effect_document.size() + 100, rml_font_effect_document.c_str(), effect_name, effect_size);
+		const String rml_document =
+			CreateString(rml_font_effect_document.size() + 100, rml_font_effect_document.c_str(), 25, effect_name, effect_size);
 
 		ElementDocument* document = context->LoadDocumentFromMemory(rml_document);
 		document->Show();
@@ -80,8 +81,49 @@ TEST_CASE("font_effect")
 			context->Render();
 		});
 
+		// Measures the time spent on the calling thread, effect textures are generated in the background and rendered once ready.
+		Rml::SetFontEngineWorkerThreads(2);
+		bench.run(CreateString(64, "%s (worker threads)", effect_name), [&]() {
+			Rml::ReleaseFontResources();
+			context->Render();
+		});
+		Rml::SetFontEngineWorkerThreads(0);
+
 		document->Close();
 	}
+}
+
+TEST_CASE("font_effect.radius")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	nanobench::Bench bench;
+	bench.title("Font effect radius");
+	bench.relative(true);
+
+	for (const char* effect_name : {"blur", "glow", "outline"})
+	{
+		for (int effect_size : {2, 8, 16})
+		{
+			constexpr int font_size = 64;
+
+			const String rml_document =
+				CreateString(rml_font_effect_document.size() + 100, rml_font_effect_document.c_str(), font_size, effect_name, effect_size);
+
+			ElementDocument* document = context->LoadDocumentFromMemory(rml_document);
+			document->Show();
+			context->Update();
+			context->Render();
+
+			bench.run(CreateString(64, "%s %dpx", effect_name, effect_size), [&]() {
+				Rml::ReleaseFontResources();
+				context->Render();
+			});
+
+			document->Close();
+		}
+	}
 
 	TestsShell::ShutdownShell();
 }
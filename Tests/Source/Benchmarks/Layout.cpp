@@ -0,0 +1,127 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "../Common/TestsShell.h"
+#include <RmlUi/Core/Context.h>
+#include <RmlUi/Core/Element.h>
+#include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/Types.h>
+
+#include <doctest.h>
+#include <nanobench.h>
+
+using namespace ankerl;
+using namespace Rml;
+
+static const String rml_layout_document = R"(
+<rml>
+<head>
+	<title>Layout</title>
+	<link type="text/rcss" href="/../Tests/Data/style.rcss"/>
+	<style>
+		body {
+			overflow-y: auto;
+		}
+		.panel {
+			margin: 5px;
+			padding: 5px;
+			border: 1px #666;
+		}
+		.panel.boundary {
+			position: relative;
+			height: 120px;
+			overflow: auto;
+		}
+		.row {
+			height: 20px;
+		}
+		.row.expanded {
+			height: 40px;
+		}
+	</style>
+</head>
+<body>
+</body>
+</rml>
+)";
+
+static String GenerateLayoutPanels(int num_panels, const char* panel_class)
+{
+	String rml;
+	for (int i = 0; i < num_panels; i++)
+	{
+		rml += CreateString(64, "<div class=\"panel %s\">", panel_class);
+		for (int j = 0; j < 5; j++)
+			rml += CreateString(64, "<div class=\"row\">Panel %d, row %d</div>", i, j);
+		rml += "</div>";
+	}
+	return rml;
+}
+
+TEST_CASE("layout_incremental")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(rml_layout_document);
+	REQUIRE(document);
+	document->Show();
+
+	constexpr int num_panels = 400;
+
+	nanobench::Bench bench;
+	bench.title("Layout incremental");
+	bench.relative(true);
+
+	// Mutate a single element on a large document, with and without the element being contained in a layout boundary. Only the contents of the
+	// nearest layout boundary need to be formatted, in contrast to the whole document otherwise.
+	for (const char* panel_class : {"", "boundary"})
+	{
+		document->SetInnerRML(GenerateLayoutPanels(num_panels, panel_class));
+		TestsShell::RenderLoop();
+
+		Element* row = document->GetChild(num_panels / 2)->GetChild(2);
+		REQUIRE(row);
+
+		bench.run(CreateString(128, "Toggle class + Update (%s)", *panel_class ? panel_class : "document"), [&] {
+			row->SetClass("expanded", !row->IsClassSet("expanded"));
+			context->Update();
+		});
+
+		bench.run(CreateString(128, "Append child + Update (%s)", *panel_class ? panel_class : "document"), [&] {
+			Element* parent = row->GetParentNode();
+			if (parent->GetNumChildren() > 8)
+				parent->RemoveChild(parent->GetLastChild());
+			else
+				parent->AppendChild(document->CreateElement("div"));
+			context->Update();
+		});
+	}
+
+	document->Close();
+}
@@ -30,6 +30,7 @@
 #include <RmlUi/Core/Context.h>
 #include <RmlUi/Core/Element.h>
 #include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/StyleSheet.h>
 #include <RmlUi/Core/Types.h>
 #include <doctest.h>
 #include <nanobench.h>
@@ -90,6 +91,17 @@ static int GetNumDescendentElements(Element* element)
 	return result;
 }
 
+static void GetDescendentElements(Element* element, Vector<Element*>& out_elements)
+{
+	const int num_children = element->GetNumChildren(true);
+	for (int i = 0; i < num_children; i++)
+	{
+		Element* child = element->GetChild(i);
+		out_elements.push_back(child);
+		GetDescendentElements(child, out_elements);
+	}
+}
+
 static constexpr int num_rule_iterations = 10;
 
 enum SelectorFlags {
@@ -294,3 +306,80 @@ TEST_CASE("Selectors")
 		context->Update();
 	}
 }
+
+TEST_CASE("Selectors.Definition")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	constexpr int num_rows = 50;
+	const String rml = GenerateRml(num_rows);
+
+	// Benchmark only the lookup of applicable style rules, by fetching the element definition of every descendent element directly. This
+	// isolates the selector matching from the rest of the element update.
+
+	nanobench::Bench bench;
+	bench.title("Selector definition lookup (rule name)");
+	bench.timeUnit(std::chrono::microseconds(1), "us");
+	bench.relative(true);
+
+	// Rules with descendant and child combinators, where the rightmost selector matches most elements. Only the ancestors can rule them out.
+	const Vector<String> ancestor_selector_templates = {
+		".%s div",
+		"#%s div",
+		"div.%s > div",
+		".%s .col",
+		"div.%s div div",
+	};
+
+	auto GenerateAncestorRCSS = [](const String& selector_template, String& out_rule_name) {
+		String result;
+		for (int i = 0; i < num_rule_iterations; i++)
+		{
+			for (char c = 'a'; c <= 'z'; c++)
+			{
+				const String name(i, c);
+				result += CreateString(128, selector_template.c_str(), name.c_str());
+				result += CreateString(64, " { scrollbar-margin: %dpx; }\n", int(c - 'a') + 1);
+			}
+		}
+		out_rule_name = CreateString(128, selector_template.c_str(), "a");
+		return result;
+	};
+
+	for (int i = 0; i < NUM_COMBINATIONS + (int)ancestor_selector_templates.size(); i++)
+	{
+		const bool reference = (i == 0);
+		const SelectorFlags selector_flags = SelectorFlags(i < NUM_COMBINATIONS ? i : NO_SELECTOR);
+
+		String name, styles;
+		if (reference)
+			name = "Reference (no style rules)";
+		else if (i < NUM_COMBINATIONS)
+			styles = GenerateRCSS(selector_flags, String(), name);
+		else
+			styles = GenerateAncestorRCSS(ancestor_selector_templates[i - NUM_COMBINATIONS], name);
+
+		const String compiled_document_rml = Rml::CreateString(1000 + styles.size(), document_rml_template, styles.c_str());
+
+		ElementDocument* document = context->LoadDocumentFromMemory(compiled_document_rml);
+		document->Show();
+
+		Element* el = document->GetElementById("performance");
+		el->SetInnerRML(rml);
+		el->SetPseudoClass("hover", true);
+		context->Update();
+
+		Vector<Element*> elements;
+		GetDescendentElements(el, elements);
+		const StyleSheet* style_sheet = document->GetStyleSheet();
+
+		bench.run(name, [&] {
+			for (Element* element : elements)
+				nanobench::doNotOptimizeAway(style_sheet->GetElementDefinition(element));
+		});
+
+		document->Close();
+		context->Update();
+	}
+}
@@ -0,0 +1,144 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "../Common/TestsShell.h"
+#include <RmlUi/Core/Context.h>
+#include <RmlUi/Core/Core.h>
+#include <RmlUi/Core/Element.h>
+#include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/FontEngineInterface.h>
+#include <RmlUi/Core/StringUtilities.h>
+#include <RmlUi/Core/Types.h>
+#include <doctest.h>
+#include <nanobench.h>
+
+using namespace ankerl;
+using namespace Rml;
+
+static const String rml_text_measurement_document = R"(
+<rml>
+<head>
+	<title>Text measurement</title>
+	<link type="text/rcss" href="/../Tests/Data/style.rcss"/>
+	<style>
+		body {
+			font-size: 16px;
+			width: 600px;
+		}
+	</style>
+</head>
+<body>
+</body>
+</rml>
+)";
+
+// Generates distinct words from the given set of characters, as UTF-8 strings.
+static StringList GenerateWords(int num_words, const Vector<Character>& characters)
+{
+	nanobench::Rng rng(42);
+
+	StringList words;
+	words.reserve(num_words);
+	for (int i = 0; i < num_words; i++)
+	{
+		// Start each word with its index, so that all the words are unique.
+		String word = CreateString(16, "%d", i);
+		const int length = 3 + int(rng.bounded(8));
+		for (int j = 0; j < length; j++)
+			word += StringUtilities::ToUTF8(characters[rng.bounded(uint32_t(characters.size()))]);
+		words.push_back(std::move(word));
+	}
+
+	return words;
+}
+
+TEST_CASE("text_measurement")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	FontEngineInterface* font_interface = Rml::GetFontEngineInterface();
+	const FontFaceHandle handle = font_interface->GetFontFaceHandle("latolatin", Style::FontStyle::Normal, Style::FontWeight::Normal, 16);
+	REQUIRE(handle);
+
+	Vector<Character> ascii_characters;
+	for (char32_t c = 'A'; c <= 'z'; c++)
+		ascii_characters.push_back(Character(c));
+
+	Vector<Character> latin_characters = ascii_characters;
+	for (char32_t c = 0xC0; c <= 0xFF; c++)
+		latin_characters.push_back(Character(c));
+
+	// More words than the font engine caches the shaped runs of, so that every word is measured anew.
+	constexpr int num_words = 8192;
+	const StringList ascii_words = GenerateWords(num_words, ascii_characters);
+	const StringList latin_words = GenerateWords(num_words, latin_characters);
+	const StringList cached_words(ascii_words.begin(), ascii_words.begin() + 256);
+
+	nanobench::Bench bench;
+	bench.title("Text measurement");
+	bench.timeUnit(std::chrono::microseconds(1), "us");
+
+	auto measure_words = [&](const StringList& words) {
+		int width = 0;
+		for (const String& word : words)
+			width += font_interface->GetStringWidth(handle, word, Character(' '));
+		nanobench::doNotOptimizeAway(width);
+	};
+
+	bench.run("GetStringWidth (cached words)", [&] { measure_words(cached_words); });
+
+	bench.minEpochIterations(10);
+	bench.run("GetStringWidth (ASCII words)", [&] { measure_words(ascii_words); });
+	bench.run("GetStringWidth (Latin-1 words)", [&] { measure_words(latin_words); });
+
+	ElementDocument* document = context->LoadDocumentFromMemory(rml_text_measurement_document);
+	REQUIRE(document);
+
+	String rml;
+	for (int i = 0; i < 50; i++)
+	{
+		rml += "<p>";
+		for (int j = 0; j < 40; j++)
+			rml += latin_words[i * 40 + j] + ' ';
+		rml += "</p>";
+	}
+	document->SetInnerRML(rml);
+	document->Show();
+	context->Update();
+	context->Render();
+
+	bool toggle_width = true;
+	bench.run("Layout (paragraphs)", [&] {
+		document->SetProperty(PropertyId::Width, Property(toggle_width ? 500.f : 600.f, Property::PX));
+		toggle_width = !toggle_width;
+		context->Update();
+	});
+
+	document->Close();
+}
@@ -78,9 +78,16 @@ void TestsSystemInterface::SetNumExpectedWarnings(int in_num_expected_warnings)
 	num_expected_warnings = in_num_expected_warnings;
 }
 
-void TestsRenderInterface::RenderGeometry(Rml::Vertex* /*vertices*/, int /*num_vertices*/, int* /*indices*/, int /*num_indices*/, const Rml::TextureHandle /*texture*/, const Rml::Vector2f& /*translation*/)
+void TestsRenderInterface::RenderGeometry(Rml::Vertex* /*vertices*/, int /*num_vertices*/, int* /*indices*/, int num_indices, const Rml::TextureHandle /*texture*/, const Rml::Vector2f& /*translation*/)
 {
 	counters.render_calls += 1;
+	counters.render_indices += num_indices;
+}
+
+void TestsRenderInterface::RenderCommands(const Rml::RenderCommandList& command_list)
+{
+	counters.render_command_lists += 1;
+	Rml::RenderInterface::RenderCommands(command_list);
 }
 
 void TestsRenderInterface::EnableScissorRegion(bool /*enable*/)
@@ -109,6 +116,13 @@ bool TestsRenderInterface::GenerateTexture(Rml::TextureHandle& texture_handle, c
 	return true;
 }
 
+bool TestsRenderInterface::UpdateTexture(Rml::TextureHandle /*texture_handle*/, const Rml::Vector2i& /*region_origin*/,
+	const Rml::Vector2i& /*region_dimensions*/, const Rml::byte* /*source*/, int /*source_stride*/)
+{
+	counters.update_texture += 1;
+	return true;
+}
+
 void TestsRenderInterface::ReleaseTexture(Rml::TextureHandle /*texture_handle*/)
 {
 	counters.release_texture += 1;
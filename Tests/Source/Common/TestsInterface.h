@@ -54,10 +54,13 @@ class TestsRenderInterface : public Rml::RenderInterface {
 public:
 	struct Counters {
 		size_t render_calls;
+		size_t render_indices;
+		size_t render_command_lists;
 		size_t enable_scissor;
 		size_t set_scissor;
 		size_t load_texture;
 		size_t generate_texture;
+		size_t update_texture;
 		size_t release_texture;
 		size_t set_transform;
 	};
@@ -65,11 +68,15 @@ public:
 	void RenderGeometry(Rml::Vertex* vertices, int num_vertices, int* indices, int num_indices, Rml::TextureHandle texture,
 		const Rml::Vector2f& translation) override;
 
+	void RenderCommands(const Rml::RenderCommandList& command_list) override;
+
 	void EnableScissorRegion(bool enable) override;
 	void SetScissorRegion(int x, int y, int width, int height) override;
 
 	bool LoadTexture(Rml::TextureHandle& texture_handle, Rml::Vector2i& texture_dimensions, const Rml::String& source) override;
 	bool GenerateTexture(Rml::TextureHandle& texture_handle, const Rml::byte* source, const Rml::Vector2i& source_dimensions) override;
+	bool UpdateTexture(Rml::TextureHandle texture_handle, const Rml::Vector2i& region_origin, const Rml::Vector2i& region_dimensions,
+		const Rml::byte* source, int source_stride) override;
 	void ReleaseTexture(Rml::TextureHandle texture_handle) override;
 
 	void SetTransform(const Rml::Matrix4f* transform) override;
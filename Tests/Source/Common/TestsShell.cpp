@@ -191,13 +191,23 @@ Rml::String TestsShell::GetRenderStats()
 #if !defined(RMLUI_TESTS_USE_SHELL)
 
 	shell_context->Update();
+
+	// Render once with batching enabled to show the number of render calls after merging.
+	const bool render_batching_enabled = shell_context->IsRenderBatchingEnabled();
+	shell_context->EnableRenderBatching(true);
+	shell_render_interface.ResetCounters();
+	shell_context->Render();
+	const size_t render_calls_batched = shell_render_interface.GetCounters().render_calls;
+	shell_context->EnableRenderBatching(render_batching_enabled);
+
 	shell_render_interface.ResetCounters();
 	shell_context->Render();
 	auto& counters = shell_render_interface.GetCounters();
 
-	result = Rml::CreateString(256,
+	result = Rml::CreateString(320,
 		"Context::Render() stats:\n"
 		"  Render calls: %zu\n"
+		"  Render calls (batched): %zu\n"
 		"  Scissor enable: %zu\n"
 		"  Scissor set: %zu\n"
 		"  Texture load: %zu\n"
@@ -205,6 +215,7 @@ Rml::String TestsShell::GetRenderStats()
 		"  Texture release: %zu\n"
 		"  Transform set: %zu",
 		counters.render_calls,
+		render_calls_batched,
 		counters.enable_scissor,
 		counters.set_scissor,
 		counters.load_texture,
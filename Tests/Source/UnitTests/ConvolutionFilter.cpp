@@ -0,0 +1,131 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include <RmlUi/Core/ConvolutionFilter.h>
+#include <RmlUi/Core/Types.h>
+#include <doctest.h>
+
+using namespace Rml;
+
+// Straightforward per-pixel implementation of the filter, used as reference.
+static void RunReferenceFilter(ConvolutionFilter& filter, Vector2i kernel_radii, FilterOperation operation, byte* destination,
+	Vector2i destination_dimensions, int destination_stride, const byte* source, Vector2i source_dimensions, Vector2i source_offset)
+{
+	const Vector2i kernel_size = kernel_radii * 2 + Vector2i(1);
+
+	for (int y = 0; y < destination_dimensions.y; ++y)
+	{
+		for (int x = 0; x < destination_dimensions.x; ++x)
+		{
+			float opacity = 0.f;
+
+			for (int kernel_y = 0; kernel_y < kernel_size.y; ++kernel_y)
+			{
+				const int source_y = y - source_offset.y - kernel_radii.y + kernel_y;
+
+				for (int kernel_x = 0; kernel_x < kernel_size.x; ++kernel_x)
+				{
+					const int source_x = x - source_offset.x - kernel_radii.x + kernel_x;
+					if (source_y >= 0 && source_y < source_dimensions.y && source_x >= 0 && source_x < source_dimensions.x)
+					{
+						const float pixel_opacity = float(source[source_y * source_dimensions.x + source_x]) * filter[kernel_y][kernel_x];
+						if (operation == FilterOperation::Sum)
+							opacity += pixel_opacity;
+						else
+							opacity = Math::Max(opacity, pixel_opacity);
+					}
+				}
+			}
+
+			destination[y * destination_stride + x * 4 + 3] = byte(Math::Min(255.f, opacity));
+		}
+	}
+}
+
+TEST_CASE("core.convolution_filter")
+{
+	struct TestCase {
+		Vector2i kernel_radii;
+		FilterOperation operation;
+		Vector2i source_dimensions;
+		Vector2i source_offset;
+	};
+
+	const TestCase test_cases[] = {
+		{Vector2i(0, 0), FilterOperation::Sum, Vector2i(9, 7), Vector2i(0, 0)},
+		{Vector2i(3, 0), FilterOperation::Sum, Vector2i(13, 11), Vector2i(3, 3)},
+		{Vector2i(0, 5), FilterOperation::Sum, Vector2i(17, 10), Vector2i(0, 0)},
+		{Vector2i(2, 2), FilterOperation::Dilation, Vector2i(6, 21), Vector2i(2, 2)},
+		{Vector2i(7, 7), FilterOperation::Dilation, Vector2i(31, 28), Vector2i(9, 5)},
+		{Vector2i(4, 1), FilterOperation::Sum, Vector2i(1, 1), Vector2i(4, 1)},
+	};
+
+	unsigned int random_state = 1;
+	auto random_byte = [&random_state]() {
+		random_state = random_state * 1103515245u + 12345u;
+		return byte(random_state >> 16);
+	};
+
+	for (const TestCase& test : test_cases)
+	{
+		const Vector2i kernel_size = test.kernel_radii * 2 + Vector2i(1);
+
+		ConvolutionFilter filter;
+		REQUIRE(filter.Initialise(test.kernel_radii, test.operation));
+
+		// Use a normalized kernel with some zero values, as seen in the font effects.
+		for (int y = 0; y < kernel_size.y; y++)
+			for (int x = 0; x < kernel_size.x; x++)
+				filter[y][x] = ((x + y) % 5 == 4 ? 0.f : float(random_byte()) / float(255 * kernel_size.x * kernel_size.y));
+
+		Vector<byte> source(test.source_dimensions.x * test.source_dimensions.y);
+		for (byte& value : source)
+			value = random_byte();
+
+		const Vector2i destination_dimensions = test.source_dimensions + test.kernel_radii * 2;
+		const int destination_stride = destination_dimensions.x * 4 + 8;
+
+		Vector<byte> expected(destination_stride * destination_dimensions.y, 0x7f);
+		Vector<byte> result = expected;
+
+		RunReferenceFilter(filter, test.kernel_radii, test.operation, expected.data(), destination_dimensions, destination_stride, source.data(),
+			test.source_dimensions, test.source_offset);
+		filter.Run(result.data(), destination_dimensions, destination_stride, ColorFormat::RGBA8, source.data(), test.source_dimensions,
+			test.source_offset, ColorFormat::A8);
+
+		// Allow off-by-one differences for compilers contracting the reference arithmetic differently.
+		int num_mismatches = 0;
+		for (size_t i = 0; i < expected.size(); i++)
+		{
+			if (Math::AbsoluteValue(int(expected[i]) - int(result[i])) > 1)
+				num_mismatches += 1;
+		}
+
+		CHECK(num_mismatches == 0);
+	}
+}
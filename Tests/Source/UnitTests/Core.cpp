@@ -26,12 +26,19 @@
  *
  */
 
+#include "../../../Source/Core/FontEngineDefault/FontFaceHandleDefault.h"
 #include "../Common/TestsInterface.h"
 #include "../Common/TestsShell.h"
 #include <RmlUi/Core/Context.h>
 #include <RmlUi/Core/Core.h>
 #include <RmlUi/Core/Element.h>
 #include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/ElementInstancer.h>
+#include <RmlUi/Core/Factory.h>
+#include <RmlUi/Core/FontEngineInterface.h>
+#include <RmlUi/Core/Geometry.h>
+#include <RmlUi/Core/GeometryUtilities.h>
+#include <RmlUi/Core/Texture.h>
 #include <algorithm>
 #include <doctest.h>
 
@@ -157,6 +164,7 @@ TEST_CASE("core.release_textures")
 	SUBCASE("FontGlyphCache")
 	{
 		const auto counter_generate_before = counters.generate_texture;
+		const auto counter_update_before = counters.update_texture;
 		const auto counter_release_before = counters.release_texture;
 
 		// Verify that ASCII characters are cached during the first use of the font. Then the font texture should not be regenerated when adding ASCII
@@ -165,11 +173,13 @@ TEST_CASE("core.release_textures")
 		TestsShell::RenderLoop();
 		CHECK(counters.generate_texture == counter_generate_before);
 
-		// However, when we display a non-ASCII character not part of the initial cache, the font texture needs to be regenerated.
+		// However, when we display a non-ASCII character not part of the initial cache, the glyph needs to be added to the font texture. This
+		// should be done by updating the existing texture in-place, rather than regenerating it.
 		element->SetInnerRML(reinterpret_cast<const char*>(u8"π"));
 		TestsShell::RenderLoop();
-		CHECK(counters.generate_texture == counter_generate_before + 1);
-		CHECK(counters.release_texture == counter_release_before + 1);
+		CHECK(counters.generate_texture == counter_generate_before);
+		CHECK(counters.update_texture == counter_update_before + 1);
+		CHECK(counters.release_texture == counter_release_before);
 	}
 
 	document->Close();
@@ -179,3 +189,735 @@ TEST_CASE("core.release_textures")
 	// Finally, verify that all generated and loaded textures are released during shutdown.
 	CHECK(counters.generate_texture + counters.load_texture == counters.release_texture);
 }
+
+TEST_CASE("core.render_batching")
+{
+	TestsRenderInterface* render_interface = TestsShell::GetTestsRenderInterface();
+	// This test only works with the dummy renderer.
+	if (!render_interface)
+		return;
+
+	const auto& counters = render_interface->GetCounters();
+
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocument("assets/demo.rml");
+	REQUIRE(document);
+	document->Show();
+	context->Update();
+
+	render_interface->ResetCounters();
+	context->Render();
+	const size_t render_calls = counters.render_calls;
+	const size_t render_indices = counters.render_indices;
+	CHECK(counters.render_command_lists == 0);
+
+	context->EnableRenderBatching(true);
+	CHECK(context->IsRenderBatchingEnabled());
+
+	render_interface->ResetCounters();
+	context->Render();
+	CHECK(counters.render_command_lists == 1);
+	CHECK(counters.render_calls > 0);
+	CHECK(counters.render_calls < render_calls);
+	// All the geometry should still be rendered, only with fewer calls.
+	CHECK(counters.render_indices == render_indices);
+
+	// Rendering should be identical between frames.
+	const size_t render_calls_batched = counters.render_calls;
+	render_interface->ResetCounters();
+	context->Render();
+	CHECK(counters.render_calls == render_calls_batched);
+	CHECK(counters.render_indices == render_indices);
+
+	context->EnableRenderBatching(false);
+	CHECK_FALSE(context->IsRenderBatchingEnabled());
+
+	render_interface->ResetCounters();
+	context->Render();
+	CHECK(counters.render_command_lists == 0);
+	CHECK(counters.render_calls == render_calls);
+
+	document->Close();
+
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("core.damage_tracking")
+{
+	TestsRenderInterface* render_interface = TestsShell::GetTestsRenderInterface();
+	// This test only works with the dummy renderer.
+	if (!render_interface)
+		return;
+
+	const auto& counters = render_interface->GetCounters();
+
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocument("assets/demo.rml");
+	REQUIRE(document);
+	document->Show();
+
+	auto RenderFrame = [&]() {
+		context->Update();
+		render_interface->ResetCounters();
+		context->Render();
+	};
+
+	const RenderRegion full_region = {Vector2i(0), context->GetDimensions()};
+	auto IsFullRegion = [&](const RenderRegion& region) {
+		return region.origin == full_region.origin && region.dimensions == full_region.dimensions;
+	};
+
+	// Without damage tracking the whole context is always damaged.
+	RenderFrame();
+	REQUIRE(context->GetDamagedRegions().size() == 1);
+	CHECK(IsFullRegion(context->GetDamagedRegions()[0]));
+
+	context->EnableRenderBatching(true);
+	context->EnableDamageTracking(true);
+
+	// The first frame has nothing to compare against.
+	RenderFrame();
+	REQUIRE(context->GetDamagedRegions().size() == 1);
+	CHECK(IsFullRegion(context->GetDamagedRegions()[0]));
+	CHECK(counters.render_command_lists == 1);
+
+	// Nothing changed, the frame should not be submitted.
+	RenderFrame();
+	CHECK(context->GetDamagedRegions().empty());
+	CHECK(counters.render_command_lists == 0);
+	CHECK(counters.render_calls == 0);
+
+	// Change the appearance of a single element, only its area should be damaged.
+	Element* element = document->GetElementById("title");
+	REQUIRE(element);
+	element->SetProperty(PropertyId::Color, Property(Colourb(255, 0, 0), Property::COLOUR));
+
+	RenderFrame();
+	CHECK(counters.render_command_lists == 1);
+	REQUIRE(context->GetDamagedRegions().size() == 1);
+	const RenderRegion region = context->GetDamagedRegions()[0];
+	CHECK(!IsFullRegion(region));
+	CHECK(region.dimensions.x > 0);
+	CHECK(region.dimensions.y > 0);
+
+	const Vector2f element_position = element->GetAbsoluteOffset(Box::BORDER);
+	CHECK(float(region.origin.x) <= element_position.x + element->GetBox().GetSize(Box::BORDER).x);
+	CHECK(float(region.origin.y) <= element_position.y + element->GetBox().GetSize(Box::BORDER).y);
+
+	RenderFrame();
+	CHECK(context->GetDamagedRegions().empty());
+
+	// Moving the document changes the position of all its geometry.
+	document->SetProperty(PropertyId::Left, Property(10.f, Property::PX));
+	RenderFrame();
+	CHECK(!context->GetDamagedRegions().empty());
+
+	context->EnableDamageTracking(false);
+	context->EnableRenderBatching(false);
+
+	document->Close();
+
+	TestsShell::ShutdownShell();
+}
+
+// Renders a quad with a texture which can be updated in place.
+class ElementUpdatedTexture : public Element {
+public:
+	ElementUpdatedTexture(const String& tag) : Element(tag), geometry(this)
+	{
+		texture.Set("updated-texture", [](const String& /*name*/, UniquePtr<const byte[]>& data, Vector2i& dimensions) {
+			data.reset(new byte[4 * 4 * 4]());
+			dimensions = Vector2i(4, 4);
+			return true;
+		});
+	}
+
+	Texture texture;
+
+protected:
+	void OnRender() override
+	{
+		if (!geometry)
+		{
+			geometry.GetVertices().resize(4);
+			geometry.GetIndices().resize(6);
+			GeometryUtilities::GenerateQuad(geometry.GetVertices().data(), geometry.GetIndices().data(), Vector2f(0.f), GetBox().GetSize(),
+				Colourb(255), Vector2f(0.f), Vector2f(1.f));
+			geometry.SetTexture(&texture);
+		}
+
+		geometry.Render(GetAbsoluteOffset(Box::CONTENT));
+	}
+
+private:
+	Geometry geometry;
+};
+
+TEST_CASE("core.damage_tracking_texture_update")
+{
+	TestsRenderInterface* render_interface = TestsShell::GetTestsRenderInterface();
+	// This test only works with the dummy renderer.
+	if (!render_interface)
+		return;
+
+	const auto& counters = render_interface->GetCounters();
+
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementInstancerGeneric<ElementUpdatedTexture> instancer;
+	Factory::RegisterElementInstancer("updated-texture", &instancer);
+
+	ElementDocument* document = context->LoadDocument("assets/demo.rml");
+	REQUIRE(document);
+	document->Show();
+
+	ElementPtr element_ptr = document->CreateElement("updated-texture");
+	element_ptr->SetProperty(PropertyId::Display, Property(Style::Display::Block));
+	element_ptr->SetProperty(PropertyId::Width, Property(32.f, Property::PX));
+	element_ptr->SetProperty(PropertyId::Height, Property(32.f, Property::PX));
+	auto element = rmlui_dynamic_cast<ElementUpdatedTexture*>(document->AppendChild(std::move(element_ptr)));
+	REQUIRE(element);
+
+	context->EnableRenderBatching(true);
+	context->EnableDamageTracking(true);
+
+	auto RenderFrame = [&]() {
+		context->Update();
+		render_interface->ResetCounters();
+		context->Render();
+	};
+
+	RenderFrame();
+	RenderFrame();
+	CHECK(context->GetDamagedRegions().empty());
+	CHECK(counters.render_command_lists == 0);
+
+	// Updating the texture in place keeps its handle and the geometry, the frame must still be submitted with the element's area damaged.
+	const byte data[2 * 2 * 4] = {};
+	render_interface->ResetCounters();
+	CHECK(element->texture.Update(Vector2i(1, 1), Vector2i(2, 2), data, 2 * 4));
+	CHECK(counters.update_texture == 1);
+
+	RenderFrame();
+	CHECK(counters.generate_texture == 0);
+	CHECK(counters.render_command_lists == 1);
+	REQUIRE(context->GetDamagedRegions().size() == 1);
+
+	const RenderRegion region = context->GetDamagedRegions()[0];
+	const Vector2f element_position = element->GetAbsoluteOffset(Box::CONTENT);
+	CHECK(float(region.origin.x) <= element_position.x);
+	CHECK(float(region.origin.y) <= element_position.y);
+	CHECK(float(region.origin.x + region.dimensions.x) >= element_position.x + 32.f);
+	CHECK(float(region.origin.y + region.dimensions.y) >= element_position.y + 32.f);
+
+	RenderFrame();
+	CHECK(context->GetDamagedRegions().empty());
+	CHECK(counters.render_command_lists == 0);
+
+	context->EnableDamageTracking(false);
+	context->EnableRenderBatching(false);
+
+	document->Close();
+
+	TestsShell::ShutdownShell();
+}
+
+class TestsRenderInterfaceNoUpdate : public TestsRenderInterface {
+public:
+	bool UpdateTexture(TextureHandle texture_handle, const Vector2i& region_origin, const Vector2i& region_dimensions, const byte* source,
+		int source_stride) override
+	{
+		TestsRenderInterface::UpdateTexture(texture_handle, region_origin, region_dimensions, source, source_stride);
+		return false;
+	}
+};
+
+TEST_CASE("core.texture_update_unsupported")
+{
+	TestsShell::GetContext();
+
+	TestsRenderInterfaceNoUpdate render_interface;
+	const auto& counters = render_interface.GetCounters();
+
+	int num_generated = 0;
+	auto callback = [&num_generated](const String& /*name*/, UniquePtr<const byte[]>& data, Vector2i& dimensions) {
+		num_generated += 1;
+		data.reset(new byte[4 * 4 * 4]());
+		dimensions = Vector2i(4, 4);
+		return true;
+	};
+
+	Texture texture;
+	CHECK(!texture.IsUpdateSupported(&render_interface));
+
+	texture.Set("no-update", callback);
+	CHECK(texture.GetHandle(&render_interface) != 0);
+	CHECK(num_generated == 1);
+	CHECK(texture.IsUpdateSupported(&render_interface));
+
+	// The failed update releases the texture, and it is regenerated from its callback on next use.
+	const byte data[2 * 2 * 4] = {};
+	CHECK(!texture.Update(Vector2i(1, 1), Vector2i(2, 2), data, 2 * 4));
+	CHECK(counters.update_texture == 1);
+	CHECK(counters.release_texture == 1);
+	CHECK(texture.GetHandle(&render_interface) != 0);
+	CHECK(num_generated == 2);
+
+	// The failure is remembered for the render interface, thus users can set textures anew instead of preparing data for an update.
+	CHECK(!texture.IsUpdateSupported(&render_interface));
+
+	Texture other_texture;
+	other_texture.Set("no-update-other", callback);
+	CHECK(!other_texture.IsUpdateSupported(&render_interface));
+
+	// Updates are no longer attempted.
+	CHECK(!texture.Update(Vector2i(1, 1), Vector2i(2, 2), data, 2 * 4));
+	CHECK(counters.update_texture == 1);
+	CHECK(counters.release_texture == 2);
+
+	// Other render interfaces are unaffected.
+	TestsRenderInterface* tests_render_interface = TestsShell::GetTestsRenderInterface();
+	if (tests_render_interface)
+		CHECK(other_texture.IsUpdateSupported(tests_render_interface));
+
+	TestsShell::ShutdownShell();
+}
+
+static const String document_font_effect_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body {
+			font-family: LatoLatin;
+			font-size: 37px;
+			font-effect: glow(3px 2px #f00), shadow(2px 2px #00f);
+		}
+	</style>
+</head>
+<body>The quick brown fox jumps over the lazy dog.</body>
+</rml>
+)";
+
+// Renders the font effect document with the dummy renderer.
+class FontEffectDocumentRenderer {
+public:
+	FontEffectDocumentRenderer() :
+		render_interface(TestsShell::GetTestsRenderInterface()), counters(render_interface->GetCounters()), context(TestsShell::GetContext())
+	{
+		REQUIRE(context);
+	}
+
+	// Returns false if the dummy renderer is not used, in which case the test should be skipped.
+	static bool IsSupported() { return TestsShell::GetTestsRenderInterface() != nullptr; }
+
+	// Loads and shows the document in the tests context.
+	ElementDocument* LoadDocument()
+	{
+		ElementDocument* document = context->LoadDocumentFromMemory(document_font_effect_rml);
+		REQUIRE(document);
+		document->Show();
+		return document;
+	}
+
+	// Renders a frame, returning the number of indices rendered.
+	size_t RenderDocument()
+	{
+		context->Update();
+		render_interface->ResetCounters();
+		context->Render();
+		return counters.render_indices;
+	}
+
+	TestsRenderInterface* render_interface;
+	const TestsRenderInterface::Counters& counters;
+	Context* context;
+};
+
+TEST_CASE("core.font_worker_threads")
+{
+	// This test only works with the dummy renderer.
+	if (!FontEffectDocumentRenderer::IsSupported())
+		return;
+
+	FontEffectDocumentRenderer renderer;
+
+	// Render the text synchronously first, for reference.
+	ElementDocument* document = renderer.LoadDocument();
+	const size_t expected_indices = renderer.RenderDocument();
+	CHECK(expected_indices > 0);
+	document->Close();
+	renderer.context->Update();
+
+	// With worker threads, the text and its effects should eventually render the same, while the effects may be missing until then.
+	Rml::ReleaseFontResources();
+	Rml::SetFontEngineWorkerThreads(2);
+
+	document = renderer.LoadDocument();
+
+	const size_t indices = renderer.RenderDocument();
+	CHECK(indices > 0);
+	CHECK(indices <= expected_indices);
+
+	// Disabling the workers finishes all queued jobs, after which their results are picked up by the next frame.
+	Rml::SetFontEngineWorkerThreads(0);
+	CHECK(renderer.RenderDocument() == expected_indices);
+
+	// Newly added glyphs with effects should also end up rendered.
+	Rml::SetFontEngineWorkerThreads(2);
+	document->SetInnerRML(reinterpret_cast<const char*>(u8"¿Qué?"));
+	document->Show();
+	renderer.RenderDocument();
+	Rml::SetFontEngineWorkerThreads(0);
+	const size_t expected_new_indices = renderer.RenderDocument();
+	CHECK(expected_new_indices == 5 * 6 * 3);
+
+	document->Close();
+
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("core.font_distance_field")
+{
+	// This test only works with the dummy renderer.
+	if (!FontEffectDocumentRenderer::IsSupported())
+		return;
+
+	FontEffectDocumentRenderer renderer;
+	const auto& counters = renderer.counters;
+
+	Rml::ReleaseFontResources();
+	Rml::SetFontEngineDistanceFieldRendering(true);
+
+	ElementDocument* document = renderer.LoadDocument();
+	document->SetProperty("font-effect", "none");
+
+	// The quick brown fox has 36 visible glyphs. The test renderer does not support distance field textures, thus the CPU fallback is used.
+	const size_t num_glyph_indices = 36 * 6;
+	CHECK(renderer.RenderDocument() == num_glyph_indices);
+	CHECK(counters.generate_texture > 0);
+
+	// Other font sizes are rendered from the same atlas, without generating any new textures.
+	for (const char* font_size : {"12px", "20px", "64px"})
+	{
+		document->SetProperty("font-size", font_size);
+		CHECK(renderer.RenderDocument() == num_glyph_indices);
+		CHECK(counters.generate_texture == 0);
+	}
+
+	// The glow effect generates its own texture from the distance fields, while the shadow shares the textures of the atlas.
+	document->RemoveProperty("font-effect");
+	CHECK(renderer.RenderDocument() == num_glyph_indices * 3);
+	CHECK(counters.generate_texture == 1);
+
+	// New glyphs are added to the shared atlas.
+	document->SetInnerRML(reinterpret_cast<const char*>(u8"¿Qué?"));
+	renderer.RenderDocument();
+	CHECK(renderer.RenderDocument() == 5 * 6 * 3);
+
+	document->Close();
+
+	Rml::SetFontEngineDistanceFieldRendering(false);
+	Rml::ReleaseFontResources();
+
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("core.font_memory_budget")
+{
+	// This test only works with the dummy renderer.
+	if (!FontEffectDocumentRenderer::IsSupported())
+		return;
+
+	FontEffectDocumentRenderer renderer;
+
+	struct HandleUsage {
+		size_t num_handles = 0;
+		size_t num_handles_with_resources = 0;
+		size_t total_bytes = 0;
+		Rml::FontFaceMemoryUsage current;
+	};
+	auto GetHandleUsage = [](int current_size) {
+		HandleUsage result;
+		for (const Rml::FontFaceMemoryUsage& usage : Rml::GetFontEngineMemoryUsage())
+		{
+			if (usage.family != "latolatin" || usage.weight != Style::FontWeight::Normal)
+				continue;
+
+			const size_t bytes = usage.glyph_bytes + usage.texture_bytes + usage.cache_bytes;
+			result.num_handles += 1;
+			result.total_bytes += bytes;
+			if (usage.texture_bytes > 0)
+				result.num_handles_with_resources += 1;
+			if (usage.size == current_size)
+				result.current = usage;
+		}
+		return result;
+	};
+
+	Rml::ReleaseFontResources();
+
+	ElementDocument* document = renderer.LoadDocument();
+
+	const size_t expected_indices = renderer.RenderDocument();
+	CHECK(expected_indices > 0);
+
+	HandleUsage usage = GetHandleUsage(37);
+	CHECK(usage.num_handles == 1);
+	CHECK(usage.current.num_glyphs > 36);
+	CHECK(usage.current.num_layers == 2);
+	CHECK(usage.current.glyph_bytes > 0);
+	CHECK(usage.current.texture_bytes > 0);
+	CHECK(usage.current.cache_bytes > 0);
+
+	// Without a budget, the resources of every font size are kept.
+	const int font_sizes[] = {20, 21, 22, 23, 24};
+	for (int font_size : font_sizes)
+	{
+		document->SetProperty("font-size", Rml::CreateString(16, "%dpx", font_size));
+		CHECK(renderer.RenderDocument() == expected_indices);
+	}
+
+	usage = GetHandleUsage(24);
+	CHECK(usage.num_handles == 6);
+	CHECK(usage.num_handles_with_resources == 6);
+	const size_t unlimited_bytes = usage.total_bytes;
+
+	// With a budget, the resources of sizes no longer in use are released as new resources are generated, while the text in use keeps rendering.
+	Rml::SetFontEngineMemoryBudget(1);
+
+	for (int font_size : font_sizes)
+	{
+		document->SetProperty("font-size", Rml::CreateString(16, "%dpx", font_size + 10));
+		CHECK(renderer.RenderDocument() == expected_indices);
+		CHECK(renderer.RenderDocument() == expected_indices);
+	}
+
+	usage = GetHandleUsage(34);
+	CHECK(usage.num_handles == 11);
+	CHECK(usage.num_handles_with_resources <= 2);
+	CHECK(usage.current.texture_bytes > 0);
+	CHECK(usage.total_bytes < unlimited_bytes / 2);
+
+	// Layers of transient font effects are released too, while those in use are kept.
+	document->SetProperty("font-effect", "glow(1px #f00)");
+	const size_t expected_glow_indices = renderer.RenderDocument();
+	CHECK(expected_glow_indices > 0);
+
+	for (int i = 2; i <= 8; i++)
+	{
+		document->SetProperty("font-effect", Rml::CreateString(64, "glow(%dpx #f00)", i));
+		CHECK(renderer.RenderDocument() == expected_glow_indices);
+		CHECK(renderer.RenderDocument() == expected_glow_indices);
+	}
+
+	usage = GetHandleUsage(34);
+	CHECK(usage.current.num_layers <= 3);
+	CHECK(usage.current.texture_bytes > 0);
+
+	// Released resources are generated anew when used again.
+	document->RemoveProperty("font-effect");
+	document->SetProperty("font-size", "20px");
+	CHECK(renderer.RenderDocument() == expected_indices);
+	CHECK(GetHandleUsage(20).current.texture_bytes > 0);
+
+	Rml::SetFontEngineMemoryBudget(0);
+
+	document->Close();
+	Rml::ReleaseFontResources();
+
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("core.font_kerning")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	FontEngineInterface* font_interface = Rml::GetFontEngineInterface();
+	const FontFaceHandle handle = font_interface->GetFontFaceHandle("latolatin", Style::FontStyle::Normal, Style::FontWeight::Normal, 32);
+	REQUIRE(handle);
+
+	auto GetStringWidth = [&](const char* string, Character prior_character = Character::Null) {
+		return font_interface->GetStringWidth(handle, string, prior_character);
+	};
+
+	const char* a_grave = reinterpret_cast<const char*>(u8"\u00C0");
+	const char* f_a_grave = reinterpret_cast<const char*>(u8"F\u00C0");
+
+	// Pairs of ASCII characters, and pairs with characters outside of the ASCII range, are kerned alike.
+	CHECK(GetStringWidth("FA") < GetStringWidth("F") + GetStringWidth("A"));
+	CHECK(GetStringWidth(f_a_grave) < GetStringWidth("F") + GetStringWidth(a_grave));
+	CHECK(GetStringWidth(f_a_grave) - GetStringWidth(a_grave) == GetStringWidth("FA") - GetStringWidth("A"));
+
+	// The prior character is kerned with the first character of the string.
+	CHECK(GetStringWidth("A", Character('F')) < GetStringWidth("A"));
+	CHECK(GetStringWidth(a_grave, Character('F')) < GetStringWidth(a_grave));
+
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("core.font_shape_string")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	FontEngineInterface* font_interface = Rml::GetFontEngineInterface();
+	const FontFaceHandle handle = font_interface->GetFontFaceHandle("latolatin", Style::FontStyle::Normal, Style::FontWeight::Normal, 32);
+	REQUIRE(handle);
+
+	const String string = reinterpret_cast<const char*>(u8"FA\u00C0x");
+	const int string_width = font_interface->GetStringWidth(handle, string);
+
+	SUBCASE("default_engine")
+	{
+		Vector<ShapedGlyphPosition> glyphs;
+		CHECK(font_interface->ShapeString(handle, string, glyphs) == string_width);
+
+		REQUIRE(glyphs.size() == 4);
+		CHECK(glyphs[0].string_offset == 0);
+		CHECK(glyphs[1].string_offset == 1);
+		CHECK(glyphs[2].string_offset == 2);
+		CHECK(glyphs[3].string_offset == 4);
+
+		CHECK(glyphs[0].position.x == 0);
+		for (size_t i = 1; i < glyphs.size(); i++)
+			CHECK(glyphs[i].position.x > glyphs[i - 1].position.x);
+
+		// Kerning moves the second glyph closer to the first one.
+		CHECK(glyphs[1].position.x < font_interface->GetStringWidth(handle, "F"));
+	}
+
+	SUBCASE("interface_default")
+	{
+		// The implementation provided by the interface itself places the glyphs by measuring each character.
+		Vector<ShapedGlyphPosition> glyphs;
+		CHECK(font_interface->FontEngineInterface::ShapeString(handle, string, glyphs) == string_width);
+
+		REQUIRE(glyphs.size() == 4);
+		CHECK(glyphs[3].string_offset == 4);
+		CHECK(glyphs[1].position.x == font_interface->GetStringWidth(handle, "F"));
+	}
+
+	TestsShell::ShutdownShell();
+}
+
+#ifdef RMLUI_ENABLE_HARFBUZZ
+TEST_CASE("core.font_shaping_harfbuzz")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	FontEngineInterface* font_interface = Rml::GetFontEngineInterface();
+	const FontFaceHandle handle = font_interface->GetFontFaceHandle("latolatin", Style::FontStyle::Normal, Style::FontWeight::Normal, 32);
+	REQUIRE(handle);
+	const FontEffectsHandle font_effects = font_interface->PrepareFontEffects(handle, {});
+
+	auto GetStringWidth = [&](const String& string) { return font_interface->GetStringWidth(handle, string); };
+	auto GenerateString = [&](const String& string, int& out_num_glyphs) {
+		GeometryList geometry;
+		const int width = font_interface->GenerateString(handle, font_effects, string, Vector2f(0.f), Colourb(255), 1.f, geometry);
+		out_num_glyphs = 0;
+		for (Geometry& glyph_geometry : geometry)
+			out_num_glyphs += (int)glyph_geometry.GetIndices().size() / 6;
+		return width;
+	};
+
+	// The "fi" ligature of the font replaces its two characters with a single glyph.
+	int num_glyphs = 0;
+	const int fi_width = GenerateString("fi", num_glyphs);
+	CHECK(num_glyphs == 1);
+	CHECK(GenerateString("f", num_glyphs) > 0);
+	CHECK(num_glyphs == 1);
+	CHECK(GenerateString("if", num_glyphs) > 0);
+	CHECK(num_glyphs == 2);
+
+	// The ligature is measured the same way as it is generated.
+	CHECK(GetStringWidth("fi") == fi_width);
+	CHECK(GetStringWidth("office") == GenerateString("office", num_glyphs));
+	CHECK(num_glyphs < 6);
+
+	// The ligature is placed at the offset of the first character it represents.
+	Vector<ShapedGlyphPosition> glyphs;
+	CHECK(font_interface->ShapeString(handle, "xfi", glyphs) == GetStringWidth("xfi"));
+	REQUIRE(glyphs.size() == 2);
+	CHECK(glyphs[0].string_offset == 0);
+	CHECK(glyphs[1].string_offset == 1);
+
+	// Pairs are kerned by the shaper.
+	CHECK(GetStringWidth("FA") < GetStringWidth("F") + GetStringWidth("A"));
+	CHECK(GetStringWidth("FA") == GenerateString("FA", num_glyphs));
+	CHECK(num_glyphs == 2);
+
+	TestsShell::ShutdownShell();
+}
+#endif
+
+TEST_CASE("core.font_shaped_run_cache")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	Rml::ReleaseFontResources();
+
+	FontEngineInterface* font_interface = Rml::GetFontEngineInterface();
+	const FontFaceHandle handle = font_interface->GetFontFaceHandle("latolatin", Style::FontStyle::Normal, Style::FontWeight::Normal, 31);
+	REQUIRE(handle);
+	const FontFaceHandleDefault* handle_default = reinterpret_cast<const FontFaceHandleDefault*>(handle);
+
+	auto GetStringWidth = [&](const String& string) { return font_interface->GetStringWidth(handle, string); };
+
+	CHECK(handle_default->GetNumShapedRuns() == 0);
+
+	// Measuring the same string again is served from the cache.
+	const int hello_width = GetStringWidth("Hello");
+	CHECK(hello_width > 0);
+	CHECK(handle_default->GetNumShapedRuns() == 1);
+	CHECK(GetStringWidth("Hello") == hello_width);
+	CHECK(handle_default->GetNumShapedRuns() == 1);
+
+	CHECK(GetStringWidth("World") > 0);
+	CHECK(handle_default->GetNumShapedRuns() == 2);
+
+	// Runs with glyphs missing from every font are not cached, a fallback font added later may provide them.
+	const char* missing_glyph = reinterpret_cast<const char*>(u8"Hello \u4E2D");
+	CHECK(GetStringWidth(missing_glyph) >= hello_width);
+	CHECK(handle_default->GetNumShapedRuns() == 2);
+
+	// Releasing the resources of the handle to meet the memory budget clears its glyphs along with the runs shaped from them, and changes
+	// the version of the handle.
+	const int version = font_interface->GetVersion(handle);
+	Rml::SetFontEngineMemoryBudget(1);
+	CHECK(font_interface->GetFontFaceHandle("latolatin", Style::FontStyle::Normal, Style::FontWeight::Normal, 30));
+	Rml::SetFontEngineMemoryBudget(0);
+	CHECK(handle_default->GetNumShapedRuns() == 0);
+	CHECK(font_interface->GetVersion(handle) != version);
+
+	CHECK(GetStringWidth("Hello") == hello_width);
+	CHECK(handle_default->GetNumShapedRuns() == 1);
+
+	// The cache stays bounded when measuring many distinct strings, while keeping those which are still in use.
+	for (int i = 0; i < 10000; i++)
+	{
+		GetStringWidth(Rml::CreateString(32, "%d", i));
+		if (i % 100 == 0)
+			GetStringWidth("Hello");
+	}
+
+	const int num_shaped_runs = handle_default->GetNumShapedRuns();
+	CHECK(num_shaped_runs <= 4096);
+	CHECK(num_shaped_runs >= 2048);
+
+	CHECK(GetStringWidth("Hello") == hello_width);
+	CHECK(handle_default->GetNumShapedRuns() == num_shaped_runs);
+
+	Rml::ReleaseFontResources();
+
+	TestsShell::ShutdownShell();
+}
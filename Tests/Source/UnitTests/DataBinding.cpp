@@ -31,6 +31,8 @@
 #include <RmlUi/Core/DataModelHandle.h>
 #include <RmlUi/Core/Element.h>
 #include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/Elements/ElementFormControlSelect.h>
+#include <RmlUi/Core/StringUtilities.h>
 #include <doctest.h>
 #include <map>
 
@@ -148,6 +150,47 @@ static const String inside_string_rml = R"(
 </rml>	
 )";
 
+static const String data_for_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<link type="text/template" href="/assets/window.rml"/>
+</head>
+
+<body template="window">
+<div data-model="basics">
+
+<div id="items">
+	<p data-for="s, i : arrays.c" class="item" data-attr-index="i">
+		{{ i }}: <b>{{ s.val }}</b> &amp; <span data-for="arrays.a">{{ it }} </span>
+	</p>
+</div>
+<div id="selects">
+	<div data-for="arrays.a"><select><option value="a">{{ it }}</option></select></div>
+</div>
+
+</div>
+</body>
+</rml>
+)";
+
+static const String data_for_key_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<link type="text/template" href="/assets/window.rml"/>
+</head>
+
+<body template="window">
+<div data-model="servers">
+<div id="list"><p data-for="server, i : servers" data-key="server.id">{{ i }}:{{ server.name }}</p></div>
+</div>
+</body>
+</rml>
+)";
+
 struct StringWrap
 {
 	StringWrap(String val = "wrap_default") : val(val) {}
@@ -449,4 +492,125 @@ TEST_CASE("databinding.inside_string")
 	document->Close();
 
 	TestsShell::ShutdownShell();
-}
\ No newline at end of file
+}
+
+TEST_CASE("databinding.for")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	REQUIRE(InitializeDataBindings(context));
+
+	ElementDocument* document = context->LoadDocumentFromMemory(data_for_rml);
+	REQUIRE(document);
+	document->Show();
+
+	TestsShell::RenderLoop();
+
+	// The hidden data-for element itself is placed after the generated items.
+	ElementList items;
+	document->GetElementsByClassName(items, "item");
+	REQUIRE(items.size() == 4);
+	CHECK(items[1]->GetAttribute<String>("index", "") == "1");
+	CHECK(StringUtilities::StripWhitespace(items[1]->GetInnerRML()) ==
+		"1: <b>c2</b> &amp; <span>10 </span><span>11 </span><span>12 </span><span data-for=\"arrays.a\" />");
+
+	// The contents of these items are instanced through the XML parser, as the 'select' tag uses a custom node handler.
+	ElementList selects;
+	document->GetElementsByTagName(selects, "select");
+	REQUIRE(selects.size() == 3);
+	auto select = rmlui_dynamic_cast<ElementFormControlSelect*>(selects[2]);
+	REQUIRE(select);
+	REQUIRE(select->GetNumOptions() == 1);
+	CHECK(select->GetOption(0)->GetInnerRML() == "12");
+
+	document->Close();
+
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("databinding.for_key")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	struct Server {
+		int id;
+		String name;
+	};
+	Vector<Server> servers = {{1, "a"}, {2, "b"}, {3, "c"}};
+
+	DataModelConstructor constructor = context->CreateDataModel("servers");
+	REQUIRE(static_cast<bool>(constructor));
+	if (auto handle = constructor.RegisterStruct<Server>())
+	{
+		handle.RegisterMember("id", &Server::id);
+		handle.RegisterMember("name", &Server::name);
+	}
+	constructor.RegisterArray<Vector<Server>>();
+	constructor.Bind("servers", &servers);
+	DataModelHandle model_handle = constructor.GetModelHandle();
+
+	ElementDocument* document = context->LoadDocumentFromMemory(data_for_key_rml);
+	REQUIRE(document);
+	document->Show();
+
+	Element* list = document->GetElementById("list");
+
+	// Returns the generated items, skipping the hidden data-for element placed last.
+	auto GetItems = [&]() {
+		ElementList items;
+		for (int i = 0; i < list->GetNumChildren() - 1; i++)
+			items.push_back(list->GetChild(i));
+		return items;
+	};
+	auto GetContents = [&]() {
+		String result;
+		for (Element* item : GetItems())
+			result += item->GetInnerRML() + " ";
+		return result;
+	};
+
+	context->Update();
+	const ElementList initial_items = GetItems();
+	REQUIRE(initial_items.size() == 3);
+	CHECK(GetContents() == "0:a 1:b 2:c ");
+
+	// Existing elements should be preserved when inserting at the front.
+	servers.insert(servers.begin(), Server{4, "d"});
+	model_handle.DirtyVariable("servers");
+	context->Update();
+	CHECK(GetContents() == "0:d 1:a 2:b 3:c ");
+	CHECK(GetItems() == ElementList{GetItems()[0], initial_items[0], initial_items[1], initial_items[2]});
+
+	// And moved along with their items.
+	std::reverse(servers.begin(), servers.end());
+	model_handle.DirtyVariable("servers");
+	context->Update();
+	CHECK(GetContents() == "0:c 1:b 2:a 3:d ");
+	CHECK(GetItems() == ElementList{initial_items[2], initial_items[1], initial_items[0], GetItems()[3]});
+
+	servers.erase(servers.begin() + 1);
+	servers[0].name = "e";
+	model_handle.DirtyVariable("servers");
+	context->Update();
+	CHECK(GetContents() == "0:e 1:a 2:d ");
+	CHECK(GetItems() == ElementList{initial_items[2], initial_items[0], GetItems()[2]});
+
+	// Items with duplicate keys are matched by their index instead, so their elements are still preserved between updates.
+	const ElementList items_before_duplicate = GetItems();
+	servers[2].id = servers[0].id;
+	for (int i = 0; i < 2; i++)
+	{
+		TestsShell::SetNumExpectedWarnings(1);
+		model_handle.DirtyVariable("servers");
+		context->Update();
+		CHECK(GetContents() == "0:e 1:a 2:d ");
+		CHECK(GetItems() == items_before_duplicate);
+	}
+	TestsShell::SetNumExpectedWarnings(0);
+
+	document->Close();
+
+	TestsShell::ShutdownShell();
+}
@@ -37,6 +37,33 @@ static DataTypeRegister type_register;
 static DataModel model(type_register.GetTransformFuncRegister());
 static DataExpressionInterface interface(&model, nullptr);
 
+static bool RunProgram(const Program& program, const AddressList& addresses, const VariableList& variables, Variant& out_result)
+{
+	DataInterpreter interpreter(program, addresses, variables, interface);
+	if (!interpreter.Run())
+		return false;
+	out_result = interpreter.Result();
+	return true;
+}
+
+// Executes the program both as parsed and after optimization, and verifies that they produce the same result.
+static bool RunProgramWithOptimization(const Program& program, const AddressList& addresses, Variant& out_result)
+{
+	Variant unoptimized_result;
+	if (!RunProgram(program, addresses, VariableList(), unoptimized_result))
+		return false;
+
+	Program optimized_program = program;
+	OptimizeProgram(optimized_program);
+	const VariableList variables = ResolveVariables(addresses, interface);
+
+	if (!RunProgram(optimized_program, addresses, variables, out_result))
+		return false;
+
+	CHECK_MESSAGE(out_result == unoptimized_result, "Optimized program: \n" << DumpProgram(optimized_program));
+	return true;
+}
+
 static String TestExpression(const String& expression)
 {
 	String result;
@@ -48,10 +75,9 @@ static String TestExpression(const String& expression)
 		Program program = parser.ReleaseProgram();
 		AddressList addresses = parser.ReleaseAddresses();
 
-		DataInterpreter interpreter(program, addresses, interface);
-
-		if (interpreter.Run())
-			result = interpreter.Result().Get<String>();
+		Variant variant;
+		if (RunProgramWithOptimization(program, addresses, variant))
+			result = variant.Get<String>();
 		else
 			FAIL_CHECK("Could not execute expression: " << expression << "\n\n  Parsed program: \n" << DumpProgram(program));
 	}
@@ -73,7 +99,7 @@ static bool TestAssignment(const String& expression)
 		Program program = parser.ReleaseProgram();
 		AddressList addresses = parser.ReleaseAddresses();
 
-		DataInterpreter interpreter(program, addresses, interface);
+		DataInterpreter interpreter(program, addresses, VariableList(), interface);
 		if (interpreter.Run())
 			result = true;
 		else
@@ -87,6 +113,16 @@ static bool TestAssignment(const String& expression)
 	return result;
 }
 
+static size_t OptimizedProgramSize(const String& expression)
+{
+	DataParser parser(expression, interface);
+	if (!parser.Parse(false))
+		return 0;
+	Program program = parser.ReleaseProgram();
+	OptimizeProgram(program);
+	return program.size();
+}
+
 TEST_CASE("Data expressions")
 {
 	float radius = 8.7f;
@@ -192,4 +228,11 @@ TEST_CASE("Data expressions")
 	handle.DirtyVariable("num_trolls");
 	CHECK(TestExpression("concatenate('It takes', num_trolls*3 + ' goats', 'to outsmart', num_trolls | number_suffix('troll','trolls'))") ==
 		"It takes,9 goats,to outsmart,3 trolls");
+
+	// Constant sub-expressions should be folded into a single literal.
+	CHECK(OptimizedProgramSize("2 * 2") == 1);
+	CHECK(OptimizedProgramSize("5*(1+2) - 4/2") == 1);
+	CHECK(OptimizedProgramSize("true || false ? true && 3==1+2 ? 'Absolutely!' : 'well..' : 'no'") == 1);
+	CHECK(OptimizedProgramSize("!!('tr' + 'ue')") == 1);
+	CHECK(OptimizedProgramSize("radius * (2 + 3)") == 4);
 }
@@ -26,10 +26,13 @@
  *
  */
 
+#include "../../../Source/Core/Atom.h"
 #include "../Common/TestsShell.h"
+#include <RmlUi/Core/ComputedValues.h>
 #include <RmlUi/Core/Context.h>
 #include <RmlUi/Core/Element.h>
 #include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/StyleSheet.h>
 #include <doctest.h>
 
 using namespace Rml;
@@ -65,6 +68,353 @@ static const String document_decorator_rml = R"(
 </rml>
 )";
 
+static const String document_sharing_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<style>
+		body {
+			font-family: LatoLatin;
+			font-size: 10px;
+			color: #fff;
+		}
+		.row { font-size: 20px; }
+		.row:hover { color: #f00; }
+		.row:nth-child(3) { font-size: 30px; }
+		.row[marked] .cell { color: #0f0; }
+		.cell { height: 2em; }
+	</style>
+</head>
+
+<body>
+<div class="row"><div class="cell"/><div class="cell"/></div>
+<div class="row"><div class="cell"/><div class="cell"/></div>
+<div class="row"><div class="cell"/><div class="cell"/></div>
+<div class="row"><div class="cell"/><div class="cell"/></div>
+<div class="row" marked><div class="cell"/><div class="cell"/></div>
+<div class="row"><div class="cell" style="font-size: 5px"/><div class="cell"/></div>
+</body>
+</rml>
+)";
+
+TEST_CASE("elementstyle.style_sharing")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_sharing_rml);
+	REQUIRE(document);
+	document->Show();
+
+	const Colourb white(255, 255, 255), red(255, 0, 0), green(0, 255, 0);
+
+	auto CheckCell = [&](int row, int cell, float height, Colourb color) {
+		Element* element = document->GetChild(row)->GetChild(cell);
+		const Style::ComputedValues& values = element->GetComputedValues();
+		CHECK_MESSAGE(values.height().value == height, "Row " << row << " cell " << cell);
+		CHECK_MESSAGE((values.color() == color), "Row " << row << " cell " << cell);
+	};
+	auto CheckRows = [&](int hover_row) {
+		for (int row = 0; row < document->GetNumChildren(); row++)
+		{
+			const bool marked = document->GetChild(row)->HasAttribute("marked");
+			const bool inline_font_size = !document->GetChild(row)->GetChild(0)->GetLocalStyleProperties().empty();
+			const Colourb color = (marked ? green : (row == hover_row ? red : white));
+			const float height = (row == 2 ? 60.f : (inline_font_size ? 10.f : 40.f));
+			CheckCell(row, 0, height, color);
+			CheckCell(row, 1, (row == 2 ? 60.f : 40.f), color);
+		}
+	};
+
+	TestsShell::RenderLoop();
+	CheckRows(-1);
+
+	document->GetChild(1)->SetPseudoClass("hover", true);
+	TestsShell::RenderLoop();
+	CheckRows(1);
+
+	document->GetChild(1)->SetPseudoClass("hover", false);
+	document->GetChild(3)->SetPseudoClass("hover", true);
+	TestsShell::RenderLoop();
+	CheckRows(3);
+
+	// Newly created rows should share their style with the previous rows.
+	for (int i = 0; i < 4; i++)
+	{
+		ElementPtr row = document->CreateElement("div");
+		row->SetClass("row", true);
+		row->SetInnerRML(R"(<div class="cell"/><div class="cell"/>)");
+		document->AppendChild(std::move(row));
+	}
+	document->GetChild(7)->SetAttribute("marked", "");
+	TestsShell::RenderLoop();
+	CheckRows(3);
+
+	// Inserting a row in front moves all the others, sharing must still find the correct siblings and cousins.
+	ElementPtr row = document->CreateElement("div");
+	row->SetClass("row", true);
+	row->SetInnerRML(R"(<div class="cell"/><div class="cell"/>)");
+	document->InsertBefore(std::move(row), document->GetFirstChild());
+	TestsShell::RenderLoop();
+	CheckRows(4);
+
+	document->Close();
+}
+
+TEST_CASE("elementstyle.shared_values")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_sharing_rml);
+	REQUIRE(document);
+	document->Show();
+	TestsShell::RenderLoop();
+
+	// Identical cells share their groups of computed values, writing to the values of one cell must not affect the others.
+	Element* row = document->GetChild(0);
+	Element* cell = row->GetChild(0);
+	Element* sibling = row->GetChild(1);
+	Element* other_row_cell = document->GetChild(1)->GetChild(0);
+
+	cell->SetProperty("color", "#00f");
+	cell->SetProperty("max-width", "50px");
+	cell->SetProperty("margin-left", "7px");
+	TestsShell::RenderLoop();
+
+	CHECK(cell->GetComputedValues().color() == Colourb(0, 0, 255));
+	CHECK(cell->GetComputedValues().max_width().value == 50.f);
+	CHECK(cell->GetComputedValues().margin_left().value == 7.f);
+	for (Element* element : {sibling, other_row_cell})
+	{
+		CHECK(element->GetComputedValues().color() == Colourb(255, 255, 255));
+		CHECK(element->GetComputedValues().max_width().value == FLT_MAX);
+		CHECK(element->GetComputedValues().margin_left().value == 0.f);
+	}
+
+	// Removing the properties again should give the same values as the other cells.
+	cell->RemoveProperty("color");
+	cell->RemoveProperty("max-width");
+	cell->RemoveProperty("margin-left");
+	TestsShell::RenderLoop();
+
+	CHECK(cell->GetComputedValues().color() == Colourb(255, 255, 255));
+	CHECK(cell->GetComputedValues().max_width().value == FLT_MAX);
+	CHECK(cell->GetComputedValues().margin_left().value == 0.f);
+
+	// Inherited values are passed on to the children of only the changed row.
+	row->SetProperty("font-size", "15px");
+	row->SetProperty("color", "#0ff");
+	TestsShell::RenderLoop();
+
+	CHECK(cell->GetComputedValues().height().value == 30.f);
+	CHECK(sibling->GetComputedValues().color() == Colourb(0, 255, 255));
+	CHECK(other_row_cell->GetComputedValues().height().value == 40.f);
+	CHECK(other_row_cell->GetComputedValues().color() == Colourb(255, 255, 255));
+
+	document->Close();
+}
+
+TEST_CASE("elementstyle.dirty_dependencies")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_sharing_rml);
+	REQUIRE(document);
+	document->Show();
+	TestsShell::RenderLoop();
+
+	Element* row = document->GetChild(0);
+	Element* cell = row->GetChild(0);
+	cell->SetProperty("width", "10vw");
+	cell->SetProperty("margin-left", "5px");
+	cell->SetProperty("text-align", "right");
+	TestsShell::RenderLoop();
+
+	const Vector2i dimensions = context->GetDimensions();
+	CHECK(cell->GetComputedValues().width().value == 0.1f * float(dimensions.x));
+
+	// Inheriting from the parent must not overwrite our local inherited properties.
+	row->SetProperty("color", "#0ff");
+	row->SetProperty("text-align", "center");
+	TestsShell::RenderLoop();
+
+	CHECK(cell->GetComputedValues().color() == Colourb(0, 255, 255));
+	CHECK(cell->GetComputedValues().text_align() == Style::TextAlign::Right);
+	CHECK(cell->GetComputedValues().margin_left().value == 5.f);
+
+	// Only the properties depending on the changed values should be recomputed, all of them must be up-to-date.
+	row->SetProperty("font-size", "12px");
+	context->SetDimensions(Vector2i(dimensions.x / 2, dimensions.y));
+	TestsShell::RenderLoop();
+
+	CHECK(cell->GetComputedValues().height().value == 24.f);
+	CHECK(cell->GetComputedValues().width().value == 0.1f * float(dimensions.x / 2));
+	CHECK(cell->GetComputedValues().margin_left().value == 5.f);
+
+	// Removed properties are reset to their default values.
+	cell->RemoveProperty("margin-left");
+	cell->RemoveProperty("text-align");
+	TestsShell::RenderLoop();
+
+	CHECK(cell->GetComputedValues().margin_left().value == 0.f);
+	CHECK(cell->GetComputedValues().text_align() == Style::TextAlign::Center);
+
+	context->SetDimensions(dimensions);
+	document->Close();
+}
+
+TEST_CASE("elementstyle.unit_usage_index")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_sharing_rml);
+	REQUIRE(document);
+	document->Show();
+	TestsShell::RenderLoop();
+
+	const Vector2i dimensions = context->GetDimensions();
+	Element* cell = document->GetChild(1)->GetChild(1);
+	cell->SetProperty("width", "10vw");
+	cell->SetProperty("padding-left", "2rem");
+	TestsShell::RenderLoop();
+
+	CHECK(cell->GetComputedValues().width().value == 0.1f * float(dimensions.x));
+
+	context->SetDimensions(Vector2i(dimensions.x / 2, dimensions.y));
+	TestsShell::RenderLoop();
+	CHECK(cell->GetComputedValues().width().value == 0.1f * float(dimensions.x / 2));
+
+	// Elements using the units are found after being added or moved to another subtree.
+	ElementPtr new_element = document->CreateElement("div");
+	new_element->SetProperty("height", "10vh");
+	Element* added = document->GetChild(3)->GetChild(0)->AppendChild(std::move(new_element));
+	TestsShell::RenderLoop();
+
+	Element* moved = document->GetChild(4)->AppendChild(cell->GetParentNode()->RemoveChild(cell));
+	TestsShell::RenderLoop();
+
+	context->SetDimensions(dimensions);
+	TestsShell::RenderLoop();
+	CHECK(added->GetComputedValues().height().value == 0.1f * float(dimensions.y));
+	CHECK(moved->GetComputedValues().width().value == 0.1f * float(dimensions.x));
+
+	document->SetProperty("font-size", "20px");
+	TestsShell::RenderLoop();
+	CHECK(moved->GetComputedValues().padding_left().value == 40.f);
+
+	// Removing the properties keeps the elements up-to-date.
+	moved->RemoveProperty("width");
+	added->RemoveProperty("height");
+	context->SetDimensions(Vector2i(dimensions.x / 2, dimensions.y));
+	TestsShell::RenderLoop();
+	CHECK(moved->GetComputedValues().width().type == Style::Width::Auto);
+	CHECK(added->GetComputedValues().height().type == Style::Height::Auto);
+
+	context->SetDimensions(dimensions);
+	document->Close();
+}
+
+static const String document_invalidation_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<style>
+		body { font-family: LatoLatin; color: #fff; }
+		.self { color: #f00; }
+		.parent .child { color: #0f0; }
+		.prev + .next { color: #00f; }
+		div:hover { color: #ff0; }
+		[marked] span { color: #0ff; }
+		span:not(.outer .excluded) { height: 10px; }
+	</style>
+</head>
+
+<body>
+<div id="a"><span id="a_child" class="child"/></div>
+<div id="b"/>
+<div id="c" class="next"><span id="c_child" class="excluded"/></div>
+</body>
+</rml>
+)";
+
+TEST_CASE("elementstyle.invalidation_sets")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_invalidation_rml);
+	REQUIRE(document);
+	document->Show();
+	TestsShell::RenderLoop();
+
+	const StyleSheet* style_sheet = document->GetStyleSheet();
+	REQUIRE(style_sheet);
+
+	CHECK(style_sheet->GetClassInvalidation("self") == StyleSheetIndex::InvalidateSelf);
+	CHECK(style_sheet->GetClassInvalidation("parent") == StyleSheetIndex::InvalidateDescendants);
+	CHECK(style_sheet->GetClassInvalidation("child") == StyleSheetIndex::InvalidateSelf);
+	CHECK(style_sheet->GetClassInvalidation("prev") == StyleSheetIndex::InvalidateSiblings);
+	CHECK(style_sheet->GetClassInvalidation("next") == StyleSheetIndex::InvalidateSelf);
+	CHECK(style_sheet->GetClassInvalidation("outer") == StyleSheetIndex::InvalidateDescendants);
+	CHECK(style_sheet->GetClassInvalidation("excluded") == StyleSheetIndex::InvalidateSelf);
+	CHECK(style_sheet->GetClassInvalidation("unused") == 0);
+	CHECK(style_sheet->GetPseudoClassInvalidation("hover") == StyleSheetIndex::InvalidateSelf);
+	CHECK(style_sheet->GetPseudoClassInvalidation("focus") == 0);
+	CHECK(style_sheet->GetAttributeInvalidation("marked") == StyleSheetIndex::InvalidateDescendants);
+	CHECK(style_sheet->GetAttributeInvalidation("unused") == 0);
+
+	// Queries must not intern names that are not used anywhere.
+	CHECK(style_sheet->GetClassInvalidation("never-used") == 0);
+	CHECK(style_sheet->GetPseudoClassInvalidation("never-used") == 0);
+	CHECK(AtomTable::Find("never-used") == Atom::None);
+	CHECK(AtomTable::Find("parent") != Atom::None);
+
+	Element* a = document->GetElementById("a");
+	Element* a_child = document->GetElementById("a_child");
+	Element* b = document->GetElementById("b");
+	Element* c = document->GetElementById("c");
+	Element* c_child = document->GetElementById("c_child");
+
+	const Colourb white(255, 255, 255), red(255, 0, 0), green(0, 255, 0), blue(0, 0, 255), yellow(255, 255, 0), cyan(0, 255, 255);
+
+	CHECK(a_child->GetComputedValues().color() == white);
+	CHECK(c_child->GetComputedValues().height().value == 10.f);
+
+	// Only the affected elements are restyled, they must all be up-to-date.
+	a->SetClass("parent", true);
+	b->SetClass("prev", true);
+	b->SetPseudoClass("hover", true);
+	a->SetClass("unused", true);
+	TestsShell::RenderLoop();
+
+	CHECK(a_child->GetComputedValues().color() == green);
+	CHECK(b->GetComputedValues().color() == yellow);
+	CHECK(c->GetComputedValues().color() == blue);
+
+	b->SetPseudoClass("hover", false);
+	b->SetClass("self", true);
+	document->SetClass("outer", true);
+	c->SetAttribute("marked", "");
+	TestsShell::RenderLoop();
+
+	CHECK(b->GetComputedValues().color() == red);
+	CHECK(c_child->GetComputedValues().color() == cyan);
+	CHECK(c_child->GetComputedValues().height().type == Style::Height::Auto);
+
+	a->SetClass("parent", false);
+	b->SetClass("prev", false);
+	c->RemoveAttribute("marked");
+	TestsShell::RenderLoop();
+
+	CHECK(a_child->GetComputedValues().color() == white);
+	CHECK(c->GetComputedValues().color() == white);
+	CHECK(c_child->GetComputedValues().color() == white);
+
+	document->Close();
+}
 
 TEST_CASE("elementstyle.inline_decorator_images")
 {
@@ -31,6 +31,7 @@
 #include <RmlUi/Core/Core.h>
 #include <RmlUi/Core/Element.h>
 #include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/ElementText.h>
 #include <doctest.h>
 
 using namespace Rml;
@@ -139,3 +140,321 @@ TEST_CASE("Layout.Position.Relative")
 
 	TestsShell::ShutdownShell();
 }
+
+static const String document_layout_boundary_rml = R"(
+<rml>
+<head>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body {
+			font-family: LatoLatin;
+			font-size: 16px;
+			width: 500px;
+			height: 400px;
+		}
+		#scroll {
+			position: relative;
+			height: 100px;
+			overflow: auto;
+			padding: 5px;
+		}
+		#popup {
+			position: absolute;
+			top: 20px;
+			left: 30px;
+			margin: 0 auto;
+		}
+		#anchored {
+			position: absolute;
+			right: 0;
+			bottom: 0;
+		}
+		.item {
+			height: 30px;
+		}
+		.item.tall {
+			height: 60px;
+		}
+	</style>
+</head>
+
+<body>
+	<p>Before</p>
+	<div id="scroll">
+		<div class="item" id="item">A</div>
+		<div class="item">B</div>
+		<div id="popup">Popup</div>
+		<div id="anchored">Anchored</div>
+	</div>
+	<p id="after">After</p>
+</body>
+</rml>
+)";
+
+struct LayoutSnapshot {
+	Vector<Vector2f> offsets;
+	Vector<Vector2f> sizes;
+};
+
+static void TakeLayoutSnapshot(Element* element, LayoutSnapshot& snapshot)
+{
+	snapshot.offsets.push_back(element->GetAbsoluteOffset(Box::BORDER));
+	snapshot.sizes.push_back(element->GetBox().GetSize(Box::BORDER));
+	snapshot.sizes.push_back(Vector2f(element->GetScrollWidth(), element->GetScrollHeight()));
+	for (int i = 0; i < element->GetNumChildren(true); i++)
+		TakeLayoutSnapshot(element->GetChild(i), snapshot);
+}
+
+TEST_CASE("Layout.Boundary")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_layout_boundary_rml);
+	REQUIRE(document);
+	document->Show();
+	TestsShell::RenderLoop();
+
+	Element* scroll = document->GetElementById("scroll");
+	Element* item = document->GetElementById("item");
+	Element* popup = document->GetElementById("popup");
+	Element* anchored = document->GetElementById("anchored");
+	Element* after = document->GetElementById("after");
+	REQUIRE(scroll);
+	REQUIRE(item);
+	REQUIRE(popup);
+	REQUIRE(anchored);
+	REQUIRE(after);
+
+	const float after_top = after->GetAbsoluteTop();
+
+	// Changes within a layout boundary only format the contents of the boundary, which should produce the same result as formatting the whole
+	// document.
+	auto check_layout = [&](const char* description) {
+		INFO(description);
+		TestsShell::RenderLoop();
+
+		LayoutSnapshot incremental;
+		TakeLayoutSnapshot(document, incremental);
+
+		// Force the whole document to be formatted, without changing the result.
+		document->SetProperty("width", "500px");
+		TestsShell::RenderLoop();
+
+		LayoutSnapshot full;
+		TakeLayoutSnapshot(document, full);
+		document->RemoveProperty("width");
+		TestsShell::RenderLoop();
+
+		CHECK(incremental.offsets == full.offsets);
+		CHECK(incremental.sizes == full.sizes);
+		CHECK(after->GetAbsoluteTop() == after_top);
+	};
+
+	for (int i = 0; i < 3; i++)
+	{
+		scroll->AppendChild(document->CreateElement("div"))->SetInnerRML("Appended");
+	}
+	check_layout("Append children");
+
+	item->SetClass("tall", true);
+	check_layout("Set class");
+
+	popup->SetInnerRML("Popup with a lot more text than before");
+	check_layout("Set popup contents");
+
+	// The offset of an element anchored to the right and bottom depends on its shrink-to-fit size, thus it must move as its contents grow.
+	auto get_anchored_bottom_right = [&]() { return anchored->GetAbsoluteOffset(Box::BORDER) + anchored->GetBox().GetSize(Box::BORDER); };
+	const Vector2f anchored_bottom_right = get_anchored_bottom_right();
+	const float anchored_width = anchored->GetBox().GetSize(Box::BORDER).x;
+
+	anchored->SetInnerRML("Anchored with a lot more text than before");
+	TestsShell::RenderLoop();
+	CHECK(anchored->GetBox().GetSize(Box::BORDER).x > anchored_width);
+	CHECK(get_anchored_bottom_right() == anchored_bottom_right);
+	check_layout("Set anchored contents");
+
+	scroll->RemoveChild(scroll->GetLastChild());
+	item->SetClass("tall", false);
+	check_layout("Remove child");
+
+	// Changing the boundary itself requires its ancestors to be formatted.
+	scroll->SetProperty("height", "150px");
+	TestsShell::RenderLoop();
+	CHECK(after->GetAbsoluteTop() == after_top + 50.f);
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
+
+static const String document_layout_cache_rml = R"(
+<rml>
+<head>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body {
+			font-family: LatoLatin;
+			font-size: 16px;
+			width: 500px;
+			height: 400px;
+		}
+		.row, .column { display: flex; }
+		.column { flex-direction: column; }
+		.item { flex: 1 1 auto; }
+	</style>
+</head>
+
+<body>
+	<div id="sibling"/>
+	<div class="row">
+		<div class="item">A</div>
+		<div class="item">
+			<div class="column">
+				<div class="item" id="item">B</div>
+				<div class="item">C</div>
+			</div>
+		</div>
+	</div>
+</body>
+</rml>
+)";
+
+TEST_CASE("Layout.Cache")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_layout_cache_rml);
+	REQUIRE(document);
+	document->Show();
+	TestsShell::RenderLoop();
+
+	// Format the document while the flex items are unchanged, then change an item deep within them. The cached layout of the item's ancestors
+	// must be invalidated, giving the same result as a freshly formatted document.
+	document->GetElementById("sibling")->SetProperty("height", "20px");
+	TestsShell::RenderLoop();
+
+	document->GetElementById("item")->SetInnerRML("A much longer text which wraps around to the next line");
+	TestsShell::RenderLoop();
+
+	LayoutSnapshot cached;
+	TakeLayoutSnapshot(document, cached);
+
+	ElementDocument* reference_document = context->LoadDocumentFromMemory(document_layout_cache_rml);
+	REQUIRE(reference_document);
+	reference_document->GetElementById("sibling")->SetProperty("height", "20px");
+	reference_document->GetElementById("item")->SetInnerRML("A much longer text which wraps around to the next line");
+	reference_document->Show();
+	TestsShell::RenderLoop();
+
+	LayoutSnapshot reference;
+	TakeLayoutSnapshot(reference_document, reference);
+
+	CHECK(cached.offsets == reference.offsets);
+	CHECK(cached.sizes == reference.sizes);
+
+	document->Close();
+	reference_document->Close();
+	TestsShell::ShutdownShell();
+}
+
+static const String document_layout_text_wrap_rml = R"(
+<rml>
+<head>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body {
+			font-family: LatoLatin;
+			font-size: 16px;
+			width: 500px;
+			height: 300px;
+		}
+		#pre-line { white-space: pre-line; }
+		#break-word { word-break: break-word; }
+	</style>
+</head>
+
+<body>
+	<p id="normal">  Lorem ipsum   dolor &amp; sit amet,&nbsp;consectetur adipiscing elit. Sed do eiusmod   </p>
+	<p id="pre-line">Lorem ipsum dolor
+sit amet,   consectetur
+  adipiscing elit. </p>
+	<p id="break-word">Pneumonoultramicroscopicsilicovolcanoconiosis is a   very long word.</p>
+</body>
+</rml>
+)";
+
+static Vector<String> GenerateTextLines(ElementText* element, float maximum_line_width)
+{
+	Vector<String> lines;
+	const int text_size = (int)element->GetText().size();
+
+	int line_begin = 0;
+	bool last_line = false;
+	while (!last_line && line_begin < text_size)
+	{
+		String line;
+		int line_length = 0;
+		float line_width = 0;
+		last_line = element->GenerateLine(line, line_length, line_width, line_begin, maximum_line_width, 0, lines.empty(), true);
+		lines.push_back(line + " (" + ToString((int)line_width) + ")");
+		line_begin += line_length;
+	}
+
+	return lines;
+}
+
+TEST_CASE("Layout.TextWrap")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_layout_text_wrap_rml);
+	REQUIRE(document);
+	document->Show();
+	TestsShell::RenderLoop();
+
+	// Re-wrapping the same text element at changing widths reuses its tokens, which must give the same lines as a new text element.
+	for (const char* id : {"normal", "pre-line", "break-word"})
+	{
+		Element* paragraph = document->GetElementById(id);
+		REQUIRE(paragraph);
+		ElementText* element = rmlui_dynamic_cast<ElementText*>(paragraph->GetFirstChild());
+		REQUIRE(element);
+
+		for (float width : {400.f, 150.f, 60.f, 20.f, 1.f, 90.f, -1.f, 250.f})
+		{
+			ElementPtr reference_ptr = document->CreateTextNode(element->GetText());
+			ElementText* reference = rmlui_dynamic_cast<ElementText*>(paragraph->AppendChild(std::move(reference_ptr)));
+			REQUIRE(reference);
+			context->Update();
+
+			const Vector<String> lines = GenerateTextLines(element, width);
+			const Vector<String> reference_lines = GenerateTextLines(reference, width);
+			CHECK(lines == reference_lines);
+			CHECK(!lines.empty());
+
+			paragraph->RemoveChild(reference);
+		}
+	}
+
+	// Tokens are generated with the same escape decoding as the lines.
+	{
+		Element* paragraph = document->GetElementById("normal");
+		ElementText* element = rmlui_dynamic_cast<ElementText*>(paragraph->AppendChild(document->CreateTextNode("Lorem &amp;amp; ipsum")));
+		REQUIRE(element);
+		context->Update();
+
+		const int token_begin = (int)element->GetText().find('&');
+		float decoded_width = 0, escaped_width = 0;
+		element->GenerateToken(decoded_width, token_begin, true);
+		element->GenerateToken(escaped_width, token_begin, false);
+		CHECK(decoded_width > 0);
+		CHECK(escaped_width > decoded_width);
+
+		paragraph->RemoveChild(element);
+	}
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
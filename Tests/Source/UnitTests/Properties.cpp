@@ -31,6 +31,7 @@
 #include <RmlUi/Core/Core.h>
 #include <RmlUi/Core/Element.h>
 #include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/PropertyDictionary.h>
 #include <doctest.h>
 
 using namespace Rml;
@@ -90,3 +91,55 @@ TEST_CASE("Properties")
 
 	Rml::Shutdown();
 }
+
+TEST_CASE("properties.dictionary_merge")
+{
+	auto MakeProperty = [](float value, int specificity) {
+		Property property(value, Property::PX);
+		property.specificity = specificity;
+		return property;
+	};
+	auto GetValue = [](const PropertyDictionary& dictionary, PropertyId id) {
+		const Property* property = dictionary.GetProperty(id);
+		return property ? property->Get<float>() : -1.f;
+	};
+
+	PropertyDictionary properties;
+	properties.SetProperty(PropertyId::MarginTop, MakeProperty(1.f, 10));
+	properties.SetProperty(PropertyId::Width, MakeProperty(2.f, 20));
+	properties.SetProperty(PropertyId::Height, MakeProperty(3.f, 20));
+
+	PropertyDictionary other;
+	other.SetProperty(PropertyId::PaddingLeft, MakeProperty(4.f, 10));
+	other.SetProperty(PropertyId::Width, MakeProperty(5.f, 5));
+	other.SetProperty(PropertyId::Height, MakeProperty(6.f, 10));
+	other.SetProperty(PropertyId::Opacity, MakeProperty(7.f, 10));
+
+	PropertyDictionary merged = properties;
+	merged.Merge(other, 10);
+
+	CHECK(merged.GetNumProperties() == 5);
+	CHECK(GetValue(merged, PropertyId::MarginTop) == 1.f);
+	CHECK(GetValue(merged, PropertyId::PaddingLeft) == 4.f);
+	CHECK(GetValue(merged, PropertyId::Width) == 2.f);
+	CHECK(GetValue(merged, PropertyId::Height) == 6.f);
+	CHECK(GetValue(merged, PropertyId::Opacity) == 7.f);
+	CHECK(merged.GetProperty(PropertyId::Height)->specificity == 20);
+	CHECK(merged.GetProperty(PropertyId::Opacity)->specificity == 20);
+
+	PropertyDictionary imported = properties;
+	imported.Import(other, 30);
+
+	CHECK(imported.GetNumProperties() == 5);
+	CHECK(GetValue(imported, PropertyId::Width) == 5.f);
+	CHECK(GetValue(imported, PropertyId::Height) == 6.f);
+	CHECK(imported.GetProperty(PropertyId::Width)->specificity == 30);
+
+	// The properties are ordered by id.
+	PropertyId previous_id = PropertyId::Invalid;
+	for (const auto& pair : imported.GetProperties())
+	{
+		CHECK(previous_id < pair.first);
+		previous_id = pair.first;
+	}
+}
@@ -26,6 +26,7 @@
  *
  */
 
+#include "../../../Source/Core/Atom.h"
 #include "../Common/TestsShell.h"
 #include <RmlUi/Core/Context.h>
 #include <RmlUi/Core/Core.h>
@@ -72,7 +73,7 @@ static const String doc_end = R"(
 </rml>
 )";
 
-enum class SelectorOp { None, RemoveElementsByIds, InsertElementBefore, RemoveClasses, RemoveId, RemoveChecked, RemoveAttributeUnit, SetHover };
+enum class SelectorOp { None, RemoveElementsByIds, InsertElementBefore, RemoveClasses, AddClass, RemoveId, RemoveChecked, RemoveAttributeUnit, SetHover };
 
 struct QuerySelector {
 	QuerySelector(String selector, String expected_ids, int expect_num_warnings = 0, int expect_num_query_warnings = 0) :
@@ -222,6 +223,12 @@ static const Vector<QuerySelector> query_selectors =
 	{ "#E + * ~ *",                  "G H" },
 	{ "#B + * ~ #G",                 "G" },
 	{ "body > :nth-child(4) span:first-child",  "D0 F0", SelectorOp::RemoveElementsByIds,  "X",    "" },
+
+	{ ".outer span",                 "",                SelectorOp::AddClass,             "P outer", "D0 D1 F0" },
+	{ ".outer > p > span",           "",                SelectorOp::AddClass,             "P outer", "D0 D1 F0" },
+	{ ".outer > span",               "",                SelectorOp::AddClass,             "D outer", "D0 D1" },
+	{ "body .parent #D span",        "D0 D1",           SelectorOp::RemoveClasses,        "parent", ""  },
+	{ "#P span",                     "D0 D1 F0",        SelectorOp::RemoveId,             "P", ""  },
 };
 
 struct ClosestSelector {
@@ -300,6 +307,13 @@ static void RemoveClassesFromAllElements(ElementDocument* document, const String
 			element->SetClass(name, false);
 	}
 }
+static void AddClassToElement(ElementDocument* document, const String& id_and_class)
+{
+	StringList arguments;
+	StringUtilities::ExpandString(arguments, id_and_class, ' ');
+	REQUIRE(arguments.size() == 2);
+	document->GetElementById(arguments[0])->SetClass(arguments[1], true);
+}
 static void InsertElementBefore(ElementDocument* document, const String& before_id)
 {
 	Element* element = document->GetElementById(before_id);
@@ -346,6 +360,10 @@ TEST_CASE("Selectors")
 					RemoveClassesFromAllElements(document, selector.operation_argument);
 					operation_str = "RemoveClasses";
 					break;
+				case SelectorOp::AddClass:
+					AddClassToElement(document, selector.operation_argument);
+					operation_str = "AddClass";
+					break;
 				case SelectorOp::RemoveChecked:
 					document->GetElementById(selector.operation_argument)->RemoveAttribute("checked");
 					operation_str = "RemoveChecked";
@@ -426,3 +444,77 @@ TEST_CASE("Selectors")
 
 	TestsShell::ShutdownShell();
 }
+
+static const String document_atoms_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<style>
+		body { width: 400px; height: 300px; }
+		div { width: 1px; height: 1px; }
+		div.alpha { width: 2px; }
+		div.alpha:hover { width: 3px; }
+		div#beta { height: 4px; }
+	</style>
+</head>
+<body>
+	<div id="target"/>
+</body>
+</rml>
+)";
+
+TEST_CASE("selectors.atoms")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	// Each name is interned once, while lookups with Find() leave the table unchanged.
+	const Atom atom = AtomTable::GetOrInsert("atom-interned");
+	CHECK(atom != Atom::None);
+	CHECK(AtomTable::GetOrInsert("atom-interned") == atom);
+	CHECK(AtomTable::Find("atom-interned") == atom);
+	CHECK(AtomTable::GetName(atom) == "atom-interned");
+	CHECK(AtomTable::GetOrInsert("") == Atom::None);
+
+	CHECK(AtomTable::Find("atom-never-interned") == Atom::None);
+	CHECK(AtomTable::Find("atom-never-interned") == Atom::None);
+	CHECK(AtomTable::GetOrInsert("atom-never-interned") != atom);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_atoms_rml);
+	REQUIRE(document);
+	document->Show();
+
+	Element* element = document->GetElementById("target");
+	REQUIRE(element);
+
+	auto GetSize = [&]() {
+		context->Update();
+		return Vector2f(element->GetProperty<float>("width"), element->GetProperty<float>("height"));
+	};
+
+	// Selectors match the atoms of the tag, id, classes, and pseudo-classes as they change on the element.
+	CHECK(GetSize() == Vector2f(1.f, 1.f));
+
+	element->SetClass("alpha", true);
+	CHECK(GetSize() == Vector2f(2.f, 1.f));
+
+	element->SetPseudoClass("hover", true);
+	CHECK(GetSize() == Vector2f(3.f, 1.f));
+
+	element->SetClass("alpha", false);
+	CHECK(GetSize() == Vector2f(1.f, 1.f));
+
+	element->SetClassNames("gamma alpha");
+	CHECK(GetSize() == Vector2f(3.f, 1.f));
+
+	element->SetPseudoClass("hover", false);
+	element->SetId("beta");
+	CHECK(GetSize() == Vector2f(2.f, 4.f));
+
+	element->SetId("target");
+	CHECK(GetSize() == Vector2f(2.f, 1.f));
+
+	document->Close();
+
+	TestsShell::ShutdownShell();
+}
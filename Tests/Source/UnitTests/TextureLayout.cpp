@@ -0,0 +1,153 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "../../../Source/Core/TextureLayout.cpp"
+#include "../../../Source/Core/TextureLayoutRectangle.cpp"
+#include "../../../Source/Core/TextureLayoutRow.cpp"
+#include "../../../Source/Core/TextureLayoutTexture.cpp"
+#include <RmlUi/Core/Types.h>
+#include <doctest.h>
+
+using namespace Rml;
+
+static bool RectanglesOverlap(TextureLayoutRectangle& a, TextureLayoutRectangle& b)
+{
+	if (a.GetTextureIndex() != b.GetTextureIndex())
+		return false;
+
+	const Vector2i a_min = a.GetPosition(), a_max = a.GetPosition() + a.GetDimensions();
+	const Vector2i b_min = b.GetPosition(), b_max = b.GetPosition() + b.GetDimensions();
+	return a_min.x < b_max.x && b_min.x < a_max.x && a_min.y < b_max.y && b_min.y < a_max.y;
+}
+
+static bool IsValidLayout(TextureLayout& layout)
+{
+	for (int i = 0; i < layout.GetNumRectangles(); i++)
+	{
+		TextureLayoutRectangle& rectangle = layout.GetRectangle(i);
+		if (!rectangle.IsPlaced())
+			return false;
+
+		const Vector2i texture_dimensions = layout.GetTexture(rectangle.GetTextureIndex()).GetDimensions();
+		const Vector2i max = rectangle.GetPosition() + rectangle.GetDimensions();
+		if (max.x > texture_dimensions.x || max.y > texture_dimensions.y)
+			return false;
+
+		for (int j = i + 1; j < layout.GetNumRectangles(); j++)
+		{
+			if (RectanglesOverlap(rectangle, layout.GetRectangle(j)))
+				return false;
+		}
+	}
+	return true;
+}
+
+TEST_CASE("TextureLayout.incremental")
+{
+	constexpr int max_texture_dimensions = 256;
+
+	TextureLayout layout;
+	for (int i = 0; i < 40; i++)
+		layout.AddRectangle(i, Vector2i(5 + i % 7, 10 + i % 5));
+
+	REQUIRE(layout.GenerateLayout(max_texture_dimensions));
+	CHECK(layout.GetNumTextures() == 1);
+	CHECK(layout.GetNumLaidOutRectangles() == 40);
+	CHECK(IsValidLayout(layout));
+
+	UnorderedMap<int, Vector2i> initial_positions;
+	for (int i = 0; i < layout.GetNumRectangles(); i++)
+		initial_positions[layout.GetRectangle(i).GetId()] = layout.GetRectangle(i).GetPosition();
+
+	// Add rectangles one at a time, as when new glyphs are encountered. Existing rectangles must never move.
+	for (int i = 40; i < 700; i++)
+	{
+		layout.AddRectangle(i, Vector2i(5 + i % 7, 10 + i % 5));
+		REQUIRE(layout.GenerateLayout(max_texture_dimensions));
+
+		CHECK(layout.GetNumLaidOutRectangles() == i + 1);
+		CHECK(layout.GetRectangle(i).IsPlaced());
+	}
+
+	CHECK(IsValidLayout(layout));
+
+	for (int i = 0; i < 40; i++)
+	{
+		CHECK(layout.GetRectangle(i).GetTextureIndex() == 0);
+		CHECK(layout.GetRectangle(i).GetPosition() == initial_positions[layout.GetRectangle(i).GetId()]);
+	}
+
+	// The first texture should grow to the maximum size before any new textures are added.
+	CHECK(layout.GetTexture(0).GetDimensions() == Vector2i(max_texture_dimensions, max_texture_dimensions));
+	CHECK(layout.GetNumTextures() == 2);
+
+	auto FindRectangle = [&](int id) -> TextureLayoutRectangle& {
+		for (int i = 0; i < layout.GetNumRectangles(); i++)
+		{
+			if (layout.GetRectangle(i).GetId() == id)
+				return layout.GetRectangle(i);
+		}
+		REQUIRE(false);
+		return layout.GetRectangle(0);
+	};
+
+	// Rectangles larger than the maximum texture size cannot be placed, they remain pending after the laid out rectangles.
+	const Vector2i texture_dimensions = layout.GetTexture(1).GetDimensions();
+	layout.AddRectangle(1000, Vector2i(max_texture_dimensions * 2, 10));
+	CHECK(!layout.GenerateLayout(max_texture_dimensions));
+	CHECK(layout.GetNumLaidOutRectangles() == 700);
+	CHECK(!FindRectangle(1000).IsPlaced());
+	CHECK(layout.GetTexture(1).GetDimensions() == texture_dimensions);
+
+	// Other rectangles are still placed, while the pending rectangle is attempted again.
+	layout.AddRectangle(1001, Vector2i(8, 10));
+	layout.AddRectangle(1002, Vector2i(max_texture_dimensions * 2, 20));
+	layout.AddRectangle(1003, Vector2i(9, 10));
+	CHECK(!layout.GenerateLayout(max_texture_dimensions));
+	CHECK(layout.GetNumLaidOutRectangles() == 702);
+	CHECK(FindRectangle(1001).IsPlaced());
+	CHECK(FindRectangle(1003).IsPlaced());
+	CHECK(!FindRectangle(1000).IsPlaced());
+	CHECK(!FindRectangle(1002).IsPlaced());
+	for (int i = 0; i < layout.GetNumLaidOutRectangles(); i++)
+		CHECK(layout.GetRectangle(i).IsPlaced());
+
+	// The textures must still refer to their rectangles after these were moved in front of the pending rectangles.
+	const int texture_index = FindRectangle(1003).GetTextureIndex();
+	const UniquePtr<byte[]> texture_data = layout.GetTexture(texture_index).AllocateTexture(layout);
+	CHECK(FindRectangle(1003).GetTextureData() != nullptr);
+	CHECK(FindRectangle(1000).GetTextureData() == nullptr);
+
+	// The pending rectangles are placed once they fit.
+	CHECK(layout.GenerateLayout(max_texture_dimensions * 4));
+	CHECK(layout.GetNumLaidOutRectangles() == 704);
+	CHECK(IsValidLayout(layout));
+
+	for (int i = 0; i < 40; i++)
+		CHECK(FindRectangle(i).GetPosition() == initial_positions[i]);
+}